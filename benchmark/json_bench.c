@@ -0,0 +1,358 @@
+/******************************************************************************
+*
+* File Name: json_bench.c
+*
+* Description: Host microbenchmark of the JSON extractor. It runs the ipinfo.io and
+* Open-Meteo responses through json_extract and through cy_JSON_parser
+* the way the application used to (copy, then callback with key
+* compares), checks that both give the same values and prints the
+* throughput of each.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "cy_json_parser.h"
+#include "json_extract.h"
+#include "geo_cache.h"
+#include "weather_state.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define BENCH_ITERATIONS        (200000u)
+
+/*******************************************************************************
+ * Data structure and enumeration
+ ******************************************************************************/
+typedef void (*bench_fn_t)(const char *payload, uint32_t len);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Responses as the servers send them, trimmed of nothing. */
+static const char geo_payload[] =
+    "{\n"
+    "  \"ip\": \"203.0.113.42\",\n"
+    "  \"hostname\": \"203-0-113-42.example.net\",\n"
+    "  \"city\": \"Bengaluru\",\n"
+    "  \"region\": \"Karnataka\",\n"
+    "  \"country\": \"IN\",\n"
+    "  \"loc\": \"12.9719,77.5937\",\n"
+    "  \"org\": \"AS64500 Example Broadband\",\n"
+    "  \"postal\": \"560001\",\n"
+    "  \"timezone\": \"Asia/Kolkata\",\n"
+    "  \"readme\": \"https://ipinfo.io/missingauth\"\n"
+    "}";
+
+static const char weather_payload[] =
+    "{\"latitude\":12.875,\"longitude\":77.625,\"generationtime_ms\":0.0439882278442383,"
+    "\"utc_offset_seconds\":0,\"timezone\":\"GMT\",\"timezone_abbreviation\":\"GMT\","
+    "\"elevation\":904.0,\"current_units\":{\"time\":\"iso8601\",\"interval\":\"seconds\","
+    "\"temperature_2m\":\"°C\",\"relative_humidity_2m\":\"%\",\"wind_speed_10m\":\"km/h\","
+    "\"weather_code\":\"wmo code\"},\"current\":{\"time\":\"2024-01-22T10:15\",\"interval\":900,"
+    "\"temperature_2m\":24.6,\"relative_humidity_2m\":58,\"wind_speed_10m\":9.4,"
+    "\"weather_code\":61}}";
+
+static const json_field_t geo_schema[JSON_KEY_COUNT] =
+{
+    [JSON_KEY_IP]       = { JSON_FIELD_TEXT, JSON_KEY_ROOT, offsetof(geo_cache_entry_t, public_ip),
+                            GEO_CACHE_IP_LEN, 0 },
+    [JSON_KEY_LOC]      = { JSON_FIELD_COORDS, JSON_KEY_ROOT, offsetof(geo_cache_entry_t, latitude),
+                            GEO_CACHE_COORD_LEN, offsetof(geo_cache_entry_t, longitude) },
+    [JSON_KEY_CITY]     = { JSON_FIELD_TEXT, JSON_KEY_ROOT, offsetof(geo_cache_entry_t, city),
+                            GEO_CACHE_CITY_LEN, 0 },
+    [JSON_KEY_TIMEZONE] = { JSON_FIELD_TEXT, JSON_KEY_ROOT, offsetof(geo_cache_entry_t, timezone),
+                            GEO_CACHE_TIMEZONE_LEN, 0 },
+};
+
+static const json_field_t weather_schema[JSON_KEY_COUNT] =
+{
+    [JSON_KEY_TEMPERATURE_2M]       = { JSON_FIELD_TEXT, JSON_KEY_CURRENT, offsetof(weather_state_t, temperature),
+                                        WEATHER_TEXT_LEN, 0 },
+    [JSON_KEY_RELATIVE_HUMIDITY_2M] = { JSON_FIELD_TEXT, JSON_KEY_CURRENT, offsetof(weather_state_t, humidity),
+                                        WEATHER_TEXT_LEN, 0 },
+    [JSON_KEY_WIND_SPEED_10M]       = { JSON_FIELD_TEXT, JSON_KEY_CURRENT, offsetof(weather_state_t, windspeed),
+                                        WEATHER_TEXT_LEN, 0 },
+    [JSON_KEY_WEATHER_CODE]         = { JSON_FIELD_INT32, JSON_KEY_CURRENT, offsetof(weather_state_t, weather_code),
+                                        sizeof(int32_t), 0 },
+};
+
+static geo_cache_entry_t geo_new, geo_old;
+static weather_state_t weather_new, weather_old;
+
+/*******************************************************************************
+* Function Name: cy_rslt_t old_geo_cb(cy_JSON_object_t *object, void *arg)
+********************************************************************************
+*
+* Summary: The application's former geolocation callback.
+*
+*******************************************************************************/
+static cy_rslt_t old_geo_cb(cy_JSON_object_t *object, void *arg)
+{
+    if (strncmp(object->object_string, "loc", object->object_string_length) == 0 &&
+        strlen("loc") == object->object_string_length)
+    {
+        char temp[64] = {0};
+        snprintf(temp, sizeof(temp), "%.*s", object->value_length, object->value);
+
+        char *separator = strchr(temp, ',');
+        if (separator != NULL)
+        {
+            *separator = '\0';
+            snprintf(geo_old.latitude, sizeof(geo_old.latitude), "%s", temp);
+            snprintf(geo_old.longitude, sizeof(geo_old.longitude), "%s", separator + 1);
+        }
+    }
+    else if (strncmp(object->object_string, "timezone", object->object_string_length) == 0 &&
+             strlen("timezone") == object->object_string_length)
+    {
+        snprintf(geo_old.timezone, sizeof(geo_old.timezone), "%.*s",
+                 (int)object->value_length, object->value);
+    }
+    else if (strncmp(object->object_string, "ip", object->object_string_length) == 0 &&
+             strlen("ip") == object->object_string_length)
+    {
+        snprintf(geo_old.public_ip, sizeof(geo_old.public_ip), "%.*s",
+                 (int)object->value_length, object->value);
+    }
+    else if (strncmp(object->object_string, "city", object->object_string_length) == 0 &&
+             strlen("city") == object->object_string_length)
+    {
+        snprintf(geo_old.city, sizeof(geo_old.city), "%.*s",
+                 (int)object->value_length, object->value);
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_rslt_t old_weather_cb(cy_JSON_object_t *object, void *arg)
+********************************************************************************
+*
+* Summary: The application's former weather callback.
+*
+*******************************************************************************/
+static cy_rslt_t old_weather_cb(cy_JSON_object_t *object, void *arg)
+{
+    char weathercode[16];
+
+    if (object->object_string == NULL)
+        return CY_RSLT_SUCCESS;
+
+    if (strncmp(object->object_string, "temperature_2m", object->object_string_length) == 0)
+    {
+        snprintf(weather_old.temperature, sizeof(weather_old.temperature), "%.*s",
+                 (int)object->value_length, object->value);
+    }
+    else if (strncmp(object->object_string, "relative_humidity_2m", object->object_string_length) == 0)
+    {
+        snprintf(weather_old.humidity, sizeof(weather_old.humidity), "%.*s",
+                 (int)object->value_length, object->value);
+    }
+    else if (strncmp(object->object_string, "wind_speed_10m", object->object_string_length) == 0)
+    {
+        snprintf(weather_old.windspeed, sizeof(weather_old.windspeed), "%.*s",
+                 (int)object->value_length, object->value);
+    }
+    else if (strncmp(object->object_string, "weather_code", object->object_string_length) == 0)
+    {
+        snprintf(weathercode, sizeof(weathercode), "%.*s",
+                 (int)object->value_length, object->value);
+        weather_old.weather_code = atoi(weathercode);
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: void old_geo(const char *payload, uint32_t len)
+********************************************************************************
+*
+* Summary: Former geolocation path: strlen, strchr, copy to the stack, parse.
+*
+*******************************************************************************/
+static void old_geo(const char *payload, uint32_t len)
+{
+    if (strlen(payload) == 0)
+        return;
+
+    char *json_end = strchr(payload, '}');
+    size_t json_length = json_end - payload + 1;
+    char valid_json[json_length + 1];
+    strncpy(valid_json, payload, json_length);
+    valid_json[json_length] = '\0';
+
+    cy_JSON_parser_register_callback(old_geo_cb, NULL);
+    cy_JSON_parser(valid_json, json_length);
+}
+
+/*******************************************************************************
+* Function Name: void old_weather(const char *payload, uint32_t len)
+********************************************************************************
+*
+* Summary: Former weather path: copy to the heap, parse.
+*
+*******************************************************************************/
+static void old_weather(const char *payload, uint32_t len)
+{
+    char *json_buf = malloc(len + 1);
+    memcpy(json_buf, payload, len);
+    json_buf[len] = '\0';
+
+    cy_JSON_parser_register_callback(old_weather_cb, NULL);
+    cy_JSON_parser(json_buf, len);
+
+    free(json_buf);
+}
+
+/*******************************************************************************
+* Function Name: void new_geo(const char *payload, uint32_t len)
+********************************************************************************
+*
+* Summary: New geolocation path: extract in place.
+*
+*******************************************************************************/
+static void new_geo(const char *payload, uint32_t len)
+{
+    json_extract_t parser;
+
+    json_extract_init(&parser, geo_schema, &geo_new);
+    json_extract_feed(&parser, payload, len);
+    json_extract_finish(&parser);
+}
+
+/*******************************************************************************
+* Function Name: void new_weather(const char *payload, uint32_t len)
+********************************************************************************
+*
+* Summary: New weather path: extract in place.
+*
+*******************************************************************************/
+static void new_weather(const char *payload, uint32_t len)
+{
+    json_extract_t parser;
+
+    json_extract_init(&parser, weather_schema, &weather_new);
+    json_extract_feed(&parser, payload, len);
+    json_extract_finish(&parser);
+}
+
+/*******************************************************************************
+* Function Name: double bench(bench_fn_t fn, const char *payload, uint32_t len)
+********************************************************************************
+*
+* Summary: Runs fn over the payload BENCH_ITERATIONS times.
+*
+* Return:
+*  throughput in MB/s
+*
+*******************************************************************************/
+static double bench(bench_fn_t fn, const char *payload, uint32_t len)
+{
+    struct timespec start, end;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t i = 0; i < BENCH_ITERATIONS; i++)
+    {
+        fn(payload, len);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    double seconds = (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_nsec - start.tv_nsec) / 1e9);
+    return ((double)len * BENCH_ITERATIONS) / seconds / 1e6;
+}
+
+/*******************************************************************************
+* Function Name: void report(...)
+********************************************************************************
+*
+* Summary: Benchmarks both paths on one payload and prints a line.
+*
+*******************************************************************************/
+static void report(const char *name, const char *payload, uint32_t len,
+                   bench_fn_t old_fn, bench_fn_t new_fn)
+{
+    double old_mbs = bench(old_fn, payload, len);
+    double new_mbs = bench(new_fn, payload, len);
+
+    printf("%-8s %4u bytes  cy_JSON_parser %7.1f MB/s  json_extract %7.1f MB/s  x%.1f\n",
+           name, (unsigned)len, old_mbs, new_mbs, new_mbs / old_mbs);
+}
+
+/*******************************************************************************
+* Function Name: int main(void)
+********************************************************************************
+*
+* Summary: Checks that both paths agree, then benchmarks them.
+*
+*******************************************************************************/
+int main(void)
+{
+    uint32_t geo_len = sizeof(geo_payload) - 1u;
+    uint32_t weather_len = sizeof(weather_payload) - 1u;
+
+    old_geo(geo_payload, geo_len);
+    new_geo(geo_payload, geo_len);
+    old_weather(weather_payload, weather_len);
+    new_weather(weather_payload, weather_len);
+
+    if ((0 != strcmp(geo_old.latitude, geo_new.latitude)) ||
+        (0 != strcmp(geo_old.longitude, geo_new.longitude)) ||
+        (0 != strcmp(geo_old.city, geo_new.city)) ||
+        (0 != strcmp(geo_old.timezone, geo_new.timezone)) ||
+        (0 != strcmp(geo_old.public_ip, geo_new.public_ip)) ||
+        (0 != strcmp(weather_old.temperature, weather_new.temperature)) ||
+        (0 != strcmp(weather_old.humidity, weather_new.humidity)) ||
+        (0 != strcmp(weather_old.windspeed, weather_new.windspeed)) ||
+        (weather_old.weather_code != weather_new.weather_code))
+    {
+        printf("Extracted values differ between the two parsers\n");
+        return 1;
+    }
+
+    report("geo", geo_payload, geo_len, old_geo, new_geo);
+    report("weather", weather_payload, weather_len, old_weather, new_weather);
+
+    return 0;
+}
+
+/* [] END OF FILE */
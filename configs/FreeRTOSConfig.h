@@ -86,8 +86,17 @@ extern uint32_t SystemCoreClock;
 #define configUSE_MALLOC_FAILED_HOOK            1
 #define configUSE_DAEMON_TASK_STARTUP_HOOK      0
 
-/* Run time and task stats gathering related definitions. */
+/* Run time and task stats gathering related definitions. TFT_SCHED_STATS
+ * counts task run time with the DWT cycle counter (see tft_task.c). */
+#if defined(TFT_SCHED_STATS)
+extern void tft_sched_stats_timer_init(void);
+extern uint32_t tft_sched_stats_timer_get(void);
+#define configGENERATE_RUN_TIME_STATS           1
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() tft_sched_stats_timer_init()
+#define portGET_RUN_TIME_COUNTER_VALUE()        tft_sched_stats_timer_get()
+#else
 #define configGENERATE_RUN_TIME_STATS           0
+#endif
 #define configUSE_TRACE_FACILITY                1
 #define configUSE_STATS_FORMATTING_FUNCTIONS    0
 
@@ -158,7 +167,11 @@ to exclude the API function. */
 #define INCLUDE_xTaskGetSchedulerState          1
 #define INCLUDE_xTaskGetCurrentTaskHandle       1
 #define INCLUDE_uxTaskGetStackHighWaterMark     0
+#if defined(TFT_SCHED_STATS)
+#define INCLUDE_xTaskGetIdleTaskHandle          1
+#else
 #define INCLUDE_xTaskGetIdleTaskHandle          0
+#endif
 #define INCLUDE_eTaskGetState                   0
 #define INCLUDE_xEventGroupSetBitFromISR        1
 #define INCLUDE_xTimerPendFunctionCall          1
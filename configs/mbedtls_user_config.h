@@ -147,6 +147,27 @@
 // #define MBEDTLS_PLATFORM_NV_SEED_ALT
 // #define MBEDTLS_PLATFORM_SETUP_TEARDOWN_ALT
 
+/**
+ * \def MBEDTLS_PLATFORM_MEMORY
+ *
+ * Provides mbedtls_platform_set_calloc_free(), through which
+ * source/tls_client.c points mbedTLS at the static TLS arena
+ * (source/tls_arena.c). The data cache section below defines it only for
+ * parts with a data cache.
+ */
+#define MBEDTLS_PLATFORM_MEMORY
+
+/**
+ * \def MBEDTLS_SSL_IN_CONTENT_LEN
+ * \def MBEDTLS_SSL_OUT_CONTENT_LEN
+ *
+ * Record buffers of each TLS connection, both taken from the TLS arena.
+ * Requests are well under 2 KB, so the send buffer is cut to that. The
+ * receive buffer keeps the default 16 KB: it must hold the largest record
+ * the server sends, and the HTTP client cannot negotiate smaller ones.
+ */
+#define MBEDTLS_SSL_OUT_CONTENT_LEN             2048
+
 /**
  * \def MBEDTLS_ENTROPY_HARDWARE_ALT
  *
@@ -0,0 +1,644 @@
+/******************************************************************************
+*
+* File Name: mock_weather_server.c
+*
+* Description: Local stand-in for ipinfo.io, Open-Meteo and wttr.in, for
+* exercising the hedged weather requests offline. Each endpoint
+* answers after a configurable delay, with a share of slow answers
+* and of 503 errors, and logs what it did with every request. An
+* SNTP server with a configurable clock error and network delay
+* stands in for the NTP pool.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <errno.h>
+#include <netinet/in.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define MOCK_PORT_GEO           (8080)
+#define MOCK_PORT_OPEN_METEO    (8081)
+#define MOCK_PORT_WTTR          (8082)
+#define MOCK_PORT_SNTP          (8123)
+
+#define MOCK_REQUEST_MAX        (4096)
+#define MOCK_BODY_MAX           (2048)
+
+#define MOCK_SNTP_LEN           (48)
+#define MOCK_NTP_UNIX_OFFSET_S  (2208988800ULL)
+
+/*******************************************************************************
+ * Data structure and enumeration
+ ******************************************************************************/
+/* Latency and failures injected into one endpoint. */
+typedef struct
+{
+    unsigned int delay_ms;      /* before every answer */
+    unsigned int slow_ms;       /* instead, for slow_pct percent of them */
+    unsigned int slow_pct;
+    unsigned int error_pct;     /* answered with 503 */
+} mock_profile_t;
+
+/* Clock error and symmetric network delay of the SNTP stand-in. */
+typedef struct
+{
+    long offset_ms;
+    unsigned int delay_ms;      /* round trip, half each way */
+} mock_sntp_profile_t;
+
+typedef struct
+{
+    const char *name;
+    int port;
+    int (*body)(char *buf, size_t size, time_t now);
+    mock_profile_t profile;
+    int listener;
+} mock_endpoint_t;
+
+/*******************************************************************************
+ * Function Name: mock_geo_body
+ *******************************************************************************
+ * Summary:
+ *  ipinfo.io /json answer.
+ *
+ *******************************************************************************/
+static int mock_geo_body(char *buf, size_t size, time_t now)
+{
+    (void)now;
+    return snprintf(buf, size,
+                    "{\n  \"ip\": \"203.0.113.42\",\n  \"city\": \"Bengaluru\",\n"
+                    "  \"region\": \"Karnataka\",\n  \"country\": \"IN\",\n"
+                    "  \"loc\": \"12.9719,77.5937\",\n  \"timezone\": \"Asia/Kolkata\"\n}");
+}
+
+/*******************************************************************************
+ * Function Name: mock_open_meteo_body
+ *******************************************************************************
+ * Summary:
+ *  Open-Meteo /v1/forecast answer. The values move every 15 minutes, like
+ *  the real "current" block.
+ *
+ *******************************************************************************/
+static int mock_open_meteo_body(char *buf, size_t size, time_t now)
+{
+    time_t slot = now - (now % 900);
+    struct tm tm;
+
+    gmtime_r(&slot, &tm);
+    return snprintf(buf, size,
+                    "{\"latitude\":12.875,\"longitude\":77.625,\"utc_offset_seconds\":0,\"timezone\":\"GMT\","
+                    "\"current_units\":{\"time\":\"iso8601\",\"interval\":\"seconds\",\"temperature_2m\":\"°C\","
+                    "\"relative_humidity_2m\":\"%%\",\"wind_speed_10m\":\"km/h\",\"weather_code\":\"wmo code\"},"
+                    "\"current\":{\"time\":\"%04d-%02d-%02dT%02d:%02d\",\"interval\":900,"
+                    "\"temperature_2m\":%d.%d,\"relative_humidity_2m\":%d,\"wind_speed_10m\":9.4,"
+                    "\"weather_code\":%d}}",
+                    tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min,
+                    20 + tm.tm_hour % 10, tm.tm_min / 6, 50 + tm.tm_min / 2,
+                    (0 == (tm.tm_hour % 3)) ? 61 : 3);
+}
+
+/*******************************************************************************
+ * Function Name: mock_wttr_body
+ *******************************************************************************
+ * Summary:
+ *  wttr.in ?format=j1 answer, cut down to the current conditions and one
+ *  hourly entry.
+ *
+ *******************************************************************************/
+static int mock_wttr_body(char *buf, size_t size, time_t now)
+{
+    struct tm tm;
+
+    gmtime_r(&now, &tm);
+    return snprintf(buf, size,
+                    "{\"current_condition\":[{\"FeelsLikeC\":\"%d\",\"humidity\":\"%d\","
+                    "\"localObsDateTime\":\"%04d-%02d-%02d %02d:%02d AM\",\"temp_C\":\"%d\","
+                    "\"weatherCode\":\"%d\",\"weatherDesc\":[{\"value\":\"mock\"}],\"windspeedKmph\":\"9\"}],"
+                    "\"weather\":[{\"hourly\":[{\"humidity\":\"90\",\"tempC\":\"18\",\"weatherCode\":\"113\","
+                    "\"windspeedKmph\":\"3\"}]}]}",
+                    21 + tm.tm_hour % 10, 50 + tm.tm_min / 2,
+                    tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour % 12, tm.tm_min,
+                    20 + tm.tm_hour % 10, (0 == (tm.tm_hour % 3)) ? 296 : 119);
+}
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static mock_endpoint_t mock_endpoints[] =
+{
+    { "geo",        MOCK_PORT_GEO,        mock_geo_body,        { 0, 0, 0, 0 }, -1 },
+    { "open-meteo", MOCK_PORT_OPEN_METEO, mock_open_meteo_body, { 0, 0, 0, 0 }, -1 },
+    { "wttr",       MOCK_PORT_WTTR,       mock_wttr_body,       { 0, 0, 0, 0 }, -1 },
+};
+
+static mock_sntp_profile_t mock_sntp_profile;
+static int mock_sntp_fd = -1;
+
+static pthread_mutex_t mock_log_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/*******************************************************************************
+ * Function Name: mock_header
+ *******************************************************************************
+ * Summary:
+ *  Finds a request header and returns its value, or NULL.
+ *
+ *******************************************************************************/
+static const char *mock_header(const char *request, const char *name, size_t *len)
+{
+    size_t name_len = strlen(name);
+    const char *line = strstr(request, "\r\n");
+
+    while ((NULL != line) && ('\r' != line[2]))
+    {
+        line += 2;
+        if ((0 == strncasecmp(line, name, name_len)) && (':' == line[name_len]))
+        {
+            const char *value = line + name_len + 1;
+            const char *eol = strstr(value, "\r\n");
+
+            while (' ' == *value)
+            {
+                value++;
+            }
+            *len = (size_t)(eol - value);
+            return value;
+        }
+        line = strstr(line, "\r\n");
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+ * Function Name: mock_delay_ms
+ *******************************************************************************
+ * Summary:
+ *  Picks the delay for the next answer from the endpoint's profile.
+ *
+ *******************************************************************************/
+static unsigned int mock_delay_ms(const mock_profile_t *profile, unsigned int *seed)
+{
+    if ((unsigned int)(rand_r(seed) % 100) < profile->slow_pct)
+    {
+        return profile->slow_ms;
+    }
+    return profile->delay_ms;
+}
+
+/*******************************************************************************
+ * Function Name: mock_answer
+ *******************************************************************************
+ * Summary:
+ *  Builds the response to one request: 503 when an error is injected, 304
+ *  when If-None-Match matches the current ETag, otherwise the body, or the
+ *  part of it a Range header asks for.
+ *
+ *******************************************************************************/
+static int mock_answer(const mock_endpoint_t *ep, const char *request, bool error,
+                       char *out, size_t size, int *status)
+{
+    char body[MOCK_BODY_MAX];
+    char date[64];
+    char etag[32];
+    time_t now = time(NULL);
+    struct tm tm;
+    const char *value;
+    size_t len;
+    int body_len;
+    unsigned long first = 0;
+    unsigned long last;
+
+    gmtime_r(&now, &tm);
+    strftime(date, sizeof(date), "%a, %d %b %Y %H:%M:%S GMT", &tm);
+
+    if (error)
+    {
+        *status = 503;
+        return snprintf(out, size, "HTTP/1.1 503 Service Unavailable\r\nDate: %s\r\n"
+                        "Content-Length: 0\r\nConnection: keep-alive\r\n\r\n", date);
+    }
+
+    body_len = ep->body(body, sizeof(body), now);
+    last = (unsigned long)body_len - 1UL;
+    snprintf(etag, sizeof(etag), "\"%08lx\"", (unsigned long)(now / 60));
+
+    value = mock_header(request, "If-None-Match", &len);
+    if ((NULL != value) && (len == strlen(etag)) && (0 == strncmp(value, etag, len)))
+    {
+        *status = 304;
+        return snprintf(out, size, "HTTP/1.1 304 Not Modified\r\nDate: %s\r\nETag: %s\r\n"
+                        "Cache-Control: max-age=60\r\nConnection: keep-alive\r\n\r\n", date, etag);
+    }
+
+    value = mock_header(request, "Range", &len);
+    if ((NULL != value) && (2 == sscanf(value, "bytes=%lu-%lu", &first, &last)) &&
+        (first < (unsigned long)body_len))
+    {
+        if (last >= (unsigned long)body_len)
+        {
+            last = (unsigned long)body_len - 1UL;
+        }
+        *status = 206;
+        return snprintf(out, size, "HTTP/1.1 206 Partial Content\r\nDate: %s\r\nETag: %s\r\n"
+                        "Cache-Control: max-age=60\r\nContent-Type: application/json\r\n"
+                        "Content-Range: bytes %lu-%lu/%d\r\nContent-Length: %lu\r\n"
+                        "Connection: keep-alive\r\n\r\n%.*s",
+                        date, etag, first, last, body_len, last - first + 1UL,
+                        (int)(last - first + 1UL), body + first);
+    }
+
+    *status = 200;
+    return snprintf(out, size, "HTTP/1.1 200 OK\r\nDate: %s\r\nETag: %s\r\nCache-Control: max-age=60\r\n"
+                    "Content-Type: application/json\r\nContent-Length: %d\r\n"
+                    "Connection: keep-alive\r\n\r\n%s", date, etag, body_len, body);
+}
+
+/*******************************************************************************
+ * Function Name: mock_connection
+ *******************************************************************************
+ * Summary:
+ *  Serves the requests of one keep-alive connection until the client closes
+ *  it.
+ *
+ *******************************************************************************/
+static void *mock_connection(void *arg)
+{
+    int fd = (int)(intptr_t)arg;
+    mock_endpoint_t *ep = NULL;
+    struct sockaddr_in local;
+    socklen_t local_len = sizeof(local);
+    char request[MOCK_REQUEST_MAX];
+    char response[MOCK_REQUEST_MAX];
+    size_t have = 0;
+    unsigned int seed = (unsigned int)time(NULL) ^ (unsigned int)fd;
+
+    getsockname(fd, (struct sockaddr *)&local, &local_len);
+    for (size_t i = 0; i < (sizeof(mock_endpoints) / sizeof(mock_endpoints[0])); i++)
+    {
+        if (mock_endpoints[i].port == ntohs(local.sin_port))
+        {
+            ep = &mock_endpoints[i];
+        }
+    }
+
+    while (NULL != ep)
+    {
+        char *end;
+        ssize_t n;
+        unsigned int delay_ms;
+        bool error;
+        int status;
+        int len;
+
+        request[have] = '\0';
+        end = strstr(request, "\r\n\r\n");
+        if (NULL == end)
+        {
+            n = recv(fd, request + have, sizeof(request) - 1U - have, 0);
+            if (n <= 0)
+            {
+                break;
+            }
+            have += (size_t)n;
+            continue;
+        }
+        end += 4;
+
+        delay_ms = mock_delay_ms(&ep->profile, &seed);
+        error = ((unsigned int)(rand_r(&seed) % 100) < ep->profile.error_pct);
+        usleep(delay_ms * 1000U);
+
+        len = mock_answer(ep, request, error, response, sizeof(response), &status);
+        if (send(fd, response, (size_t)len, MSG_NOSIGNAL) != len)
+        {
+            break;
+        }
+
+        pthread_mutex_lock(&mock_log_lock);
+        printf("%-10s %.*s -> %d after %u ms\n", ep->name,
+               (int)strcspn(request, "\r\n"), request, status, delay_ms);
+        fflush(stdout);
+        pthread_mutex_unlock(&mock_log_lock);
+
+        have -= (size_t)(end - request);
+        memmove(request, end, have);
+    }
+
+    close(fd);
+    return NULL;
+}
+
+/*******************************************************************************
+ * Function Name: mock_parse_profile
+ *******************************************************************************
+ * Summary:
+ *  Reads "delay[,slow,slow_pct[,error_pct]]".
+ *
+ *******************************************************************************/
+static int mock_parse_profile(const char *text, mock_profile_t *profile)
+{
+    int n = sscanf(text, "%u,%u,%u,%u", &profile->delay_ms, &profile->slow_ms,
+                   &profile->slow_pct, &profile->error_pct);
+
+    return ((1 == n) || (3 == n) || (4 == n)) ? 0 : -1;
+}
+
+/*******************************************************************************
+ * Function Name: mock_listen
+ *******************************************************************************
+ * Summary:
+ *  Opens the listening socket of an endpoint on all interfaces.
+ *
+ *******************************************************************************/
+static int mock_listen(mock_endpoint_t *ep)
+{
+    struct sockaddr_in addr;
+    int one = 1;
+
+    ep->listener = socket(AF_INET, SOCK_STREAM, 0);
+    if (ep->listener < 0)
+    {
+        return -1;
+    }
+    setsockopt(ep->listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons((uint16_t)ep->port);
+
+    if ((0 != bind(ep->listener, (struct sockaddr *)&addr, sizeof(addr))) ||
+        (0 != listen(ep->listener, 8)))
+    {
+        perror(ep->name);
+        return -1;
+    }
+    return 0;
+}
+
+/*******************************************************************************
+ * Function Name: mock_accept
+ *******************************************************************************
+ * Summary:
+ *  Accept loop of one endpoint; every connection gets its own thread so that
+ *  a delayed answer does not hold up the others.
+ *
+ *******************************************************************************/
+static void *mock_accept(void *arg)
+{
+    mock_endpoint_t *ep = (mock_endpoint_t *)arg;
+
+    while (true)
+    {
+        pthread_t thread;
+        int fd = accept(ep->listener, NULL, NULL);
+
+        if (fd < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            perror("accept");
+            break;
+        }
+
+        if (0 == pthread_create(&thread, NULL, mock_connection, (void *)(intptr_t)fd))
+        {
+            pthread_detach(thread);
+        }
+        else
+        {
+            close(fd);
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+ * Function Name: mock_ntp_stamp
+ *******************************************************************************
+ * Summary:
+ *  Writes the current time, off by the profile's clock error, as an NTP
+ *  timestamp.
+ *
+ *******************************************************************************/
+static void mock_ntp_stamp(uint8_t *p)
+{
+    struct timespec ts;
+    int64_t ns;
+    uint32_t seconds;
+    uint32_t fraction;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ns = ((int64_t)ts.tv_sec * 1000000000LL) + ts.tv_nsec + ((int64_t)mock_sntp_profile.offset_ms * 1000000LL);
+    seconds = (uint32_t)((uint64_t)(ns / 1000000000LL) + MOCK_NTP_UNIX_OFFSET_S);
+    fraction = (uint32_t)(((uint64_t)(ns % 1000000000LL) << 32) / 1000000000ULL);
+
+    for (int i = 0; i < 4; i++)
+    {
+        p[i] = (uint8_t)(seconds >> (24 - (8 * i)));
+        p[4 + i] = (uint8_t)(fraction >> (24 - (8 * i)));
+    }
+}
+
+/*******************************************************************************
+ * Function Name: mock_sntp
+ *******************************************************************************
+ * Summary:
+ *  Answers SNTP requests as a stratum 2 server. Half of the delay passes
+ *  before the receive time is taken and half after the transmit time, as a
+ *  network would add it.
+ *
+ *******************************************************************************/
+static void *mock_sntp(void *arg)
+{
+    (void)arg;
+
+    while (true)
+    {
+        uint8_t request[MOCK_SNTP_LEN];
+        uint8_t reply[MOCK_SNTP_LEN];
+        struct sockaddr_in from;
+        socklen_t from_len = sizeof(from);
+        ssize_t n = recvfrom(mock_sntp_fd, request, sizeof(request), 0, (struct sockaddr *)&from, &from_len);
+
+        if (n < MOCK_SNTP_LEN)
+        {
+            continue;
+        }
+
+        usleep(mock_sntp_profile.delay_ms * 500U);
+
+        memset(reply, 0, sizeof(reply));
+        reply[0] = (uint8_t)((request[0] & 0x38U) | 4U);    /* LI 0, client's version, server */
+        reply[1] = 2;                                       /* stratum */
+        reply[2] = request[2];                              /* poll */
+        reply[3] = 0xEC;                                    /* precision 2^-20 s */
+        memcpy(&reply[12], "MOCK", 4);                      /* reference ID */
+        mock_ntp_stamp(&reply[32]);                         /* receive */
+        memcpy(&reply[16], &reply[32], 8);                  /* reference */
+        memcpy(&reply[24], &request[40], 8);                /* originate */
+        mock_ntp_stamp(&reply[40]);                         /* transmit */
+
+        usleep(mock_sntp_profile.delay_ms * 500U);
+        sendto(mock_sntp_fd, reply, sizeof(reply), 0, (struct sockaddr *)&from, from_len);
+
+        pthread_mutex_lock(&mock_log_lock);
+        printf("%-10s request -> offset %+ld ms after %u ms\n", "sntp",
+               mock_sntp_profile.offset_ms, mock_sntp_profile.delay_ms);
+        fflush(stdout);
+        pthread_mutex_unlock(&mock_log_lock);
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+ * Function Name: mock_sntp_open
+ *******************************************************************************
+ * Summary:
+ *  Opens the UDP socket of the SNTP stand-in on all interfaces.
+ *
+ *******************************************************************************/
+static int mock_sntp_open(void)
+{
+    struct sockaddr_in addr;
+
+    mock_sntp_fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (mock_sntp_fd < 0)
+    {
+        return -1;
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(MOCK_PORT_SNTP);
+
+    if (0 != bind(mock_sntp_fd, (struct sockaddr *)&addr, sizeof(addr)))
+    {
+        perror("sntp");
+        return -1;
+    }
+    return 0;
+}
+
+/*******************************************************************************
+ * Function Name: main
+ ******************************************************************************/
+int main(int argc, char **argv)
+{
+    pthread_t threads[sizeof(mock_endpoints) / sizeof(mock_endpoints[0])];
+    pthread_t sntp_thread;
+    int opt;
+
+    while (-1 != (opt = getopt(argc, argv, "g:m:w:s:")))
+    {
+        mock_profile_t *profile = ('g' == opt) ? &mock_endpoints[0].profile :
+                                  ('m' == opt) ? &mock_endpoints[1].profile : &mock_endpoints[2].profile;
+        bool bad;
+
+        if ('s' == opt)
+        {
+            int n = sscanf(optarg, "%ld,%u", &mock_sntp_profile.offset_ms, &mock_sntp_profile.delay_ms);
+            bad = (n < 1);
+        }
+        else
+        {
+            bad = ('?' == opt) || (0 != mock_parse_profile(optarg, profile));
+        }
+
+        if (bad)
+        {
+            fprintf(stderr,
+                    "usage: %s [-g PROFILE] [-m PROFILE] [-w PROFILE] [-s offset_ms[,delay_ms]]\n"
+                    "  -g  ipinfo.io stand-in on port %d\n"
+                    "  -m  Open-Meteo stand-in on port %d\n"
+                    "  -w  wttr.in stand-in on port %d\n"
+                    "  -s  SNTP server on UDP port %d, its clock off by offset_ms\n"
+                    "PROFILE is delay_ms[,slow_ms,slow_percent[,error_percent]]\n",
+                    argv[0], MOCK_PORT_GEO, MOCK_PORT_OPEN_METEO, MOCK_PORT_WTTR, MOCK_PORT_SNTP);
+            return 2;
+        }
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+
+    for (size_t i = 0; i < (sizeof(mock_endpoints) / sizeof(mock_endpoints[0])); i++)
+    {
+        mock_endpoint_t *ep = &mock_endpoints[i];
+
+        if (0 != mock_listen(ep))
+        {
+            return 1;
+        }
+        printf("%-10s port %d: %u ms, %u%% at %u ms, %u%% errors\n", ep->name, ep->port,
+               ep->profile.delay_ms, ep->profile.slow_pct, ep->profile.slow_ms, ep->profile.error_pct);
+        pthread_create(&threads[i], NULL, mock_accept, ep);
+    }
+
+    if (0 != mock_sntp_open())
+    {
+        return 1;
+    }
+    printf("%-10s port %d: clock %+ld ms, %u ms round trip\n", "sntp", MOCK_PORT_SNTP,
+           mock_sntp_profile.offset_ms, mock_sntp_profile.delay_ms);
+    pthread_create(&sntp_thread, NULL, mock_sntp, NULL);
+
+    for (size_t i = 0; i < (sizeof(mock_endpoints) / sizeof(mock_endpoints[0])); i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    return 0;
+}
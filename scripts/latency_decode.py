@@ -0,0 +1,75 @@
+# Python script to decode the "LATBIN" latency histogram records printed by the
+# board's "latbin" console command (see source/latency_hist.c).
+#
+# Usage:
+#   python latency_decode.py <one-or-more-uart-log-files>
+#   python latency_decode.py < uart.log
+#
+# Every LATBIN line found is checked and printed as one table per record.
+#
+import struct
+import sys
+
+PHASES = ["dns", "connect", "tls", "ttfb", "body", "parse"]
+
+#CRC-16/CCITT-FALSE, as computed by latency_hist_crc16()
+def crc16(data):
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if (crc & 0x8000) else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+#Returns the upper bound in us of the bucket holding the given percentile
+def percentile(buckets, count, max_us, first_log2, percent):
+    rank = (count * percent + 99) // 100
+    seen = 0
+    for b, n in enumerate(buckets[:-1]):
+        seen += n
+        if seen >= rank:
+            return min(1 << (b + first_log2), max_us)
+    return max_us
+
+def decode(record):
+    if len(record) < 14 or record[0:2] != b"LH" or record[2] != 1:
+        print("Not a version 1 latency record")
+        return
+    if crc16(record[:-2]) != struct.unpack_from("<H", record, len(record) - 2)[0]:
+        print("CRC mismatch, record dropped")
+        return
+
+    phases, buckets, first_log2 = record[3], record[4], record[5]
+    uptime = struct.unpack_from("<I", record, 8)[0]
+    print("Uptime %u s" % uptime)
+    print("phase      count   avg ms  p50<= us  p95<= us    max us")
+
+    offset = 12
+    for p in range(phases):
+        count, sum_ms, max_us = struct.unpack_from("<III", record, offset)
+        counts = struct.unpack_from("<%dH" % buckets, record, offset + 12)
+        offset += 12 + 2 * buckets
+        name = PHASES[p] if p < len(PHASES) else str(p)
+        print("%-8s %7u %8u %9u %9u %9u" % (name, count, sum_ms // count if count else 0,
+              percentile(counts, count, max_us, first_log2, 50),
+              percentile(counts, count, max_us, first_log2, 95), max_us))
+        if count:
+            print("         " + " ".join(str(n) for n in counts))
+
+def scan(lines):
+    for line in lines:
+        at = line.find("LATBIN ")
+        if at >= 0:
+            decode(bytes.fromhex(line[at + 7:].strip()))
+            print("")
+
+#Main function. Execution starts here
+if __name__ == '__main__':
+
+    if len(sys.argv) > 1:
+        for arg in sys.argv[1:]:
+            with open(arg, 'r', errors='replace') as fd:
+                scan(fd)
+    else:
+        scan(sys.stdin)
@@ -0,0 +1,72 @@
+# Python script to convert the PEM trust anchor into a DER byte array in a C
+# source file, so the board parses the binary certificate once at boot instead
+# of decoding PEM text. Run by the PREBUILD step of the Makefile; the output is
+# only rewritten when it changes.
+#
+# Usage:
+#   python trust_anchor_der.py <certificate.pem> <output.c>
+#
+# Example:
+#   python trust_anchor_der.py configs/trust_anchor.pem source/trust_anchor.c
+#
+import base64
+import os
+import sys
+
+BEGIN = "-----BEGIN CERTIFICATE-----"
+END = "-----END CERTIFICATE-----"
+
+#Returns the DER bytes of every certificate in a PEM file
+def read_pem(path):
+    certs = []
+    body = None
+    with open(path, 'r') as fd:
+        for line in fd.read().splitlines():
+            line = line.strip()
+            if line == BEGIN:
+                body = []
+            elif line == END and body is not None:
+                certs.append(base64.b64decode("".join(body)))
+                body = None
+            elif body is not None:
+                body.append(line)
+    return certs
+
+def render(der, source):
+    lines = ["/* Generated by scripts/trust_anchor_der.py from %s. Do not edit. */" % source,
+             "",
+             "#include \"trust_anchor.h\"",
+             "",
+             "/* Spare zero byte in case the loader counts a string terminator. */",
+             "const uint8_t trust_anchor_der[%d] =" % (len(der) + 1),
+             "{"]
+    data = list(der) + [0]
+    for i in range(0, len(data), 12):
+        lines.append("    " + " ".join("0x%02X," % b for b in data[i:i + 12]))
+    lines += ["};",
+              "",
+              "const uint32_t trust_anchor_der_len = %uU;" % len(der),
+              ""]
+    return "\n".join(lines)
+
+#Main function. Execution starts here
+if __name__ == '__main__':
+
+    if len(sys.argv) != 3:
+        print("Usage: python trust_anchor_der.py <certificate.pem> <output.c>")
+        sys.exit(1)
+
+    certs = read_pem(sys.argv[1])
+    if len(certs) != 1:
+        #mbedTLS parses one certificate per DER buffer
+        print("%s must hold exactly one certificate, found %d" % (sys.argv[1], len(certs)))
+        sys.exit(1)
+
+    text = render(certs[0], sys.argv[1].replace(os.sep, "/"))
+    if os.path.exists(sys.argv[2]):
+        with open(sys.argv[2], 'r') as fd:
+            if fd.read() == text:
+                sys.exit(0)
+    with open(sys.argv[2], 'w') as fd:
+        fd.write(text)
+    print("Wrote %s: %d byte trust anchor" % (sys.argv[2], len(certs[0])))
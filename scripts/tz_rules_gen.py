@@ -0,0 +1,200 @@
+# Python script to compile a list of IANA time zones into constant tables in a
+# C source file: for each zone, the UTC instants at which its offset changes
+# and the offset in force after each change. The board then finds the local
+# offset by bisection instead of evaluating DST rules. Zones with the same
+# changes over the covered years share one run of the table.
+#
+# The offsets come from the host tz database through the Python zoneinfo
+# module (Python 3.9 or later; install the tzdata package where the host has
+# no zoneinfo directory). Run by hand after editing the zone list or updating
+# the tz database; the output is only rewritten when it changes.
+#
+# With --check it only compares the zones in the output with the zone list
+# and fails if they differ. The PREBUILD step of the Makefile runs it that
+# way, so a zone list edited without regenerating the tables stops the
+# build, while the tables do not change with the host's tz database.
+#
+# Usage:
+#   python tz_rules_gen.py <zones.txt> <output.c> [first_year]
+#   python tz_rules_gen.py --check <zones.txt> <output.c>
+#
+# Example:
+#   python tz_rules_gen.py configs/tz_zones.txt source/tz_rules_data.c
+#
+import os
+import re
+import sys
+from datetime import datetime, timezone
+
+#Transitions before this year fold into the starting offset of each zone
+DEFAULT_FIRST_YEAR = 2020
+#Seconds since 1970 are unsigned 32-bit on the board
+LAST_INSTANT = 0xFFFFFFFF
+DAY = 86400
+
+def read_zones(path):
+    zones = []
+    with open(path, 'r') as fd:
+        for line in fd.read().splitlines():
+            line = line.strip()
+            if line and not line.startswith('#'):
+                zones.append(line)
+    return sorted(set(zones))
+
+def tz_version():
+    for base in zoneinfo.TZPATH:
+        try:
+            with open(os.path.join(base, "tzdata.zi"), 'r') as fd:
+                first = fd.readline().split()
+                if len(first) == 3 and first[1] == "version":
+                    return first[2]
+        except OSError:
+            pass
+    try:
+        import tzdata
+        return tzdata.IANA_VERSION
+    except (ImportError, AttributeError):
+        return "unknown"
+
+def offset_at(zone, instant):
+    return int(datetime.fromtimestamp(instant, zone).utcoffset().total_seconds())
+
+#Returns the starting offset and the (instant, offset) changes of a zone,
+#scanning a day at a time and bisecting each day that changes offset
+def compile_zone(name, first_year):
+    zone = zoneinfo.ZoneInfo(name)
+    start = int(datetime(first_year, 1, 1, tzinfo=timezone.utc).timestamp())
+    initial = offset_at(zone, start)
+    changes = []
+    current = initial
+    day = start
+    while day < LAST_INSTANT:
+        end = min(day + DAY, LAST_INSTANT)
+        if offset_at(zone, end) != current:
+            lo, hi = day, end
+            while hi - lo > 1:
+                mid = (lo + hi) // 2
+                if offset_at(zone, mid) == current:
+                    lo = mid
+                else:
+                    hi = mid
+            current = offset_at(zone, hi)
+            changes.append((hi, current))
+            continue
+        day = end
+    return initial, changes
+
+def render(zones, compiled, first_year, source):
+    offsets = sorted({o for initial, changes in compiled.values()
+                      for o in [initial] + [c[1] for c in changes]})
+    index = {o: i for i, o in enumerate(offsets)}
+    runs = {}
+    instants = []
+    kinds = []
+    entries = []
+    for name in zones:
+        initial, changes = compiled[name]
+        key = tuple(changes)
+        if key not in runs:
+            runs[key] = len(instants)
+            instants += [c[0] for c in changes]
+            kinds += [index[c[1]] for c in changes]
+        entries.append((name, runs[key], len(changes), index[initial]))
+
+    if len(instants) > 0xFFFF or len(offsets) > 0xFF:
+        print("Too many transitions (%d) or offsets (%d) for the table"
+              % (len(instants), len(offsets)))
+        sys.exit(1)
+
+    lines = ["/* Generated by scripts/tz_rules_gen.py from %s. Do not edit. */" % source,
+             "/* tz database %s, changes from %d on. */" % (tz_version(), first_year),
+             "",
+             "#include \"tz_rules.h\"",
+             "",
+             "/* Offsets east of UTC, in seconds. */",
+             "const int32_t tz_rules_offsets[%d] =" % len(offsets),
+             "{"]
+    for i in range(0, len(offsets), 8):
+        lines.append("    " + " ".join("%d," % o for o in offsets[i:i + 8]))
+    lines += ["};",
+              "",
+              "/* UTC instants at which a zone changes offset, one ascending run per zone. */",
+              "const uint32_t tz_rules_instants[%d] =" % max(len(instants), 1),
+              "{"]
+    for i in range(0, len(instants), 6):
+        lines.append("    " + " ".join("%uU," % t for t in instants[i:i + 6]))
+    if not instants:
+        lines.append("    0U,")
+    lines += ["};",
+              "",
+              "/* Index into tz_rules_offsets of the offset in force from each instant. */",
+              "const uint8_t tz_rules_kinds[%d] =" % max(len(kinds), 1),
+              "{"]
+    for i in range(0, len(kinds), 16):
+        lines.append("    " + " ".join("%u," % k for k in kinds[i:i + 16]))
+    if not kinds:
+        lines.append("    0,")
+    lines += ["};",
+              "",
+              "/* Sorted by name for bisection: name, first instant, instant count,",
+              " * offset before the first instant. */",
+              "const tz_zone_t tz_rules_zones[%d] =" % len(entries),
+              "{"]
+    for name, first, count, initial in entries:
+        lines.append("    { \"%s\", %u, %u, %u }," % (name, first, count, initial))
+    lines += ["};",
+              "",
+              "const uint32_t tz_rules_zone_count = %uU;" % len(entries),
+              ""]
+    return "\n".join(lines), len(instants)
+
+#Returns the zone names in a generated file, or None if it cannot be read
+def generated_zones(path):
+    try:
+        with open(path, 'r') as fd:
+            text = fd.read()
+    except OSError:
+        return None
+    return re.findall(r'^    \{ "([^"]+)",', text, re.MULTILINE)
+
+#Exits with an error if the generated tables do not cover the zone list
+def check(zones_path, output_path):
+    zones = read_zones(zones_path)
+    generated = generated_zones(output_path)
+    if generated != zones:
+        print("%s is out of date with %s: run" % (output_path, zones_path))
+        print("  python scripts/tz_rules_gen.py %s %s" % (zones_path, output_path))
+        sys.exit(1)
+
+#Main function. Execution starts here
+if __name__ == '__main__':
+
+    if len(sys.argv) == 4 and sys.argv[1] == "--check":
+        check(sys.argv[2], sys.argv[3])
+        sys.exit(0)
+
+    if len(sys.argv) not in (3, 4):
+        print("Usage: python tz_rules_gen.py <zones.txt> <output.c> [first_year]")
+        print("       python tz_rules_gen.py --check <zones.txt> <output.c>")
+        sys.exit(1)
+
+    import zoneinfo
+
+    first_year = int(sys.argv[3]) if len(sys.argv) == 4 else DEFAULT_FIRST_YEAR
+    zones = read_zones(sys.argv[1])
+    compiled = {}
+    for name in zones:
+        try:
+            compiled[name] = compile_zone(name, first_year)
+        except zoneinfo.ZoneInfoNotFoundError:
+            print("%s: unknown time zone %s" % (sys.argv[1], name))
+            sys.exit(1)
+
+    text, count = render(zones, compiled, first_year, sys.argv[1].replace(os.sep, "/"))
+    if os.path.exists(sys.argv[2]):
+        with open(sys.argv[2], 'r') as fd:
+            if fd.read() == text:
+                sys.exit(0)
+    with open(sys.argv[2], 'w') as fd:
+        fd.write(text)
+    print("Wrote %s: %d zones, %d transitions" % (sys.argv[2], len(zones), count))
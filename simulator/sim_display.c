@@ -0,0 +1,319 @@
+/******************************************************************************
+*
+* File Name: sim_display.c
+*
+* Description: This file contains a headless display driver for the desktop
+* simulator. It renders into a 320x240 RGB565 memory framebuffer through the
+* same two 10-line draw buffers as the target and writes frames out as PNG
+* files.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "lvgl.h"
+#include "lvgl_support.h"
+#include "sim_display.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define PNG_BYTES_PER_PIXEL     (3u)
+#define PNG_ROW_BYTES           (1u + (DISP_HOR_RES * PNG_BYTES_PER_PIXEL))
+#define DEFLATE_STORED_MAX      (65535u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static lv_disp_drv_t disp_drv;
+
+static lv_color_t disp_buf1[DISP_BUF_SIZE];
+static lv_color_t disp_buf2[DISP_BUF_SIZE];
+
+/* What the panel would show. */
+static lv_color_t sim_fb[DISP_HOR_RES * DISP_VER_RES];
+
+static sim_display_stats_t sim_stats;
+
+static uint32_t crc_table[256];
+
+/*******************************************************************************
+* Function Name: void flush_cb(...)
+********************************************************************************
+*
+* Summary: Copies the rendered band into the framebuffer, row by row.
+*
+*******************************************************************************/
+static void flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    lv_coord_t w = lv_area_get_width(area);
+
+    for(lv_coord_t y = area->y1; y <= area->y2; y++)
+    {
+        memcpy(&sim_fb[(y * DISP_HOR_RES) + area->x1], color_p, w * sizeof(lv_color_t));
+        color_p += w;
+    }
+
+    sim_stats.flushes++;
+    lv_disp_flush_ready(drv);
+}
+
+/*******************************************************************************
+* Function Name: void monitor_cb(lv_disp_drv_t * drv, uint32_t time, uint32_t px)
+********************************************************************************
+*
+* Summary: Called by LVGL after every refresh that drew something.
+*
+*******************************************************************************/
+static void monitor_cb(lv_disp_drv_t * drv, uint32_t time, uint32_t px)
+{
+    (void)drv;
+    (void)time;
+
+    sim_stats.frames++;
+    sim_stats.pixels += px;
+}
+
+/*******************************************************************************
+* Function Name: void sim_display_init(void)
+********************************************************************************
+*
+* Summary: Registers the framebuffer display driver with the same geometry and
+*          draw buffers as lv_port_disp_init() on the target.
+*
+*******************************************************************************/
+void sim_display_init(void)
+{
+    static lv_disp_draw_buf_t buf;
+
+    lv_disp_draw_buf_init(&buf, disp_buf1, disp_buf2, DISP_BUF_SIZE);
+
+    lv_disp_drv_init(&disp_drv);
+
+    disp_drv.draw_buf = &buf;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.monitor_cb = monitor_cb;
+    disp_drv.hor_res = DISP_HOR_RES;
+    disp_drv.ver_res = DISP_VER_RES;
+    lv_disp_drv_register(&disp_drv);
+}
+
+/*******************************************************************************
+* Function Name: uint64_t sim_now_ns(void)
+*******************************************************************************/
+uint64_t sim_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000u) + (uint64_t)ts.tv_nsec;
+}
+
+/*******************************************************************************
+* Function Name: void sim_display_run(uint32_t ms, uint32_t step_ms)
+********************************************************************************
+*
+* Summary: Advances LVGL time by ms in steps of step_ms, running the timer
+*          handler at every step. Time is simulated, so the rendered frames do
+*          not depend on how fast the host is.
+*
+*******************************************************************************/
+void sim_display_run(uint32_t ms, uint32_t step_ms)
+{
+    for(uint32_t t = 0; t < ms; t += step_ms)
+    {
+        uint64_t start = sim_now_ns();
+        lv_timer_handler();
+        uint64_t spent = sim_now_ns() - start;
+
+        sim_stats.render_ns += spent;
+        if(spent > sim_stats.max_frame_ns)
+        {
+            sim_stats.max_frame_ns = spent;
+        }
+
+        lv_tick_inc(step_ms);
+    }
+}
+
+void sim_display_get_stats(sim_display_stats_t *stats)
+{
+    *stats = sim_stats;
+}
+
+void sim_display_reset_stats(void)
+{
+    memset(&sim_stats, 0, sizeof(sim_stats));
+}
+
+/*******************************************************************************
+ * PNG output
+ ********************************************************************************/
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+    if(0u == crc_table[1])
+    {
+        for(uint32_t n = 0; n < 256u; n++)
+        {
+            uint32_t c = n;
+            for(int k = 0; k < 8; k++)
+            {
+                c = (c & 1u) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+            }
+            crc_table[n] = c;
+        }
+    }
+
+    crc = ~crc;
+    while(len--)
+    {
+        crc = crc_table[(crc ^ *data++) & 0xFFu] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+static void put_be32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static void write_chunk(FILE *f, const char *type, const uint8_t *data, uint32_t len)
+{
+    uint8_t be[4];
+
+    put_be32(be, len);
+    fwrite(be, 1, 4, f);
+    fwrite(type, 1, 4, f);
+    if(len > 0u)
+    {
+        fwrite(data, 1, len, f);
+    }
+
+    uint32_t crc = crc32_update(0, (const uint8_t *)type, 4);
+    crc = crc32_update(crc, data, len);
+    put_be32(be, crc);
+    fwrite(be, 1, 4, f);
+}
+
+/*******************************************************************************
+* Function Name: int sim_display_write_png(const char *path)
+********************************************************************************
+*
+* Summary: Writes the framebuffer as an 8-bit RGB PNG. The image data is
+*          stored with uncompressed deflate blocks, which keeps the output
+*          byte-for-byte reproducible without a zlib dependency.
+*
+* Return:
+*  0 on success, -1 if the file could not be written
+*
+*******************************************************************************/
+int sim_display_write_png(const char *path)
+{
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    static uint8_t raw[PNG_ROW_BYTES * DISP_VER_RES];
+    static uint8_t idat[2u + sizeof(raw) + (5u * ((sizeof(raw) / DEFLATE_STORED_MAX) + 1u)) + 4u];
+    uint8_t ihdr[13];
+    uint8_t *p = raw;
+
+    for(uint32_t y = 0; y < DISP_VER_RES; y++)
+    {
+        *p++ = 0;   /* filter type: none */
+        for(uint32_t x = 0; x < DISP_HOR_RES; x++)
+        {
+            lv_color_t c = sim_fb[(y * DISP_HOR_RES) + x];
+            *p++ = (uint8_t)((c.ch.red << 3) | (c.ch.red >> 2));
+            *p++ = (uint8_t)((c.ch.green << 2) | (c.ch.green >> 4));
+            *p++ = (uint8_t)((c.ch.blue << 3) | (c.ch.blue >> 2));
+        }
+    }
+
+    /* zlib stream of stored blocks with an Adler-32 trailer. */
+    uint32_t a = 1u;
+    uint32_t b = 0u;
+    size_t n = 0;
+    idat[n++] = 0x78;
+    idat[n++] = 0x01;
+    for(size_t off = 0; off < sizeof(raw); off += DEFLATE_STORED_MAX)
+    {
+        uint32_t len = (uint32_t)LV_MIN(sizeof(raw) - off, DEFLATE_STORED_MAX);
+
+        idat[n++] = ((off + len) == sizeof(raw)) ? 1u : 0u;
+        idat[n++] = (uint8_t)len;
+        idat[n++] = (uint8_t)(len >> 8);
+        idat[n++] = (uint8_t)~len;
+        idat[n++] = (uint8_t)(~len >> 8);
+        memcpy(&idat[n], &raw[off], len);
+        n += len;
+
+        for(uint32_t i = 0; i < len; i++)
+        {
+            a = (a + raw[off + i]) % 65521u;
+            b = (b + a) % 65521u;
+        }
+    }
+    put_be32(&idat[n], (b << 16) | a);
+    n += 4;
+
+    put_be32(&ihdr[0], DISP_HOR_RES);
+    put_be32(&ihdr[4], DISP_VER_RES);
+    ihdr[8] = 8;    /* bit depth */
+    ihdr[9] = 2;    /* colour type: RGB */
+    ihdr[10] = 0;
+    ihdr[11] = 0;
+    ihdr[12] = 0;
+
+    FILE *f = fopen(path, "wb");
+    if(NULL == f)
+    {
+        return -1;
+    }
+
+    fwrite(signature, 1, sizeof(signature), f);
+    write_chunk(f, "IHDR", ihdr, sizeof(ihdr));
+    write_chunk(f, "IDAT", idat, (uint32_t)n);
+    write_chunk(f, "IEND", NULL, 0);
+
+    return (0 == fclose(f)) ? 0 : -1;
+}
+
+/* [] END OF FILE */
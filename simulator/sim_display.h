@@ -0,0 +1,78 @@
+/******************************************************************************
+*
+* File Name: sim_display.h
+*
+* Description: This file is the public interface of sim_display.c source file
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include guard
+ ******************************************************************************/
+#ifndef SIM_DISPLAY_H_
+#define SIM_DISPLAY_H_
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdint.h>
+#include "lvgl.h"
+
+/*******************************************************************************
+ * Data structure and enumeration
+ ******************************************************************************/
+typedef struct
+{
+    uint32_t frames;            /* refresh cycles that drew something */
+    uint32_t flushes;           /* flush_cb calls (bands) */
+    uint64_t pixels;            /* pixels rendered */
+    uint64_t render_ns;         /* time spent in lv_timer_handler() */
+    uint64_t max_frame_ns;      /* slowest single handler call */
+} sim_display_stats_t;
+
+/*******************************************************************************
+ * Function prototype
+ ******************************************************************************/
+void sim_display_init(void);
+uint64_t sim_now_ns(void);
+void sim_display_run(uint32_t ms, uint32_t step_ms);
+int sim_display_write_png(const char *path);
+void sim_display_get_stats(sim_display_stats_t *stats);
+void sim_display_reset_stats(void);
+
+#endif /* SIM_DISPLAY_H_ */
+
+/* [] END OF FILE */
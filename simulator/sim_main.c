@@ -0,0 +1,300 @@
+/******************************************************************************
+*
+* File Name: sim_main.c
+*
+* Description: Entry point of the desktop simulator. It builds the dashboard
+* from UI_Files/ on the headless display driver, replays a boot, a weather
+* sync and a clock sync, dumps a PNG after each step and prints render cost
+* per frame, per object and per label update, and for an hour of the clock.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lvgl.h"
+#include "ui.h"
+#include "ui_sync.h"
+#include "civil_time.h"
+#include "timekeeper.h"
+#include "sim_display.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SIM_STEP_MS             (5u)
+#define SIM_SETTLE_MS           (500u)
+#define SIM_HOUR_MS             (3600u * 1000u)
+#define SIM_DATE                "Mon, 22 Jan 2024 10:15:00 GMT"
+
+#define PROFILE_OBJ(o)          { #o, &(o), 0, 0, 0 }
+
+/*******************************************************************************
+ * Data structure and enumeration
+ ******************************************************************************/
+typedef struct
+{
+    const char *name;
+    lv_obj_t **obj;
+    uint64_t start;
+    uint64_t ns;
+    uint32_t draws;
+} obj_profile_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static obj_profile_t obj_profile[] =
+{
+    PROFILE_OBJ(ui_DashBoardScreen), PROFILE_OBJ(ui_TopBar),
+    PROFILE_OBJ(ui_Welcome),         PROFILE_OBJ(ui_WiFiIcon),
+    PROFILE_OBJ(ui_LeftBar),         PROFILE_OBJ(ui_RightBar),
+    PROFILE_OBJ(ui_HHH),             PROFILE_OBJ(ui_MMM),
+    PROFILE_OBJ(ui_Dot),             PROFILE_OBJ(ui_Month),
+    PROFILE_OBJ(ui_Date),            PROFILE_OBJ(ui_Vaar),
+    PROFILE_OBJ(ui_Coma),            PROFILE_OBJ(ui_TemperatureIcon),
+    PROFILE_OBJ(ui_HumidityIcon),    PROFILE_OBJ(ui_WindIcon),
+    PROFILE_OBJ(ui_RainIcon),        PROFILE_OBJ(ui_Temperature),
+    PROFILE_OBJ(ui_Humidity),        PROFILE_OBJ(ui_WindSpeed),
+    PROFILE_OBJ(ui_Rain),            PROFILE_OBJ(ui_BottomBar),
+    PROFILE_OBJ(ui_Location),        PROFILE_OBJ(ui_SmartHomeIcon),
+};
+
+#define OBJ_PROFILE_COUNT       (sizeof(obj_profile) / sizeof(obj_profile[0]))
+
+/* Stand-in for the RTC timekeeper: SIM_DATE, advanced by the LVGL tick. */
+static uint32_t sim_utc;
+static uint32_t sim_utc_tick;
+
+/*******************************************************************************
+* Function Name: bool timekeeper_valid(void)
+********************************************************************************
+*
+* Summary: Timekeeper read used by the clock; valid once SIM_DATE is set.
+*
+*******************************************************************************/
+bool timekeeper_valid(void)
+{
+    return 0u != sim_utc;
+}
+
+/*******************************************************************************
+* Function Name: uint32_t timekeeper_now(void)
+********************************************************************************
+*
+* Summary: UTC seconds, counted on simulated time so frames are repeatable.
+*
+*******************************************************************************/
+uint32_t timekeeper_now(void)
+{
+    return sim_utc + (lv_tick_elaps(sim_utc_tick) / 1000u);
+}
+
+/*******************************************************************************
+* Function Name: uint64_t timekeeper_now_ms(void)
+********************************************************************************
+*
+* Summary: Same time as timekeeper_now(), in milliseconds.
+*
+*******************************************************************************/
+uint64_t timekeeper_now_ms(void)
+{
+    return ((uint64_t)sim_utc * 1000u) + lv_tick_elaps(sim_utc_tick);
+}
+
+/*******************************************************************************
+* Function Name: void draw_event_cb(lv_event_t * e)
+********************************************************************************
+*
+* Summary: Times the object's own drawing, from DRAW_MAIN_BEGIN to
+*          DRAW_MAIN_END. Children are drawn after DRAW_MAIN_END, so they
+*          are not included.
+*
+*******************************************************************************/
+static void draw_event_cb(lv_event_t * e)
+{
+    obj_profile_t *p = lv_event_get_user_data(e);
+
+    if(LV_EVENT_DRAW_MAIN_BEGIN == lv_event_get_code(e))
+    {
+        p->start = sim_now_ns();
+    }
+    else
+    {
+        p->ns += sim_now_ns() - p->start;
+        p->draws++;
+    }
+}
+
+static void attach_profilers(void)
+{
+    for(uint32_t i = 0; i < OBJ_PROFILE_COUNT; i++)
+    {
+        lv_obj_add_event_cb(*obj_profile[i].obj, draw_event_cb,
+                            LV_EVENT_DRAW_MAIN_BEGIN, &obj_profile[i]);
+        lv_obj_add_event_cb(*obj_profile[i].obj, draw_event_cb,
+                            LV_EVENT_DRAW_MAIN_END, &obj_profile[i]);
+    }
+}
+
+static void print_frame_stats(const char *step)
+{
+    sim_display_stats_t s;
+
+    sim_display_get_stats(&s);
+    printf("%-10s frames %4lu  bands %5lu  px %8llu  handler %8.1f us (max %8.1f us)\n",
+           step, (unsigned long)s.frames, (unsigned long)s.flushes,
+           (unsigned long long)s.pixels, (double)s.render_ns / 1000.0,
+           (double)s.max_frame_ns / 1000.0);
+    sim_display_reset_stats();
+}
+
+static void dump_frame(const char *out_dir, const char *name)
+{
+    char path[256];
+
+    snprintf(path, sizeof(path), "%s/%s.png", out_dir, name);
+    if(0 != sim_display_write_png(path))
+    {
+        fprintf(stderr, "Failed to write %s\n", path);
+        exit(EXIT_FAILURE);
+    }
+}
+
+/*******************************************************************************
+* Function Name: void profile_label_update(const char *name, ui_field_t field, const char *text)
+********************************************************************************
+*
+* Summary: Times one field update through the binding layer and the refresh
+*          that follows it.
+*
+*******************************************************************************/
+static void profile_label_update(const char *name, ui_field_t field, const char *text)
+{
+    sim_display_stats_t s;
+
+    sim_display_reset_stats();
+    uint64_t start = sim_now_ns();
+    ui_sync_set_field(field, text, strlen(text));
+    ui_sync_apply();
+    uint64_t set_ns = sim_now_ns() - start;
+
+    sim_display_run(LV_DISP_DEF_REFR_PERIOD, SIM_STEP_MS);
+    sim_display_get_stats(&s);
+
+    printf("  %-12s set %7.1f us  redraw %8.1f us  px %6llu\n", name,
+           (double)set_ns / 1000.0, (double)s.render_ns / 1000.0,
+           (unsigned long long)s.pixels);
+}
+
+/*******************************************************************************
+* Function Name: int main(int argc, char **argv)
+********************************************************************************
+*
+* Summary: Usage: sim [output directory]. Frames are written as boot.png,
+*          weather.png and clock.png.
+*
+*******************************************************************************/
+int main(int argc, char **argv)
+{
+    const char *out_dir = (argc > 1) ? argv[1] : "out";
+
+    lv_init();
+    sim_display_init();
+    ui_init();
+    attach_profilers();
+    ui_sync_clock_start();
+
+    printf("Render cost per step\n");
+    sim_display_run(SIM_SETTLE_MS, SIM_STEP_MS);
+    print_frame_stats("boot");
+    dump_frame(out_dir, "boot");
+
+    printf("\nRender cost per label update\n");
+    profile_label_update("temperature", UI_FIELD_TEMPERATURE, "24.6");
+    profile_label_update("humidity", UI_FIELD_HUMIDITY, "71");
+    profile_label_update("windspeed", UI_FIELD_WINDSPEED, "9.4");
+    profile_label_update("rain", UI_FIELD_RAIN, "Y");
+    profile_label_update("location", UI_FIELD_LOCATION, "Bengaluru");
+    profile_label_update("unchanged", UI_FIELD_TEMPERATURE, "24.6");
+
+    sim_display_reset_stats();
+    sim_display_run(SIM_SETTLE_MS, SIM_STEP_MS);
+    print_frame_stats("weather");
+    dump_frame(out_dir, "weather");
+
+    /* Same path as a completed fetch: publish a snapshot, let the TFT side
+     * pick it up. */
+    static weather_state_t state =
+    {
+        .city = "Bengaluru", .timezone = "Asia/Kolkata",
+        .temperature = "24.6", .humidity = "71",
+        .windspeed = "9.4", .weather_code = 61, .date = SIM_DATE,
+    };
+    (void)civil_time_parse_http_date(SIM_DATE, &sim_utc);
+    sim_utc_tick = lv_tick_get();
+    weather_state_publish(&state);
+    sync_all_data();
+    sim_display_run(SIM_SETTLE_MS, SIM_STEP_MS);
+    print_frame_stats("clock");
+    dump_frame(out_dir, "clock");
+
+    /* An hour of the running clock: what the clock timer costs at rest. */
+    ui_sync_stats_t before, after;
+    ui_sync_get_stats(&before);
+    sim_display_run(SIM_HOUR_MS, SIM_STEP_MS);
+    ui_sync_get_stats(&after);
+    print_frame_stats("hour");
+    printf("%-10s clock ticks %lu  clock labels set %lu\n", "",
+           (unsigned long)(after.clock_ticks - before.clock_ticks),
+           (unsigned long)(after.clock_labels - before.clock_labels));
+
+    printf("\nRender cost per object (own drawing, all steps)\n");
+    for(uint32_t i = 0; i < OBJ_PROFILE_COUNT; i++)
+    {
+        const obj_profile_t *p = &obj_profile[i];
+        printf("  %-20s draws %5lu  total %9.1f us  avg %7.2f us\n", p->name,
+               (unsigned long)p->draws, (double)p->ns / 1000.0,
+               (p->draws > 0u) ? ((double)p->ns / 1000.0) / p->draws : 0.0);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,394 @@
+/******************************************************************************
+*
+* File Name: civil_time.c
+*
+* Description: This file contains the civil time conversions, based on
+* the days-from-civil and civil-from-days algorithms over 400-year eras of the
+* proleptic Gregorian calendar, and the HTTP and ISO 8601 time parsers.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Header file includes */
+#include <string.h>
+#include "civil_time.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Days from 0000-03-01 to 1970-01-01, and in one 400-year era. */
+#define CIVIL_EPOCH_SHIFT_DAYS                   (719468UL)
+#define CIVIL_DAYS_PER_ERA                       (146097UL)
+
+/* 1970-01-01 was a Thursday. */
+#define CIVIL_EPOCH_WEEKDAY                      (4U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char civil_months[12][4] =
+{
+    "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+    "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+};
+
+static const char civil_weekdays[7][4] =
+{
+    "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"
+};
+
+static const uint8_t civil_month_days[12] =
+{
+    31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31
+};
+
+/*******************************************************************************
+ * Function Name: civil_days_from_civil
+ *******************************************************************************
+ * Summary:
+ *  Returns the days from 1970-01-01 to a date. Years are counted from March
+ *  so that the leap day is the last day of the year, which makes the day of
+ *  the year a linear function of the month.
+ *
+ * Parameters:
+ *  year: CIVIL_YEAR_MIN or later
+ *  month: 1..12
+ *  day: 1..31
+ *
+ *******************************************************************************/
+uint32_t civil_days_from_civil(uint32_t year, uint32_t month, uint32_t day)
+{
+    uint32_t y = year - ((month <= 2U) ? 1U : 0U);
+    uint32_t era = y / 400U;
+    uint32_t yoe = y - (era * 400U);
+    uint32_t doy = (((153U * ((month > 2U) ? (month - 3U) : (month + 9U))) + 2U) / 5U) + day - 1U;
+    uint32_t doe = (yoe * 365U) + (yoe / 4U) - (yoe / 100U) + doy;
+
+    return (era * CIVIL_DAYS_PER_ERA) + doe - CIVIL_EPOCH_SHIFT_DAYS;
+}
+
+/*******************************************************************************
+ * Function Name: civil_from_days
+ *******************************************************************************
+ * Summary:
+ *  Fills in year, month, day and weekday of t for a count of days since
+ *  1970-01-01. The other fields are left alone.
+ *
+ *******************************************************************************/
+void civil_from_days(uint32_t days, civil_time_t *t)
+{
+    uint32_t z = days + CIVIL_EPOCH_SHIFT_DAYS;
+    uint32_t era = z / CIVIL_DAYS_PER_ERA;
+    uint32_t doe = z - (era * CIVIL_DAYS_PER_ERA);
+    uint32_t yoe = (doe - (doe / 1460U) + (doe / 36524U) - (doe / 146096U)) / 365U;
+    uint32_t doy = doe - ((365U * yoe) + (yoe / 4U) - (yoe / 100U));
+    uint32_t mp = ((5U * doy) + 2U) / 153U;
+    uint32_t month = (mp < 10U) ? (mp + 3U) : (mp - 9U);
+
+    t->year = (uint16_t)((era * 400U) + yoe + ((month <= 2U) ? 1U : 0U));
+    t->month = (uint8_t)month;
+    t->day = (uint8_t)(doy - (((153U * mp) + 2U) / 5U) + 1U);
+    t->weekday = (uint8_t)civil_weekday(days);
+}
+
+/*******************************************************************************
+ * Function Name: civil_weekday
+ *******************************************************************************
+ * Summary:
+ *  Returns the weekday, 0 for Sunday, of a count of days since 1970-01-01.
+ *
+ *******************************************************************************/
+uint32_t civil_weekday(uint32_t days)
+{
+    return (days + CIVIL_EPOCH_WEEKDAY) % 7U;
+}
+
+/*******************************************************************************
+ * Function Name: civil_days_in_month
+ *******************************************************************************
+ * Summary:
+ *  Returns the number of days in a month, 1..12, of the given year.
+ *
+ *******************************************************************************/
+uint32_t civil_days_in_month(uint32_t year, uint32_t month)
+{
+    bool leap = ((0U == (year % 4U)) && ((0U != (year % 100U)) || (0U == (year % 400U))));
+
+    return civil_month_days[month - 1U] + (((2U == month) && leap) ? 1U : 0U);
+}
+
+/*******************************************************************************
+ * Function Name: civil_time_to_epoch
+ *******************************************************************************
+ * Summary:
+ *  Converts a broken-down time to seconds since 1970. The weekday is
+ *  ignored.
+ *
+ *******************************************************************************/
+uint32_t civil_time_to_epoch(const civil_time_t *t)
+{
+    return (civil_days_from_civil(t->year, t->month, t->day) * CIVIL_SECONDS_PER_DAY) +
+           ((uint32_t)t->hour * 3600UL) + ((uint32_t)t->minute * 60UL) + t->second;
+}
+
+/*******************************************************************************
+ * Function Name: civil_time_from_epoch
+ *******************************************************************************
+ * Summary:
+ *  Converts seconds since 1970 to a broken-down time.
+ *
+ *******************************************************************************/
+void civil_time_from_epoch(uint32_t epoch, civil_time_t *t)
+{
+    uint32_t secs = epoch % CIVIL_SECONDS_PER_DAY;
+
+    civil_from_days(epoch / CIVIL_SECONDS_PER_DAY, t);
+    t->hour = (uint8_t)(secs / 3600U);
+    t->minute = (uint8_t)((secs / 60U) % 60U);
+    t->second = (uint8_t)(secs % 60U);
+}
+
+/*******************************************************************************
+ * Function Name: civil_time_advance
+ *******************************************************************************
+ * Summary:
+ *  Moves a broken-down time forward. Under a day this carries from field to
+ *  field and crosses at most one midnight, without a full conversion; longer
+ *  steps go through seconds since 1970.
+ *
+ *******************************************************************************/
+void civil_time_advance(civil_time_t *t, uint32_t seconds)
+{
+    uint32_t value;
+
+    if (seconds >= CIVIL_SECONDS_PER_DAY)
+    {
+        civil_time_from_epoch(civil_time_to_epoch(t) + seconds, t);
+        return;
+    }
+
+    value = t->second + seconds;
+    if (value < 60U)
+    {
+        t->second = (uint8_t)value;
+        return;
+    }
+    t->second = (uint8_t)(value % 60U);
+
+    value = t->minute + (value / 60U);
+    t->minute = (uint8_t)(value % 60U);
+
+    value = t->hour + (value / 60U);
+    t->hour = (uint8_t)(value % 24U);
+    if (value < 24U)
+    {
+        return;
+    }
+
+    t->weekday = (uint8_t)((t->weekday + 1U) % 7U);
+    if (t->day < civil_days_in_month(t->year, t->month))
+    {
+        t->day++;
+    }
+    else if (t->month < 12U)
+    {
+        t->day = 1U;
+        t->month++;
+    }
+    else
+    {
+        t->day = 1U;
+        t->month = 1U;
+        t->year++;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: civil_parse_digits
+ *******************************************************************************
+ * Summary:
+ *  Reads exactly count decimal digits from text.
+ *
+ *******************************************************************************/
+static bool civil_parse_digits(const char *text, uint32_t count, uint32_t *value)
+{
+    *value = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if ((text[i] < '0') || (text[i] > '9'))
+        {
+            return false;
+        }
+        *value = (*value * 10U) + (uint32_t)(text[i] - '0');
+    }
+    return true;
+}
+
+/*******************************************************************************
+ * Function Name: civil_time_check
+ *******************************************************************************
+ * Summary:
+ *  Tells whether a parsed date and time are in range.
+ *
+ *******************************************************************************/
+static bool civil_time_check(const civil_time_t *t)
+{
+    return (t->year >= CIVIL_YEAR_MIN) && (t->year <= CIVIL_YEAR_MAX) &&
+           (t->month >= 1U) && (t->month <= 12U) &&
+           (t->day >= 1U) && (t->day <= civil_days_in_month(t->year, t->month)) &&
+           (t->hour < 24U) && (t->minute < 60U) && (t->second <= 60U);
+}
+
+/*******************************************************************************
+ * Function Name: civil_time_parse_http_date
+ *******************************************************************************
+ * Summary:
+ *  Converts an HTTP Date value, IMF-fixdate such as
+ *  "Mon, 22 Jan 2024 10:15:00 GMT", to UTC seconds since 1970.
+ *
+ * Parameters:
+ *  text: Date header value
+ *  epoch: receives the time
+ *
+ * Return:
+ *  bool: false if the value could not be parsed
+ *
+ *******************************************************************************/
+bool civil_time_parse_http_date(const char *text, uint32_t *epoch)
+{
+    civil_time_t t;
+    uint32_t year, day, hour, minute, second;
+    uint32_t month;
+
+    if ((strnlen(text, 29U) < 29U) || (',' != text[3]) || (' ' != text[4]) ||
+        (' ' != text[7]) || (' ' != text[11]) || (' ' != text[16]) ||
+        (':' != text[19]) || (':' != text[22]) || (0 != strncmp(&text[25], " GMT", 4)) ||
+        !civil_parse_digits(&text[5], 2U, &day) || !civil_parse_digits(&text[12], 4U, &year) ||
+        !civil_parse_digits(&text[17], 2U, &hour) || !civil_parse_digits(&text[20], 2U, &minute) ||
+        !civil_parse_digits(&text[23], 2U, &second))
+    {
+        return false;
+    }
+
+    for (month = 0; month < 12U; month++)
+    {
+        if (0 == strncmp(&text[8], civil_months[month], 3))
+        {
+            break;
+        }
+    }
+
+    t.year = (uint16_t)year;
+    t.month = (uint8_t)(month + 1U);
+    t.day = (uint8_t)day;
+    t.hour = (uint8_t)hour;
+    t.minute = (uint8_t)minute;
+    t.second = (uint8_t)second;
+    if (!civil_time_check(&t))
+    {
+        return false;
+    }
+
+    *epoch = civil_time_to_epoch(&t);
+    return true;
+}
+
+/*******************************************************************************
+ * Function Name: civil_time_parse_iso
+ *******************************************************************************
+ * Summary:
+ *  Converts a UTC time such as "2024-01-22T10:15" or "2024-01-22T10:15:30",
+ *  as Open-Meteo gives it, to seconds since 1970.
+ *
+ * Return:
+ *  bool: false if the value could not be parsed
+ *
+ *******************************************************************************/
+bool civil_time_parse_iso(const char *text, uint32_t *epoch)
+{
+    civil_time_t t;
+    uint32_t year, month, day, hour, minute;
+    uint32_t second = 0;
+
+    if ((strnlen(text, 16U) < 16U) || ('-' != text[4]) || ('-' != text[7]) ||
+        ('T' != text[10]) || (':' != text[13]) ||
+        !civil_parse_digits(&text[0], 4U, &year) || !civil_parse_digits(&text[5], 2U, &month) ||
+        !civil_parse_digits(&text[8], 2U, &day) || !civil_parse_digits(&text[11], 2U, &hour) ||
+        !civil_parse_digits(&text[14], 2U, &minute) ||
+        ((':' == text[16]) && !civil_parse_digits(&text[17], 2U, &second)))
+    {
+        return false;
+    }
+
+    t.year = (uint16_t)year;
+    t.month = (uint8_t)month;
+    t.day = (uint8_t)day;
+    t.hour = (uint8_t)hour;
+    t.minute = (uint8_t)minute;
+    t.second = (uint8_t)second;
+    if (!civil_time_check(&t))
+    {
+        return false;
+    }
+
+    *epoch = civil_time_to_epoch(&t);
+    return true;
+}
+
+/*******************************************************************************
+ * Function Name: civil_month_str
+ *******************************************************************************
+ * Summary:
+ *  Returns the three-letter English name of a month, 1..12.
+ *
+ *******************************************************************************/
+const char *civil_month_str(uint32_t month)
+{
+    return ((month >= 1U) && (month <= 12U)) ? civil_months[month - 1U] : "???";
+}
+
+/*******************************************************************************
+ * Function Name: civil_weekday_str
+ *******************************************************************************
+ * Summary:
+ *  Returns the three-letter English name of a weekday, 0 for Sunday.
+ *
+ *******************************************************************************/
+const char *civil_weekday_str(uint32_t weekday)
+{
+    return (weekday < 7U) ? civil_weekdays[weekday] : "???";
+}
+
+/* [] END OF FILE */
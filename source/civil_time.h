@@ -0,0 +1,107 @@
+/******************************************************************************
+*
+* File Name: civil_time.h
+*
+* Description: This file contains the civil time conversions: UTC
+* calendar dates and times to and from seconds since 1970, weekdays, and
+* stepping a broken-down time forward, all in plain integer arithmetic with
+* no C library time zone calls.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef CIVIL_TIME_H_
+#define CIVIL_TIME_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define CIVIL_SECONDS_PER_DAY                    (86400UL)
+
+/* Seconds since 1970 fit in 32 bits until early 2106. */
+#define CIVIL_YEAR_MIN                           (1970U)
+#define CIVIL_YEAR_MAX                           (2105U)
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+/* Broken-down time. Unlike struct tm, month and day count from 1 and the
+ * year is the full year. */
+typedef struct
+{
+    uint16_t year;
+    uint8_t month;              /* 1..12 */
+    uint8_t day;                /* 1..31 */
+    uint8_t hour;
+    uint8_t minute;
+    uint8_t second;
+    uint8_t weekday;            /* 0 = Sunday */
+} civil_time_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint32_t civil_days_from_civil(uint32_t year, uint32_t month, uint32_t day);
+void civil_from_days(uint32_t days, civil_time_t *t);
+uint32_t civil_weekday(uint32_t days);
+uint32_t civil_days_in_month(uint32_t year, uint32_t month);
+
+uint32_t civil_time_to_epoch(const civil_time_t *t);
+void civil_time_from_epoch(uint32_t epoch, civil_time_t *t);
+void civil_time_advance(civil_time_t *t, uint32_t seconds);
+
+bool civil_time_parse_http_date(const char *text, uint32_t *epoch);
+bool civil_time_parse_iso(const char *text, uint32_t *epoch);
+
+const char *civil_month_str(uint32_t month);
+const char *civil_weekday_str(uint32_t weekday);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CIVIL_TIME_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,306 @@
+/******************************************************************************
+*
+* File Name: cond_get.c
+*
+* Description: This file contains the conditional GET support. It keeps the validators
+* of the last full response per host and path, adds If-None-Match and
+* If-Modified-Since to the next request for the same resource, and counts
+* the bytes and parse time that 304 Not Modified responses save per day.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Header file includes */
+#include <stdio.h>
+#include <string.h>
+#include "cond_get.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define COND_GET_SECONDS_PER_DAY                 (86400UL)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static cond_get_entry_t cond_get_entries[COND_GET_SLOTS];
+static uint32_t cond_get_clock;
+static cond_get_stats_t cond_get_stats;
+
+/*******************************************************************************
+ * Function Name: cond_get_key
+ *******************************************************************************
+ * Summary:
+ *  FNV-1a hash of host and path. Never 0, which marks an unused entry.
+ *
+ *******************************************************************************/
+static uint32_t cond_get_key(const char *host, const char *path)
+{
+    uint32_t hash = 2166136261UL;
+
+    for (const char *p = host; '\0' != *p; p++)
+    {
+        hash = (hash ^ (uint8_t)*p) * 16777619UL;
+    }
+    hash = (hash ^ (uint8_t)'/') * 16777619UL;
+    for (const char *p = path; '\0' != *p; p++)
+    {
+        hash = (hash ^ (uint8_t)*p) * 16777619UL;
+    }
+
+    return (0U != hash) ? hash : 1U;
+}
+
+/*******************************************************************************
+ * Function Name: cond_get_count
+ *******************************************************************************
+ * Summary:
+ *  Returns the counters of the day that contains now, moving today's to
+ *  yesterday at midnight. now is 0 if the response had no usable Date, in
+ *  which case the current day carries on.
+ *
+ *******************************************************************************/
+static cond_get_day_t *cond_get_count(uint32_t now)
+{
+    uint32_t day = now / COND_GET_SECONDS_PER_DAY;
+
+    if ((0U != now) && (day != cond_get_stats.today.day))
+    {
+        cond_get_stats.yesterday = (cond_get_stats.today.day + 1U == day) ?
+                                   cond_get_stats.today : (cond_get_day_t){ .day = day - 1U };
+        (void)memset(&cond_get_stats.today, 0, sizeof(cond_get_stats.today));
+        cond_get_stats.today.day = day;
+    }
+
+    return &cond_get_stats.today;
+}
+
+/*******************************************************************************
+ * Function Name: cond_get_lookup
+ *******************************************************************************
+ * Summary:
+ *  Finds the validators of a resource. A resource seen for the first time
+ *  takes over the least recently used entry, empty.
+ *
+ * Parameters:
+ *  host: server host name
+ *  path: resource path including the query
+ *
+ * Return:
+ *  cond_get_entry_t*: entry of the resource, never NULL
+ *
+ *******************************************************************************/
+cond_get_entry_t *cond_get_lookup(const char *host, const char *path)
+{
+    uint32_t key = cond_get_key(host, path);
+    cond_get_entry_t *entry = &cond_get_entries[0];
+
+    for (uint32_t i = 0; i < COND_GET_SLOTS; i++)
+    {
+        if (key == cond_get_entries[i].key)
+        {
+            entry = &cond_get_entries[i];
+            entry->last_used = ++cond_get_clock;
+            return entry;
+        }
+        if (cond_get_entries[i].last_used < entry->last_used)
+        {
+            entry = &cond_get_entries[i];
+        }
+    }
+
+    (void)memset(entry, 0, sizeof(*entry));
+    entry->key = key;
+    entry->last_used = ++cond_get_clock;
+    return entry;
+}
+
+/*******************************************************************************
+ * Function Name: cond_get_add_headers
+ *******************************************************************************
+ * Summary:
+ *  Adds If-None-Match and If-Modified-Since for the validators the entry has.
+ *
+ * Parameters:
+ *  entry: resource, or NULL for an unconditional request
+ *  headers: where to put the request headers
+ *  max: room in headers
+ *
+ * Return:
+ *  uint32_t: number of headers added
+ *
+ *******************************************************************************/
+uint32_t cond_get_add_headers(const cond_get_entry_t *entry, cy_http_client_header_t *headers, uint32_t max)
+{
+    uint32_t count = 0;
+
+    if (NULL == entry)
+    {
+        return 0;
+    }
+
+    if (('\0' != entry->etag[0]) && (count < max))
+    {
+        headers[count].field = "If-None-Match";
+        headers[count].field_len = strlen("If-None-Match");
+        headers[count].value = (char *)entry->etag;
+        headers[count].value_len = strlen(entry->etag);
+        count++;
+    }
+
+    if (('\0' != entry->last_modified[0]) && (count < max))
+    {
+        headers[count].field = "If-Modified-Since";
+        headers[count].field_len = strlen("If-Modified-Since");
+        headers[count].value = (char *)entry->last_modified;
+        headers[count].value_len = strlen(entry->last_modified);
+        count++;
+    }
+
+    return count;
+}
+
+/*******************************************************************************
+ * Function Name: cond_get_store
+ *******************************************************************************
+ * Summary:
+ *  Records the validators of a full response once its body has been parsed,
+ *  along with what that response cost, which is what a later 304 saves. A
+ *  validator too long to hold is dropped rather than sent truncated.
+ *
+ * Parameters:
+ *  entry: resource
+ *  index: headers of the response
+ *  body_len: body bytes received
+ *  parse_us: time spent parsing the body
+ *  now: response Date as epoch seconds, 0 if unknown
+ *
+ *******************************************************************************/
+void cond_get_store(cond_get_entry_t *entry, const http_header_index_t *index,
+                    uint32_t body_len, uint32_t parse_us, uint32_t now)
+{
+    const char *value;
+    size_t len;
+
+    if (('\0' != entry->etag[0]) || ('\0' != entry->last_modified[0]))
+    {
+        cond_get_count(now)->conditional++;
+    }
+
+    entry->etag[0] = '\0';
+    entry->last_modified[0] = '\0';
+
+    if (http_header_index_get(index, HTTP_HDR_ETAG, &value, &len) && (len < sizeof(entry->etag)))
+    {
+        (void)http_header_index_copy(index, HTTP_HDR_ETAG, entry->etag, sizeof(entry->etag));
+    }
+    if (http_header_index_get(index, HTTP_HDR_LAST_MODIFIED, &value, &len) && (len < sizeof(entry->last_modified)))
+    {
+        (void)http_header_index_copy(index, HTTP_HDR_LAST_MODIFIED, entry->last_modified, sizeof(entry->last_modified));
+    }
+
+    entry->body_len = body_len;
+    entry->parse_us = parse_us;
+}
+
+/*******************************************************************************
+ * Function Name: cond_get_not_modified
+ *******************************************************************************
+ * Summary:
+ *  Counts a 304 response: the body and the parse of the last full response
+ *  were saved. The validators stay as they are.
+ *
+ *******************************************************************************/
+void cond_get_not_modified(cond_get_entry_t *entry, uint32_t now)
+{
+    cond_get_day_t *day = cond_get_count(now);
+
+    day->conditional++;
+    day->not_modified++;
+    day->bytes_saved += entry->body_len;
+    day->parse_us_saved += entry->parse_us;
+}
+
+/*******************************************************************************
+ * Function Name: cond_get_forget
+ *******************************************************************************
+ * Summary:
+ *  Drops the validators of a resource, so that the next request fetches it in
+ *  full. Used when a body could not be parsed: a 304 must never stand in for
+ *  data that was not actually taken in.
+ *
+ *******************************************************************************/
+void cond_get_forget(cond_get_entry_t *entry)
+{
+    entry->etag[0] = '\0';
+    entry->last_modified[0] = '\0';
+}
+
+/*******************************************************************************
+ * Function Name: cond_get_get_stats
+ *******************************************************************************
+ * Summary:
+ *  Copies the counters of today and yesterday.
+ *
+ *******************************************************************************/
+void cond_get_get_stats(cond_get_stats_t *stats)
+{
+    *stats = cond_get_stats;
+}
+
+/*******************************************************************************
+ * Function Name: cond_get_print_stats
+ *******************************************************************************
+ * Summary:
+ *  Prints today's and yesterday's conditional request counters.
+ *
+ *******************************************************************************/
+void cond_get_print_stats(void)
+{
+    const cond_get_day_t *days[] = { &cond_get_stats.today, &cond_get_stats.yesterday };
+    const char *names[] = { "today", "yesterday" };
+
+    for (uint32_t i = 0; i < (sizeof(days) / sizeof(days[0])); i++)
+    {
+        printf("Conditional GET %s: %lu sent, %lu not modified, %lu bytes and %lu us parse saved\n",
+               names[i],
+               (unsigned long)days[i]->conditional,
+               (unsigned long)days[i]->not_modified,
+               (unsigned long)days[i]->bytes_saved,
+               (unsigned long)days[i]->parse_us_saved);
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,120 @@
+/******************************************************************************
+*
+* File Name: cond_get.h
+*
+* Description: This file contains the public interface of the conditional GET
+* support. It remembers the ETag and Last-Modified validators of each
+* resource and counts what 304 Not Modified responses save.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef COND_GET_H_
+#define COND_GET_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cy_http_client_api.h"
+#include "http_header_index.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Resources with validators kept; the least recently used one is replaced. */
+#define COND_GET_SLOTS                           (2U)
+
+#define COND_GET_ETAG_LEN                        (64U)
+#define COND_GET_DATE_LEN                        (32U)
+
+/* Request headers cond_get_add_headers() may add. */
+#define COND_GET_MAX_HEADERS                     (2U)
+
+#define HTTP_STATUS_NOT_MODIFIED                 (304U)
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+typedef struct
+{
+    uint32_t key;                           /* hash of host and path, 0 if unused */
+    uint32_t last_used;
+    char etag[COND_GET_ETAG_LEN];           /* empty if the server sent none */
+    char last_modified[COND_GET_DATE_LEN];
+    uint32_t body_len;                      /* size of the last full response */
+    uint32_t parse_us;                      /* time it took to parse */
+} cond_get_entry_t;
+
+/* Counters for one UTC day. */
+typedef struct
+{
+    uint32_t day;               /* days since the epoch */
+    uint32_t conditional;       /* requests sent with validators */
+    uint32_t not_modified;      /* of those, answered with 304 */
+    uint32_t bytes_saved;       /* body bytes not transferred */
+    uint32_t parse_us_saved;    /* parse time not spent */
+} cond_get_day_t;
+
+typedef struct
+{
+    cond_get_day_t today;
+    cond_get_day_t yesterday;
+} cond_get_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+cond_get_entry_t *cond_get_lookup(const char *host, const char *path);
+uint32_t cond_get_add_headers(const cond_get_entry_t *entry, cy_http_client_header_t *headers, uint32_t max);
+void cond_get_store(cond_get_entry_t *entry, const http_header_index_t *index,
+                    uint32_t body_len, uint32_t parse_us, uint32_t now);
+void cond_get_not_modified(cond_get_entry_t *entry, uint32_t now);
+void cond_get_forget(cond_get_entry_t *entry);
+void cond_get_get_stats(cond_get_stats_t *stats);
+void cond_get_print_stats(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* COND_GET_H_ */
+
+/* [] END OF FILE */
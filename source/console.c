@@ -0,0 +1,204 @@
+/******************************************************************************
+*
+* File Name: console.c
+*
+* Description: This file contains the UART console task: it polls the
+* debug UART for a line of input and runs the matching command.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Header file includes */
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "cyhal.h"
+#include "cy_retarget_io.h"
+
+/* FreeRTOS header file */
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "console.h"
+#include "latency_hist.h"
+#include "tls_client.h"
+#include "timekeeper.h"
+#include "sntp_client.h"
+#include "ui_sync.h"
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+typedef struct
+{
+    const char *name;
+    const char *help;
+    void (*run)(void);
+} console_cmd_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+static void console_help(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const console_cmd_t console_cmds[] =
+{
+    { "help",     "list commands",                          console_help },
+    { "lat",      "print the network latency histograms",   latency_hist_print },
+    { "latbin",   "print the latency histograms as hex",    latency_hist_print_export },
+    { "latreset", "clear the latency histograms",           latency_hist_reset },
+    { "tls",      "print TLS handshake and heap counters",  tls_client_print_stats },
+    { "time",     "print the clock corrections and drift",  timekeeper_print_stats },
+    { "sntp",     "print the SNTP polls and last answer",   sntp_client_print_stats },
+    { "ui",       "print the UI label and clock counters",  ui_sync_print_stats },
+};
+
+#define CONSOLE_CMD_COUNT                        (sizeof(console_cmds) / sizeof(console_cmds[0]))
+
+/*******************************************************************************
+ * Function Name: console_help
+ *******************************************************************************
+ * Summary:
+ *  Prints every command with its help text.
+ *
+ *******************************************************************************/
+static void console_help(void)
+{
+    for (uint32_t i = 0; i < CONSOLE_CMD_COUNT; i++)
+    {
+        printf("  %-10s %s\n", console_cmds[i].name, console_cmds[i].help);
+    }
+}
+
+/*******************************************************************************
+ * Function Name: console_run
+ *******************************************************************************
+ * Summary:
+ *  Runs the command named by line.
+ *
+ *******************************************************************************/
+static void console_run(const char *line)
+{
+    if ('\0' == line[0])
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < CONSOLE_CMD_COUNT; i++)
+    {
+        if (0 == strcmp(line, console_cmds[i].name))
+        {
+            console_cmds[i].run();
+            return;
+        }
+    }
+
+    printf("Unknown command '%s'; try 'help'\n", line);
+}
+
+/*******************************************************************************
+ * Function Name: console_task
+ *******************************************************************************
+ * Summary:
+ *  Collects characters from the debug UART into a line and runs it on Enter.
+ *  The UART has no receive interrupt set up by retarget-io, so it is polled;
+ *  the task sleeps between polls instead of spinning in cyhal_uart_getc().
+ *
+ * Parameters:
+ *  arg - Unused.
+ *
+ *******************************************************************************/
+void console_task(void *arg)
+{
+    char line[CONSOLE_LINE_LEN];
+    uint32_t len = 0;
+    bool overflow = false;
+    uint8_t c;
+
+    CY_UNUSED_PARAMETER(arg);
+
+    for (;;)
+    {
+        if (0U == cyhal_uart_readable(&cy_retarget_io_uart_obj))
+        {
+            vTaskDelay(pdMS_TO_TICKS(CONSOLE_POLL_MS));
+            continue;
+        }
+
+        if (CY_RSLT_SUCCESS != cyhal_uart_getc(&cy_retarget_io_uart_obj, &c, 1U))
+        {
+            continue;
+        }
+
+        if (('\r' == c) || ('\n' == c))
+        {
+            printf("\n");
+            line[len] = '\0';
+            if (overflow)
+            {
+                printf("Command too long\n");
+            }
+            else
+            {
+                console_run(line);
+            }
+            len = 0;
+            overflow = false;
+        }
+        else if ((('\b' == c) || (0x7FU == c)) && (len > 0U))
+        {
+            len--;
+            printf("\b \b");
+        }
+        else if ((c >= 0x20U) && (c < 0x7FU))
+        {
+            if (len < (CONSOLE_LINE_LEN - 1U))
+            {
+                line[len++] = (char)c;
+                printf("%c", c);
+            }
+            else
+            {
+                overflow = true;
+            }
+        }
+        fflush(stdout);
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,69 @@
+/******************************************************************************
+*
+* File Name: console.h
+*
+* Description: This file contains the UART console. Lines typed on the
+* debug UART are looked up in a table of commands, which print diagnostics
+* such as the network latency histograms.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef CONSOLE_H_
+#define CONSOLE_H_
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define CONSOLE_TASK_STACK_SIZE                  (4U * 1024U)
+#define CONSOLE_TASK_PRIORITY                    (tskIDLE_PRIORITY + 1U)
+
+/* Longest command line; longer input is dropped. */
+#define CONSOLE_LINE_LEN                         (32U)
+
+/* How often the UART is checked for input. */
+#define CONSOLE_POLL_MS                          (50U)
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+void console_task(void *arg);
+
+#endif /* CONSOLE_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,166 @@
+/******************************************************************************
+*
+* File Name: fetch_cycle.c
+*
+* Description: This file contains the state machine that walks one fetch cycle
+* through its steps (geolocation, then weather). Each step has its own
+* retry budget with capped exponential backoff, the cycle as a whole has a
+* deadline, and a cycle that gives up resumes at the failed step next time.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Header file includes */
+#include <string.h>
+#include "fetch_cycle.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const uint8_t fetch_retry_budget[FETCH_STEP_COUNT] =
+{
+    [FETCH_STEP_GEO]     = FETCH_GEO_RETRIES,
+    [FETCH_STEP_WEATHER] = FETCH_WEATHER_RETRIES
+};
+
+/*******************************************************************************
+ * Function Name: fetch_cycle_init
+ *******************************************************************************
+ * Summary:
+ *  Resets the state machine so that the next cycle starts at the first step.
+ *
+ *******************************************************************************/
+void fetch_cycle_init(fetch_cycle_t *cycle)
+{
+    (void)memset(cycle, 0, sizeof(*cycle));
+    cycle->step = FETCH_STEP_GEO;
+    cycle->resume = FETCH_STEP_GEO;
+}
+
+/*******************************************************************************
+ * Function Name: fetch_cycle_begin
+ *******************************************************************************
+ * Summary:
+ *  Starts a cycle at the step the previous one failed at, or at the first
+ *  step if it completed. The caller then runs cycle->step.
+ *
+ * Parameters:
+ *  cycle: state machine
+ *  now_ms: current time in milliseconds, any epoch
+ *
+ *******************************************************************************/
+void fetch_cycle_begin(fetch_cycle_t *cycle, uint32_t now_ms)
+{
+    cycle->step = cycle->resume;
+    cycle->attempts = 0;
+    cycle->wait_ms = 0;
+    cycle->deadline_ms = now_ms + FETCH_CYCLE_DEADLINE_MS;
+}
+
+/*******************************************************************************
+ * Function Name: fetch_cycle_report
+ *******************************************************************************
+ * Summary:
+ *  Takes the outcome of an attempt at cycle->step and decides what happens
+ *  next: move on to the following step, wait and retry the same step, or end
+ *  the cycle. A retry is only scheduled if its wait ends before the deadline.
+ *
+ * Parameters:
+ *  cycle: state machine
+ *  outcome: result of the attempt
+ *  now_ms: current time in milliseconds, same epoch as fetch_cycle_begin()
+ *
+ * Return:
+ *  fetch_action_t: next action; for FETCH_ACTION_WAIT see cycle->wait_ms
+ *
+ *******************************************************************************/
+fetch_action_t fetch_cycle_report(fetch_cycle_t *cycle, fetch_outcome_t outcome, uint32_t now_ms)
+{
+    cycle->attempts++;
+
+    if (FETCH_OK == outcome)
+    {
+        cycle->attempts = 0;
+        cycle->step = (fetch_step_t)(cycle->step + 1);
+        if (FETCH_STEP_COUNT == cycle->step)
+        {
+            cycle->resume = FETCH_STEP_GEO;
+            return FETCH_ACTION_DONE;
+        }
+        return FETCH_ACTION_RUN;
+    }
+
+    if ((FETCH_RETRY == outcome) && (cycle->attempts <= fetch_retry_budget[cycle->step]))
+    {
+        uint32_t shift = cycle->attempts - 1U;
+        uint32_t wait = (shift < 16U) ? (FETCH_BACKOFF_BASE_MS << shift) : FETCH_BACKOFF_MAX_MS;
+
+        if (wait > FETCH_BACKOFF_MAX_MS)
+        {
+            wait = FETCH_BACKOFF_MAX_MS;
+        }
+
+        if ((int32_t)(cycle->deadline_ms - (now_ms + wait)) >= 0)
+        {
+            cycle->wait_ms = wait;
+            cycle->retries[cycle->step]++;
+            return FETCH_ACTION_WAIT;
+        }
+    }
+
+    cycle->failures[cycle->step]++;
+    cycle->resume = cycle->step;
+    return FETCH_ACTION_FAILED;
+}
+
+/*******************************************************************************
+ * Function Name: fetch_cycle_step_str
+ *******************************************************************************
+ * Summary:
+ *  Name of a step for the log.
+ *
+ *******************************************************************************/
+const char *fetch_cycle_step_str(fetch_step_t step)
+{
+    static const char *const names[FETCH_STEP_COUNT] =
+    {
+        [FETCH_STEP_GEO]     = "geolocation",
+        [FETCH_STEP_WEATHER] = "weather"
+    };
+
+    return ((uint32_t)step < FETCH_STEP_COUNT) ? names[step] : "?";
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,122 @@
+/******************************************************************************
+*
+* File Name: fetch_cycle.h
+*
+* Description: This file is the public interface of fetch_cycle.c source file
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef FETCH_CYCLE_H_
+#define FETCH_CYCLE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Retries after the first attempt, per step. */
+#define FETCH_GEO_RETRIES                        (2U)
+#define FETCH_WEATHER_RETRIES                    (3U)
+
+/* Wait before retry n is FETCH_BACKOFF_BASE_MS << (n - 1), capped. */
+#define FETCH_BACKOFF_BASE_MS                    (500UL)
+#define FETCH_BACKOFF_MAX_MS                     (8000UL)
+
+/* A cycle that has not finished by then gives up. */
+#define FETCH_CYCLE_DEADLINE_MS                  (30000UL)
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+typedef enum
+{
+    FETCH_STEP_GEO,
+    FETCH_STEP_WEATHER,
+    FETCH_STEP_COUNT
+} fetch_step_t;
+
+/* How a step attempt went. */
+typedef enum
+{
+    FETCH_OK,
+    FETCH_RETRY,            /* transient: network error, 5xx, bad body */
+    FETCH_FATAL             /* retrying will not help, e.g. 4xx */
+} fetch_outcome_t;
+
+/* What the caller does next. */
+typedef enum
+{
+    FETCH_ACTION_RUN,       /* run fetch_cycle_t.step */
+    FETCH_ACTION_WAIT,      /* sleep fetch_cycle_t.wait_ms, then run the step */
+    FETCH_ACTION_DONE,      /* every step succeeded */
+    FETCH_ACTION_FAILED     /* out of retries or out of time */
+} fetch_action_t;
+
+typedef struct
+{
+    fetch_step_t step;
+    fetch_step_t resume;        /* first step of the next cycle */
+    uint32_t attempts;          /* attempts made at the current step */
+    uint32_t deadline_ms;
+    uint32_t wait_ms;
+
+    uint32_t retries[FETCH_STEP_COUNT];     /* totals, for the log */
+    uint32_t failures[FETCH_STEP_COUNT];
+} fetch_cycle_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void fetch_cycle_init(fetch_cycle_t *cycle);
+void fetch_cycle_begin(fetch_cycle_t *cycle, uint32_t now_ms);
+fetch_action_t fetch_cycle_report(fetch_cycle_t *cycle, fetch_outcome_t outcome, uint32_t now_ms);
+const char *fetch_cycle_step_str(fetch_step_t step);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* FETCH_CYCLE_H_ */
+
+/* [] END OF FILE */
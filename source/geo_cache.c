@@ -0,0 +1,270 @@
+/******************************************************************************
+*
+* File Name: geo_cache.c
+*
+* Description: This file contains the geolocation cache. The location resolved
+* from the geolocation API is kept in external QSPI flash together with
+* the time it was resolved and the network it was resolved on, so that
+* the lookup is only repeated when the entry expires or the network
+* changes.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Header file includes */
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "cybsp.h"
+#include "cy_serial_flash_qspi.h"
+#include "cycfg_qspi_memslot.h"
+
+#include "geo_cache.h"
+#include "secure_http_client.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define GEO_CACHE_MAGIC                          (0x47454F31UL)   /* "GEO1" */
+#define GEO_CACHE_QSPI_FREQ_HZ                   (50000000UL)
+#define CRC32_POLY                               (0xEDB88320UL)
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+/* Layout of the record in flash. The CRC covers everything before it. */
+typedef struct
+{
+    uint32_t magic;
+    uint32_t size;
+    geo_cache_entry_t entry;
+    uint32_t crc;
+} geo_cache_record_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static geo_cache_entry_t geo_cache_entry;
+static bool geo_cache_valid;
+static uint32_t geo_cache_flash_addr;
+static bool geo_cache_flash_ready;
+
+/*******************************************************************************
+ * Function Name: geo_cache_crc32
+ *******************************************************************************
+ * Summary:
+ *  Bitwise CRC-32 (IEEE 802.3). The record is read and written once per
+ *  lookup, so a table is not worth its flash.
+ *
+ *******************************************************************************/
+static uint32_t geo_cache_crc32(const uint8_t *data, size_t len)
+{
+    uint32_t crc = 0xFFFFFFFFUL;
+
+    while (0U != len--)
+    {
+        crc ^= *data++;
+        for (uint32_t bit = 0; bit < 8U; bit++)
+        {
+            crc = (crc >> 1) ^ (CRC32_POLY & (0UL - (crc & 1UL)));
+        }
+    }
+
+    return ~crc;
+}
+
+/*******************************************************************************
+ * Function Name: geo_cache_init
+ *******************************************************************************
+ * Summary:
+ *  Brings up the QSPI flash (unless it is already running for XIP), picks the
+ *  last erase sector for the record and loads the record if it is intact.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS, or the serial flash error. On error the cache
+ *  stays empty and every cycle does the geolocation lookup.
+ *
+ *******************************************************************************/
+cy_rslt_t geo_cache_init(void)
+{
+    cy_rslt_t result = CY_RSLT_SUCCESS;
+    geo_cache_record_t record;
+    size_t flash_size;
+
+#if !defined(CY_ENABLE_XIP_PROGRAM)
+    result = cy_serial_flash_qspi_init(smifMemConfigs[0], CYBSP_QSPI_D0, CYBSP_QSPI_D1,
+                                       CYBSP_QSPI_D2, CYBSP_QSPI_D3, NC, NC, NC, NC,
+                                       CYBSP_QSPI_SCK, CYBSP_QSPI_SS, GEO_CACHE_QSPI_FREQ_HZ);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        ERR_INFO(("Geo cache: QSPI flash init failed.\n"));
+        return result;
+    }
+#endif
+
+    flash_size = cy_serial_flash_qspi_get_size();
+    geo_cache_flash_addr = (uint32_t)(flash_size - cy_serial_flash_qspi_get_erase_size(flash_size - 1U));
+    geo_cache_flash_ready = true;
+
+    result = cy_serial_flash_qspi_read(geo_cache_flash_addr, sizeof(record), (uint8_t *)&record);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        ERR_INFO(("Geo cache: read failed.\n"));
+        return result;
+    }
+
+    if ((GEO_CACHE_MAGIC == record.magic) && (sizeof(record) == record.size) &&
+        (record.crc == geo_cache_crc32((const uint8_t *)&record, offsetof(geo_cache_record_t, crc))))
+    {
+        geo_cache_entry = record.entry;
+        geo_cache_valid = true;
+        APP_INFO(("Geo cache: %s (%s,%s) resolved at %lu\n", geo_cache_entry.city,
+                  geo_cache_entry.latitude, geo_cache_entry.longitude,
+                  (unsigned long)geo_cache_entry.resolved_at));
+    }
+    else
+    {
+        APP_INFO(("Geo cache: empty\n"));
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+ * Function Name: geo_cache_lookup
+ *******************************************************************************
+ * Summary:
+ *  Returns the cached location if there is one, it has not expired and it was
+ *  resolved on the network the device is on now.
+ *
+ * Parameters:
+ *  net: network the device is currently on
+ *  entry: receives the cached location
+ *
+ * Return:
+ *  bool: true on a hit
+ *
+ *******************************************************************************/
+bool geo_cache_lookup(const geo_cache_net_t *net, geo_cache_entry_t *entry)
+{
+    if (!geo_cache_valid)
+    {
+        return false;
+    }
+
+    if (0 != memcmp(&geo_cache_entry.net, net, sizeof(*net)))
+    {
+        APP_INFO(("Geo cache: network changed, resolving again\n"));
+        geo_cache_valid = false;
+        return false;
+    }
+
+    *entry = geo_cache_entry;
+    return true;
+}
+
+/*******************************************************************************
+ * Function Name: geo_cache_check_expiry
+ *******************************************************************************
+ * Summary:
+ *  Drops the cached location once it is GEO_CACHE_TTL_S old. The time is only
+ *  known after a server has answered, so this is checked after every poll
+ *  rather than at lookup. The flash copy is left until it is replaced.
+ *
+ * Parameters:
+ *  now_utc: current UTC time in seconds since 1970
+ *
+ *******************************************************************************/
+void geo_cache_check_expiry(uint32_t now_utc)
+{
+    if (geo_cache_valid && ((now_utc - geo_cache_entry.resolved_at) >= GEO_CACHE_TTL_S))
+    {
+        APP_INFO(("Geo cache: entry expired\n"));
+        geo_cache_valid = false;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: geo_cache_store
+ *******************************************************************************
+ * Summary:
+ *  Makes a freshly resolved location the cached one and writes it to flash.
+ *  This happens at most once per TTL or network change, so rewriting the
+ *  whole sector each time costs no meaningful flash endurance.
+ *
+ * Parameters:
+ *  entry: location to cache, with net and resolved_at filled in
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS, or the serial flash error. The RAM copy is
+ *  used either way.
+ *
+ *******************************************************************************/
+cy_rslt_t geo_cache_store(const geo_cache_entry_t *entry)
+{
+    cy_rslt_t result;
+    geo_cache_record_t record;
+
+    geo_cache_entry = *entry;
+    geo_cache_valid = true;
+
+    if (!geo_cache_flash_ready)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    (void)memset(&record, 0, sizeof(record));
+    record.magic = GEO_CACHE_MAGIC;
+    record.size = sizeof(record);
+    record.entry = *entry;
+    record.crc = geo_cache_crc32((const uint8_t *)&record, offsetof(geo_cache_record_t, crc));
+
+    result = cy_serial_flash_qspi_erase(geo_cache_flash_addr,
+                                        cy_serial_flash_qspi_get_erase_size(geo_cache_flash_addr));
+    if (CY_RSLT_SUCCESS == result)
+    {
+        result = cy_serial_flash_qspi_write(geo_cache_flash_addr, sizeof(record), (const uint8_t *)&record);
+    }
+
+    if (CY_RSLT_SUCCESS != result)
+    {
+        ERR_INFO(("Geo cache: write failed.\n"));
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
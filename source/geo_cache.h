@@ -0,0 +1,96 @@
+/******************************************************************************
+*
+* File Name: geo_cache.h
+*
+* Description: This file is the public interface of geo_cache.c source file
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef GEO_CACHE_H_
+#define GEO_CACHE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cy_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* How long a resolved location is trusted before it is looked up again. */
+#define GEO_CACHE_TTL_S                          (24UL * 60UL * 60UL)
+
+#define GEO_CACHE_COORD_LEN                      (16U)
+#define GEO_CACHE_TIMEZONE_LEN                   (32U)
+#define GEO_CACHE_CITY_LEN                       (64U)   /* WEATHER_CITY_LEN */
+#define GEO_CACHE_IP_LEN                         (40U)
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+/* Identifies the network a location was resolved on. The public address is
+ * only known to the geolocation server, so a change of access point or of the
+ * address handed out by DHCP is taken as a possible change of public IP. */
+typedef struct
+{
+    uint8_t bssid[6];
+    uint32_t sta_ipv4;
+} geo_cache_net_t;
+
+typedef struct
+{
+    char latitude[GEO_CACHE_COORD_LEN];
+    char longitude[GEO_CACHE_COORD_LEN];
+    char timezone[GEO_CACHE_TIMEZONE_LEN];
+    char city[GEO_CACHE_CITY_LEN];
+    char public_ip[GEO_CACHE_IP_LEN];   /* as reported by the geolocation API */
+    geo_cache_net_t net;
+    uint32_t resolved_at;               /* UTC seconds since 1970 */
+} geo_cache_entry_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+cy_rslt_t geo_cache_init(void);
+bool geo_cache_lookup(const geo_cache_net_t *net, geo_cache_entry_t *entry);
+void geo_cache_check_expiry(uint32_t now_utc);
+cy_rslt_t geo_cache_store(const geo_cache_entry_t *entry);
+
+#endif /* GEO_CACHE_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,537 @@
+/******************************************************************************
+*
+* File Name: http_conn_pool.c
+*
+* Description: This file contains a small pool of keep-alive HTTP client
+* connections keyed by host and port, so that consecutive polls of the
+* same server reuse the open socket instead of reconnecting.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Header file includes */
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+/* FreeRTOS header file */
+#include <FreeRTOS.h>
+#include <task.h>
+#include <semphr.h>
+
+#include "cy_secure_sockets.h"
+#include "http_conn_pool.h"
+#include "secure_http_client.h"
+#include "tls_client.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define HTTP_CONN_TIMEOUT_MS                     (TRANSPORT_SEND_RECV_TIMEOUT_MS)
+
+/* How often a task waiting for a slot in use looks again. */
+#define HTTP_CONN_BUSY_POLL_MS                   (10U)
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+typedef struct
+{
+    const char *host;                   /* NULL while the slot is unused */
+    uint16_t port;
+    cy_awsport_server_info_t server_info;
+    cy_awsport_ssl_credentials_t credentials;
+    bool secure;                        /* TLS, for HTTPS_PORT */
+    cy_http_client_t handle;
+    volatile bool connected;            /* cleared by the disconnect callback */
+    bool busy;                          /* claimed by a sending task */
+    TickType_t last_used;
+    http_conn_stats_t stats;
+} http_conn_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static http_conn_t http_conn_pool[HTTP_CONN_POOL_SIZE];
+
+/* Guards slot assignment, the busy flags, last_used and the stats. The
+ * client of a slot is only used by the task that has claimed it. */
+static SemaphoreHandle_t http_conn_pool_lock;
+
+/*******************************************************************************
+ * Function Name: http_conn_disconnect_cb
+ *******************************************************************************
+ * Summary:
+ *  Called by the HTTP client library when the server or the network closes
+ *  the connection. The slot is only marked here; the reconnect happens the
+ *  next time the slot is used.
+ *
+ *******************************************************************************/
+static void http_conn_disconnect_cb(cy_http_client_t handle,
+        cy_http_client_disconn_type_t type, void *args)
+{
+    http_conn_t *conn = (http_conn_t *)args;
+
+    printf("\nConnection to %s:%u closed, type=%d\n", conn->host, conn->port, type);
+    conn->connected = false;
+}
+
+/*******************************************************************************
+ * Function Name: http_conn_release
+ *******************************************************************************
+ * Summary:
+ *  Disconnects and deletes the client held by a slot and frees the slot.
+ *
+ *******************************************************************************/
+static void http_conn_release(http_conn_t *conn)
+{
+    if (conn->connected)
+    {
+        (void)cy_http_client_disconnect(conn->handle);
+    }
+    (void)cy_http_client_delete(conn->handle);
+
+    (void)memset(conn, 0, sizeof(*conn));
+}
+
+/*******************************************************************************
+ * Function Name: http_conn_lookup
+ *******************************************************************************
+ * Summary:
+ *  Returns the slot for host:port, creating a client for it if there is none.
+ *  The client speaks TLS when port is HTTPS_PORT. When every slot is taken
+ *  the least recently used one that is not busy is evicted. Call with
+ *  http_conn_pool_lock held.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS with *out NULL if the slot for host:port, or
+ *  every slot, is busy and the caller has to wait
+ *
+ *******************************************************************************/
+static cy_rslt_t http_conn_lookup(const char *host, uint16_t port, http_conn_t **out)
+{
+    http_conn_t *slot = NULL;
+    cy_rslt_t result;
+
+    *out = NULL;
+
+    for (uint32_t i = 0; i < HTTP_CONN_POOL_SIZE; i++)
+    {
+        http_conn_t *conn = &http_conn_pool[i];
+
+        if ((NULL != conn->host) && (conn->port == port) && (0 == strcmp(conn->host, host)))
+        {
+            if (!conn->busy)
+            {
+                *out = conn;
+            }
+            return CY_RSLT_SUCCESS;
+        }
+
+        if (!conn->busy &&
+            ((NULL == slot) || (NULL == conn->host) ||
+             ((NULL != slot->host) && ((int32_t)(conn->last_used - slot->last_used) < 0))))
+        {
+            slot = conn;
+        }
+    }
+
+    if (NULL == slot)
+    {
+        return CY_RSLT_SUCCESS;
+    }
+
+    if (NULL != slot->host)
+    {
+        printf("Evicting connection to %s:%u\n", slot->host, slot->port);
+        http_conn_release(slot);
+    }
+
+    slot->server_info.host_name = host;
+    slot->server_info.port = port;
+    slot->secure = (HTTPS_PORT == port);
+    if (slot->secure)
+    {
+        tls_client_credentials(&slot->credentials, host);
+    }
+
+    result = cy_http_client_create(slot->secure ? &slot->credentials : NULL, &slot->server_info,
+                                   http_conn_disconnect_cb, slot, &slot->handle);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        ERR_INFO(("Failed to create http client for %s.\n", host));
+        return result;
+    }
+
+    slot->host = host;
+    slot->port = port;
+    *out = slot;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+ * Function Name: http_conn_claim
+ *******************************************************************************
+ * Summary:
+ *  Claims the slot for host:port, waiting while another task sends on it or
+ *  while every slot is in use. Release it with http_conn_unclaim().
+ *
+ *******************************************************************************/
+static cy_rslt_t http_conn_claim(const char *host, uint16_t port, http_conn_t **out)
+{
+    cy_rslt_t result;
+
+    for (;;)
+    {
+        (void)xSemaphoreTake(http_conn_pool_lock, portMAX_DELAY);
+        result = http_conn_lookup(host, port, out);
+        if ((CY_RSLT_SUCCESS == result) && (NULL != *out))
+        {
+            (*out)->busy = true;
+        }
+        (void)xSemaphoreGive(http_conn_pool_lock);
+
+        if ((CY_RSLT_SUCCESS != result) || (NULL != *out))
+        {
+            return result;
+        }
+        vTaskDelay(pdMS_TO_TICKS(HTTP_CONN_BUSY_POLL_MS));
+    }
+}
+
+/*******************************************************************************
+ * Function Name: http_conn_unclaim
+ *******************************************************************************
+ * Summary:
+ *  Hands a slot claimed by http_conn_claim() back to the pool.
+ *
+ *******************************************************************************/
+static void http_conn_unclaim(http_conn_t *conn)
+{
+    (void)xSemaphoreTake(http_conn_pool_lock, portMAX_DELAY);
+    conn->busy = false;
+    (void)xSemaphoreGive(http_conn_pool_lock);
+}
+
+/*******************************************************************************
+ * Function Name: http_conn_server_closes
+ *******************************************************************************
+ * Summary:
+ *  Tells whether the response carries "Connection: close", in which case the
+ *  server drops the socket after this response.
+ *
+ *******************************************************************************/
+static bool http_conn_server_closes(const cy_http_client_response_t *response)
+{
+    const char *line = (const char *)response->header;
+    const char *end = line + response->headers_len;
+
+    while (line < end)
+    {
+        const char *eol = memchr(line, '\n', (size_t)(end - line));
+        if (NULL == eol)
+        {
+            eol = end;
+        }
+
+        if (((eol - line) >= 17) && (0 == strncasecmp(line, "Connection:", 11)))
+        {
+            const char *value = line + 11;
+
+            while ((value < eol) && (' ' == *value))
+            {
+                value++;
+            }
+            return (((eol - value) >= 5) && (0 == strncasecmp(value, "close", 5)));
+        }
+
+        line = eol + 1;
+    }
+
+    return false;
+}
+
+/*******************************************************************************
+ * Function Name: http_conn_send
+ *******************************************************************************
+ * Summary:
+ *  The send of http_conn_pool_send() on a slot the calling task has claimed.
+ *
+ *******************************************************************************/
+static cy_rslt_t http_conn_send(http_conn_t *conn,
+                                cy_http_client_request_header_t *request,
+                                cy_http_client_header_t *headers, uint32_t num_headers,
+                                cy_http_client_response_t *response, latency_phase_t phase)
+{
+    const char *host = conn->host;
+    uint16_t port = conn->port;
+    cy_rslt_t result;
+    bool warm;
+
+    do
+    {
+        TickType_t start = xTaskGetTickCount();
+        uint32_t stamp;
+
+        warm = conn->connected;
+        if (!warm)
+        {
+            cy_socket_ip_address_t address;
+            uint32_t handshake;
+
+            /* The connect resolves the name again, from the lwIP DNS cache,
+             * so resolving first only makes the lookup time visible. */
+            stamp = latency_hist_stamp();
+            result = cy_socket_gethostbyname(host, CY_SOCKET_IP_VER_V4, &address);
+            if (CY_RSLT_SUCCESS != result)
+            {
+                ERR_INFO(("Failed to resolve %s.\n", host));
+                return result;
+            }
+            latency_hist_since(LATENCY_PHASE_DNS, stamp);
+
+            stamp = latency_hist_stamp();
+            handshake = conn->secure ? tls_client_handshake_begin() : 0U;
+            result = cy_http_client_connect(conn->handle, HTTP_CONN_TIMEOUT_MS, HTTP_CONN_TIMEOUT_MS);
+            if (conn->secure)
+            {
+                tls_client_handshake_end(host, handshake, CY_RSLT_SUCCESS == result);
+            }
+            if (CY_RSLT_SUCCESS != result)
+            {
+                ERR_INFO(("Failed to connect to %s:%u.\n", host, port));
+                return result;
+            }
+            latency_hist_since(conn->secure ? LATENCY_PHASE_TLS : LATENCY_PHASE_CONNECT, stamp);
+            conn->connected = true;
+        }
+
+        stamp = latency_hist_stamp();
+        result = cy_http_client_write_header(conn->handle, request, headers, num_headers);
+        if (CY_RSLT_SUCCESS == result)
+        {
+            result = cy_http_client_send(conn->handle, request, NULL, 0, response);
+        }
+
+        if (CY_RSLT_SUCCESS == result)
+        {
+            latency_hist_since(phase, stamp);
+            uint32_t elapsed_ms = (uint32_t)((xTaskGetTickCount() - start) * portTICK_PERIOD_MS);
+
+            (void)xSemaphoreTake(http_conn_pool_lock, portMAX_DELAY);
+            if (warm)
+            {
+                conn->stats.warm_requests++;
+                conn->stats.warm_ms_total += elapsed_ms;
+            }
+            else
+            {
+                conn->stats.cold_requests++;
+                conn->stats.cold_ms_total += elapsed_ms;
+            }
+            conn->stats.last_ms = elapsed_ms;
+            conn->stats.last_warm = warm;
+            conn->last_used = xTaskGetTickCount();
+            (void)xSemaphoreGive(http_conn_pool_lock);
+
+            if (http_conn_server_closes(response))
+            {
+                (void)cy_http_client_disconnect(conn->handle);
+                conn->connected = false;
+            }
+            break;
+        }
+
+        /* Drop the socket; the next pass or the next request reconnects. */
+        if (conn->connected)
+        {
+            (void)cy_http_client_disconnect(conn->handle);
+            conn->connected = false;
+        }
+
+        if (warm)
+        {
+            (void)xSemaphoreTake(http_conn_pool_lock, portMAX_DELAY);
+            conn->stats.stale_reconnects++;
+            (void)xSemaphoreGive(http_conn_pool_lock);
+        }
+    } while (warm);
+
+    return result;
+}
+
+/*******************************************************************************
+ * Function Name: http_conn_pool_init
+ *******************************************************************************
+ * Summary:
+ *  Initializes the HTTP client library. Call once after Wi-Fi is up.
+ *
+ * Return:
+ *  cy_rslt_t: result of cy_http_client_init()
+ *
+ *******************************************************************************/
+cy_rslt_t http_conn_pool_init(void)
+{
+    (void)memset(http_conn_pool, 0, sizeof(http_conn_pool));
+
+    http_conn_pool_lock = xSemaphoreCreateMutex();
+    if (NULL == http_conn_pool_lock)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    return cy_http_client_init();
+}
+
+/*******************************************************************************
+ * Function Name: http_conn_pool_send
+ *******************************************************************************
+ * Summary:
+ *  Sends a request to host:port over the pooled connection, connecting first
+ *  if the connection is not up. The slot is claimed for the request and its
+ *  response: a second task sending to the same server waits for it, and a
+ *  busy slot is never evicted. A send that fails on a kept connection is
+ *  taken to mean the server dropped it while idle, and is retried once on a
+ *  fresh connection. The request headers are written by this function.
+ *  The host name lookup and the connect of a new connection are timed into
+ *  their latency histograms, and the request itself into phase. A secure
+ *  connection is kept as long as the server allows, so later requests skip
+ *  the TLS handshake.
+ *
+ * Parameters:
+ *  host: server host name; must stay valid for the life of the pool
+ *  port: server port
+ *  request: request to send, with buffer, method and resource path set
+ *  headers: extra request headers
+ *  num_headers: number of entries in headers
+ *  response: filled in with the response
+ *  phase: latency histogram for the request's round trip
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS or the HTTP client error
+ *
+ *******************************************************************************/
+cy_rslt_t http_conn_pool_send(const char *host, uint16_t port,
+                              cy_http_client_request_header_t *request,
+                              cy_http_client_header_t *headers, uint32_t num_headers,
+                              cy_http_client_response_t *response, latency_phase_t phase)
+{
+    http_conn_t *conn;
+    cy_rslt_t result;
+
+    result = http_conn_claim(host, port, &conn);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    result = http_conn_send(conn, request, headers, num_headers, response, phase);
+    http_conn_unclaim(conn);
+
+    return result;
+}
+
+/*******************************************************************************
+ * Function Name: http_conn_pool_get_stats
+ *******************************************************************************
+ * Summary:
+ *  Copies out the latency counters of the connection to host:port.
+ *
+ * Return:
+ *  bool: false if the pool holds no connection for host:port
+ *
+ *******************************************************************************/
+bool http_conn_pool_get_stats(const char *host, uint16_t port, http_conn_stats_t *stats)
+{
+    bool found = false;
+
+    (void)xSemaphoreTake(http_conn_pool_lock, portMAX_DELAY);
+    for (uint32_t i = 0; i < HTTP_CONN_POOL_SIZE; i++)
+    {
+        const http_conn_t *conn = &http_conn_pool[i];
+
+        if ((NULL != conn->host) && (conn->port == port) && (0 == strcmp(conn->host, host)))
+        {
+            *stats = conn->stats;
+            found = true;
+            break;
+        }
+    }
+    (void)xSemaphoreGive(http_conn_pool_lock);
+
+    return found;
+}
+
+/*******************************************************************************
+ * Function Name: http_conn_pool_print_stats
+ *******************************************************************************
+ * Summary:
+ *  Prints request counts and average latency of warm and cold requests for
+ *  every pooled connection.
+ *
+ *******************************************************************************/
+void http_conn_pool_print_stats(void)
+{
+    for (uint32_t i = 0; i < HTTP_CONN_POOL_SIZE; i++)
+    {
+        const char *host;
+        uint16_t port;
+        http_conn_stats_t stats;
+        const http_conn_stats_t *s = &stats;
+
+        (void)xSemaphoreTake(http_conn_pool_lock, portMAX_DELAY);
+        host = http_conn_pool[i].host;
+        port = http_conn_pool[i].port;
+        stats = http_conn_pool[i].stats;
+        (void)xSemaphoreGive(http_conn_pool_lock);
+
+        if (NULL == host)
+        {
+            continue;
+        }
+
+        printf("%s:%u last %lu ms (%s), warm %lu avg %lu ms, cold %lu avg %lu ms, stale %lu\n",
+               host, port,
+               (unsigned long)s->last_ms, s->last_warm ? "warm" : "cold",
+               (unsigned long)s->warm_requests,
+               (unsigned long)((0u != s->warm_requests) ? (s->warm_ms_total / s->warm_requests) : 0u),
+               (unsigned long)s->cold_requests,
+               (unsigned long)((0u != s->cold_requests) ? (s->cold_ms_total / s->cold_requests) : 0u),
+               (unsigned long)s->stale_reconnects);
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,88 @@
+/******************************************************************************
+*
+* File Name: http_conn_pool.h
+*
+* Description: This file is the public interface of http_conn_pool.c source file
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef HTTP_CONN_POOL_H_
+#define HTTP_CONN_POOL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cy_result.h"
+#include "cy_http_client_api.h"
+#include "latency_hist.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* One slot per server the application talks to: the geolocation API and
+ * the two weather providers. */
+#define HTTP_CONN_POOL_SIZE                      (3U)
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+typedef struct
+{
+    uint32_t warm_requests;     /* sent on a connection kept from earlier */
+    uint32_t cold_requests;     /* needed a new connection first */
+    uint32_t warm_ms_total;     /* request latency summed over warm requests */
+    uint32_t cold_ms_total;     /* connect plus request latency, cold requests */
+    uint32_t stale_reconnects;  /* warm sends that failed and were retried cold */
+    uint32_t last_ms;           /* latency of the most recent request */
+    bool last_warm;
+} http_conn_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+cy_rslt_t http_conn_pool_init(void);
+cy_rslt_t http_conn_pool_send(const char *host, uint16_t port,
+                              cy_http_client_request_header_t *request,
+                              cy_http_client_header_t *headers, uint32_t num_headers,
+                              cy_http_client_response_t *response, latency_phase_t phase);
+bool http_conn_pool_get_stats(const char *host, uint16_t port, http_conn_stats_t *stats);
+void http_conn_pool_print_stats(void);
+
+#endif /* HTTP_CONN_POOL_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,299 @@
+/******************************************************************************
+*
+* File Name: http_header_index.c
+*
+* Description: This file contains the HTTP response header index. It tokenizes a
+* response header block once and keeps the offset and length of each header
+* the application reads, without copying or allocating.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Header file includes */
+#include <string.h>
+#include <strings.h>
+#include "http_header_index.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Name hash: first and fourth character, lower-cased, and length. As in
+ * json_extract.c, a new header that collides is a duplicate case value in
+ * http_header_lookup() and fails to compile. */
+#define HTTP_HDR_LOWER(c)       ((uint32_t)((uint8_t)(c) | 0x20U))
+
+#define HTTP_HDR_HASH(first, fourth, len) \
+    ((HTTP_HDR_LOWER(first) + (HTTP_HDR_LOWER(fourth) << 1) + (uint32_t)(len)) & 15U)
+
+#define HTTP_HDR_CASE(hdr_id, str, first, fourth) \
+    case HTTP_HDR_HASH(first, fourth, sizeof(str) - 1U): \
+        id = hdr_id; id_str = str; id_len = sizeof(str) - 1U; break
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char *const http_hdr_names[HTTP_HDR_COUNT] =
+{
+    [HTTP_HDR_DATE]             = "Date",
+    [HTTP_HDR_ETAG]             = "ETag",
+    [HTTP_HDR_LAST_MODIFIED]    = "Last-Modified",
+    [HTTP_HDR_CACHE_CONTROL]    = "Cache-Control",
+    [HTTP_HDR_CONTENT_LENGTH]   = "Content-Length",
+    [HTTP_HDR_CONTENT_ENCODING] = "Content-Encoding",
+    [HTTP_HDR_EXPIRES]          = "Expires",
+    [HTTP_HDR_CONTENT_RANGE]    = "Content-Range"
+};
+
+/*******************************************************************************
+ * Function Name: http_header_lookup
+ *******************************************************************************
+ * Summary:
+ *  Maps a header name to its http_hdr_t, ignoring case.
+ *
+ * Return:
+ *  http_hdr_t: the header, or HTTP_HDR_COUNT if it is not one we read
+ *
+ *******************************************************************************/
+static http_hdr_t http_header_lookup(const char *name, size_t len)
+{
+    http_hdr_t id;
+    const char *id_str;
+    size_t id_len;
+
+    if (len < 4U)
+    {
+        return HTTP_HDR_COUNT;
+    }
+
+    switch (HTTP_HDR_HASH(name[0], name[3], len))
+    {
+        HTTP_HDR_CASE(HTTP_HDR_DATE,             "Date",             'd', 'e');
+        HTTP_HDR_CASE(HTTP_HDR_ETAG,             "ETag",             'e', 'g');
+        HTTP_HDR_CASE(HTTP_HDR_LAST_MODIFIED,    "Last-Modified",    'l', 't');
+        HTTP_HDR_CASE(HTTP_HDR_CACHE_CONTROL,    "Cache-Control",    'c', 'h');
+        HTTP_HDR_CASE(HTTP_HDR_CONTENT_LENGTH,   "Content-Length",   'c', 't');
+        HTTP_HDR_CASE(HTTP_HDR_CONTENT_ENCODING, "Content-Encoding", 'c', 't');
+        HTTP_HDR_CASE(HTTP_HDR_EXPIRES,          "Expires",          'e', 'i');
+        HTTP_HDR_CASE(HTTP_HDR_CONTENT_RANGE,    "Content-Range",    'c', 't');
+        default:
+            return HTTP_HDR_COUNT;
+    }
+
+    return ((len == id_len) && (0 == strncasecmp(name, id_str, len))) ? id : HTTP_HDR_COUNT;
+}
+
+/*******************************************************************************
+ * Function Name: http_header_index_build
+ *******************************************************************************
+ * Summary:
+ *  Tokenizes a response header block in one pass and records the value of
+ *  each header in http_hdr_t. Lines without a colon, such as the status line,
+ *  are skipped. If a header repeats, the first one wins. The block is not
+ *  copied and must stay in place while the index is used.
+ *
+ * Parameters:
+ *  index: index to fill
+ *  headers: response header block, not NUL-terminated
+ *  headers_len: length of the header block
+ *
+ *******************************************************************************/
+void http_header_index_build(http_header_index_t *index, const uint8_t *headers, size_t headers_len)
+{
+    const char *base = (const char *)headers;
+    const char *line = base;
+    const char *end;
+
+    (void)memset(index, 0, sizeof(*index));
+    index->base = base;
+
+    if (NULL == headers)
+    {
+        return;
+    }
+
+    end = base + ((headers_len > HTTP_HEADER_INDEX_MAX_LEN) ? HTTP_HEADER_INDEX_MAX_LEN : headers_len);
+
+    while (line < end)
+    {
+        const char *eol = memchr(line, '\n', (size_t)(end - line));
+        const char *colon;
+        const char *value;
+        const char *value_end;
+        http_hdr_t id;
+
+        if (NULL == eol)
+        {
+            eol = end;
+        }
+
+        colon = memchr(line, ':', (size_t)(eol - line));
+        if (NULL != colon)
+        {
+            index->lines++;
+
+            id = http_header_lookup(line, (size_t)(colon - line));
+            if ((HTTP_HDR_COUNT != id) && (0U == (index->present & (1U << id))))
+            {
+                value = colon + 1;
+                value_end = eol;
+                while ((value < value_end) && ((' ' == *value) || ('\t' == *value)))
+                {
+                    value++;
+                }
+                while ((value_end > value) &&
+                       (('\r' == value_end[-1]) || (' ' == value_end[-1]) || ('\t' == value_end[-1])))
+                {
+                    value_end--;
+                }
+
+                index->span[id].offset = (uint16_t)(value - base);
+                index->span[id].len = (uint16_t)(value_end - value);
+                index->present |= (uint16_t)(1U << id);
+            }
+        }
+
+        line = eol + 1;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: http_header_index_get
+ *******************************************************************************
+ * Summary:
+ *  Points at the value of a header in the indexed block.
+ *
+ * Parameters:
+ *  index: built index
+ *  id: header
+ *  value: set to the value, which is not NUL-terminated
+ *  len: set to the value length
+ *
+ * Return:
+ *  bool: false if the response did not have the header
+ *
+ *******************************************************************************/
+bool http_header_index_get(const http_header_index_t *index, http_hdr_t id,
+                           const char **value, size_t *len)
+{
+    if (((uint32_t)id >= HTTP_HDR_COUNT) || (0U == (index->present & (1U << id))))
+    {
+        return false;
+    }
+
+    *value = index->base + index->span[id].offset;
+    *len = index->span[id].len;
+    return true;
+}
+
+/*******************************************************************************
+ * Function Name: http_header_index_copy
+ *******************************************************************************
+ * Summary:
+ *  Copies the value of a header into buf as a NUL-terminated string,
+ *  truncated to fit. buf is left untouched if the header is missing.
+ *
+ * Return:
+ *  bool: false if the response did not have the header
+ *
+ *******************************************************************************/
+bool http_header_index_copy(const http_header_index_t *index, http_hdr_t id,
+                            char *buf, size_t size)
+{
+    const char *value;
+    size_t len;
+
+    if ((0U == size) || !http_header_index_get(index, id, &value, &len))
+    {
+        return false;
+    }
+
+    if (len >= size)
+    {
+        len = size - 1U;
+    }
+    (void)memcpy(buf, value, len);
+    buf[len] = '\0';
+    return true;
+}
+
+/*******************************************************************************
+ * Function Name: http_header_index_uint
+ *******************************************************************************
+ * Summary:
+ *  Reads a header whose value is a decimal number, such as Content-Length.
+ *
+ * Return:
+ *  bool: false if the header is missing, not a number or out of range
+ *
+ *******************************************************************************/
+bool http_header_index_uint(const http_header_index_t *index, http_hdr_t id, uint32_t *value)
+{
+    const char *text;
+    size_t len;
+    uint32_t number = 0;
+
+    if (!http_header_index_get(index, id, &text, &len) || (0U == len))
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < len; i++)
+    {
+        uint32_t digit = (uint32_t)(uint8_t)text[i] - (uint32_t)'0';
+
+        if ((digit > 9U) || (number > ((UINT32_MAX - digit) / 10U)))
+        {
+            return false;
+        }
+        number = (number * 10U) + digit;
+    }
+
+    *value = number;
+    return true;
+}
+
+/*******************************************************************************
+ * Function Name: http_header_index_name
+ *******************************************************************************
+ * Summary:
+ *  Canonical name of a header, for requests and the log.
+ *
+ *******************************************************************************/
+const char *http_header_index_name(http_hdr_t id)
+{
+    return ((uint32_t)id < HTTP_HDR_COUNT) ? http_hdr_names[id] : "?";
+}
+
+/* [] END OF FILE */
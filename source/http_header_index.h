@@ -0,0 +1,114 @@
+/******************************************************************************
+*
+* File Name: http_header_index.h
+*
+* Description: This file contains the public interface of the HTTP response header
+* index. One pass over a response header block records where the headers the
+* application reads are, so that later lookups need no further scanning.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef HTTP_HEADER_INDEX_H_
+#define HTTP_HEADER_INDEX_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Offsets and lengths are 16 bits; a longer header block is indexed up to
+ * this length only. */
+#define HTTP_HEADER_INDEX_MAX_LEN                (0xFFFFU)
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+/* Every response header the application reads. */
+typedef enum
+{
+    HTTP_HDR_DATE,
+    HTTP_HDR_ETAG,
+    HTTP_HDR_LAST_MODIFIED,
+    HTTP_HDR_CACHE_CONTROL,
+    HTTP_HDR_CONTENT_LENGTH,
+    HTTP_HDR_CONTENT_ENCODING,
+    HTTP_HDR_EXPIRES,
+    HTTP_HDR_CONTENT_RANGE,
+    HTTP_HDR_COUNT
+} http_hdr_t;
+
+/* Value of one header inside the header block, whitespace trimmed. */
+typedef struct
+{
+    uint16_t offset;
+    uint16_t len;
+} http_hdr_span_t;
+
+typedef struct
+{
+    const char *base;                   /* header block the spans point into */
+    uint16_t present;                   /* bit (1 << http_hdr_t) per header found */
+    uint16_t lines;                     /* header lines seen, for the log */
+    http_hdr_span_t span[HTTP_HDR_COUNT];
+} http_header_index_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void http_header_index_build(http_header_index_t *index, const uint8_t *headers, size_t headers_len);
+bool http_header_index_get(const http_header_index_t *index, http_hdr_t id,
+                           const char **value, size_t *len);
+bool http_header_index_copy(const http_header_index_t *index, http_hdr_t id,
+                            char *buf, size_t size);
+bool http_header_index_uint(const http_header_index_t *index, http_hdr_t id, uint32_t *value);
+const char *http_header_index_name(http_hdr_t id);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* HTTP_HEADER_INDEX_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,311 @@
+/******************************************************************************
+*
+* File Name: http_stream.c
+*
+* Description: This file contains the streaming HTTP receive. A body larger than the
+* receive buffer is fetched as a series of Range requests on the pooled
+* connection, and each piece is passed to a sink before the next one is
+* requested, so the RAM needed does not grow with the body size.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Header file includes */
+#include <stdio.h>
+#include <string.h>
+#include "http_stream.h"
+#include "http_conn_pool.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define HTTP_STATUS_OK                           (200U)
+
+/*******************************************************************************
+ * Function Name: http_stream_parse_uint
+ *******************************************************************************
+ * Summary:
+ *  Reads a decimal number from text up to end.
+ *
+ * Return:
+ *  const char*: first character after the number, or NULL if there is none
+ *
+ *******************************************************************************/
+static const char *http_stream_parse_uint(const char *text, const char *end, uint32_t *value)
+{
+    const char *start = text;
+    uint32_t number = 0;
+
+    while ((text < end) && (*text >= '0') && (*text <= '9'))
+    {
+        uint32_t digit = (uint32_t)(*text - '0');
+
+        if (number > ((UINT32_MAX - digit) / 10U))
+        {
+            return NULL;
+        }
+        number = (number * 10U) + digit;
+        text++;
+    }
+
+    *value = number;
+    return (text != start) ? text : NULL;
+}
+
+/*******************************************************************************
+ * Function Name: http_stream_content_range
+ *******************************************************************************
+ * Summary:
+ *  Parses a "bytes first-last/total" Content-Range. A total of "*" is not
+ *  accepted, as the end of the body could not be known.
+ *
+ *******************************************************************************/
+static bool http_stream_content_range(const http_header_index_t *index,
+                                      uint32_t *first, uint32_t *last, uint32_t *total)
+{
+    const char *value;
+    const char *end;
+    size_t len;
+
+    if (!http_header_index_get(index, HTTP_HDR_CONTENT_RANGE, &value, &len) ||
+        (len < 6U) || (0 != strncmp(value, "bytes ", 6)))
+    {
+        return false;
+    }
+    end = value + len;
+    value += 6;
+
+    value = http_stream_parse_uint(value, end, first);
+    if ((NULL == value) || (value >= end) || ('-' != *value))
+    {
+        return false;
+    }
+    value = http_stream_parse_uint(value + 1, end, last);
+    if ((NULL == value) || (value >= end) || ('/' != *value))
+    {
+        return false;
+    }
+    value = http_stream_parse_uint(value + 1, end, total);
+
+    return (end == value) && (*first <= *last) && (*last < *total);
+}
+
+/*******************************************************************************
+ * Function Name: http_stream_validator
+ *******************************************************************************
+ * Summary:
+ *  Copies the validator of a response that can be sent as If-Range: a strong
+ *  ETag or, failing that, Last-Modified. A weak ETag cannot be used, as
+ *  If-Range needs a strong comparison.
+ *
+ * Return:
+ *  bool: true if the response has one and it fits in buf
+ *
+ *******************************************************************************/
+static bool http_stream_validator(const http_header_index_t *index, char *buf, size_t size)
+{
+    const char *value;
+    size_t len;
+
+    buf[0] = '\0';
+
+    if ((http_header_index_get(index, HTTP_HDR_ETAG, &value, &len) && (len >= 2U) && ('"' == value[0])) ||
+        http_header_index_get(index, HTTP_HDR_LAST_MODIFIED, &value, &len))
+    {
+        if ((0U != len) && (len < size))
+        {
+            (void)memcpy(buf, value, len);
+            buf[len] = '\0';
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*******************************************************************************
+ * Function Name: http_stream_get
+ *******************************************************************************
+ * Summary:
+ *  Sends a request and passes the response body to stream->sink, in pieces
+ *  of at most HTTP_STREAM_CHUNK_LEN bytes. Each piece is a range request
+ *  (request->range_start/range_end) on the pooled connection; a server that
+ *  ignores Range answers 200 with the whole body, which is passed on as one
+ *  piece if it fit in the buffer.
+ *
+ *  The first request always asks for the first piece, even when the whole
+ *  body would fit. When the first response carries a strong ETag or a
+ *  Last-Modified date, the later pieces are sent with it as If-Range and
+ *  must carry it back. A body without one is fetched with plain Range
+ *  requests; every piece must then start where the last one ended and give
+ *  the same total length, but a change that keeps the length is not seen.
+ *
+ *  Responses other than 200 and 206 to the first request, such as 304 or an
+ *  error status, are returned without touching the sink. If the sink stops
+ *  the transfer the function returns success with stream->complete false.
+ *
+ * Parameters:
+ *  stream: sink to use; receives the transfer counters
+ *  host: server host name
+ *  port: server port
+ *  request: request, with its buffer set up
+ *  headers: request headers, with room for HTTP_STREAM_EXTRA_HEADERS more
+ *  num_headers: request headers in use
+ *  response: last response received
+ *  index: headers of the last response
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS, the send error, or CY_RSLT_TYPE_ERROR if the
+ *  pieces do not add up to a consistent body
+ *
+ *******************************************************************************/
+cy_rslt_t http_stream_get(http_stream_t *stream, const char *host, uint16_t port,
+                          cy_http_client_request_header_t *request,
+                          cy_http_client_header_t *headers, uint32_t num_headers,
+                          cy_http_client_response_t *response,
+                          http_header_index_t *index)
+{
+    cy_rslt_t result;
+    uint32_t offset = 0;
+
+    stream->chunks = 0;
+    stream->received = 0;
+    stream->total = 0;
+    stream->complete = false;
+    stream->if_range[0] = '\0';
+
+    for (;;)
+    {
+        uint32_t count = num_headers;
+        uint32_t first;
+        uint32_t last;
+        uint32_t total;
+        char validator[HTTP_STREAM_VALIDATOR_LEN];
+
+        request->range_start = (int32_t)offset;
+        request->range_end = (int32_t)(offset + HTTP_STREAM_CHUNK_LEN - 1U);
+
+        if ((0U != offset) && ('\0' != stream->if_range[0]))
+        {
+            headers[count].field = "If-Range";
+            headers[count].field_len = strlen("If-Range");
+            headers[count].value = stream->if_range;
+            headers[count].value_len = strlen(stream->if_range);
+            count++;
+        }
+
+        /* The first piece carries the time to first byte, the rest the body. */
+        result = http_conn_pool_send(host, port, request, headers, count, response,
+                                     (0U == offset) ? LATENCY_PHASE_TTFB : LATENCY_PHASE_BODY);
+        if (CY_RSLT_SUCCESS != result)
+        {
+            return result;
+        }
+
+        http_header_index_build(index, response->header, response->headers_len);
+        stream->chunks++;
+
+        if (HTTP_STATUS_PARTIAL_CONTENT == response->status_code)
+        {
+            if (!http_stream_content_range(index, &first, &last, &total) ||
+                (first != offset) || ((last - first + 1U) != response->body_len) ||
+                ((0U != offset) && (total != stream->total)))
+            {
+                printf("Inconsistent Content-Range at offset %lu\n", (unsigned long)offset);
+                return CY_RSLT_TYPE_ERROR;
+            }
+            if (0U == offset)
+            {
+                /* With a validator the following pieces are asked for with
+                 * If-Range, so that a body that changes between them comes
+                 * back as a 200 and fails instead of being spliced. */
+                stream->total = total;
+                if (!http_stream_validator(index, stream->if_range, sizeof(stream->if_range)) &&
+                    (total > response->body_len))
+                {
+                    printf("No strong validator, %lu byte body fetched with plain Range\n",
+                           (unsigned long)total);
+                }
+            }
+            else if (('\0' != stream->if_range[0]) &&
+                     (!http_stream_validator(index, validator, sizeof(validator)) ||
+                      (0 != strcmp(validator, stream->if_range))))
+            {
+                /* The server ignored If-Range and sent part of another body. */
+                printf("Validator changed at offset %lu\n", (unsigned long)offset);
+                return CY_RSLT_TYPE_ERROR;
+            }
+        }
+        else if ((HTTP_STATUS_OK == response->status_code) && (0U == offset))
+        {
+            if (http_header_index_uint(index, HTTP_HDR_CONTENT_LENGTH, &total) &&
+                (total > response->body_len))
+            {
+                printf("Response body truncated: %lu of %lu bytes\n",
+                       (unsigned long)response->body_len, (unsigned long)total);
+                return CY_RSLT_TYPE_ERROR;
+            }
+            stream->total = response->body_len;
+        }
+        else if (0U == offset)
+        {
+            return CY_RSLT_SUCCESS;
+        }
+        else
+        {
+            /* 200 here means the body changed since the first piece. */
+            printf("Body transfer broken off at offset %lu, status %u\n",
+                   (unsigned long)offset, (unsigned int)response->status_code);
+            return CY_RSLT_TYPE_ERROR;
+        }
+
+        if ((0U != response->body_len) &&
+            !stream->sink(stream->sink_arg, response->body, response->body_len))
+        {
+            return CY_RSLT_SUCCESS;
+        }
+
+        stream->received += response->body_len;
+        offset += response->body_len;
+
+        if (offset >= stream->total)
+        {
+            stream->complete = true;
+            return CY_RSLT_SUCCESS;
+        }
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,111 @@
+/******************************************************************************
+*
+* File Name: http_stream.h
+*
+* Description: This file contains the public interface of the streaming HTTP receive,
+* which hands a response body to a consumer in fixed-size pieces.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef HTTP_STREAM_H_
+#define HTTP_STREAM_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "cy_result.h"
+#include "cy_http_client_api.h"
+#include "http_header_index.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Body bytes asked for per request. The rest of the receive buffer holds the
+ * request and response headers. */
+#ifndef HTTP_STREAM_CHUNK_LEN
+#define HTTP_STREAM_CHUNK_LEN                    (4096U)
+#endif
+
+/* Request headers http_stream_get() appends: If-Range. */
+#define HTTP_STREAM_EXTRA_HEADERS                (1U)
+
+#define HTTP_STREAM_VALIDATOR_LEN                (64U)
+
+#define HTTP_STATUS_PARTIAL_CONTENT              (206U)
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+/* Receives the body in order, one piece per call. Returns false to stop. */
+typedef bool (*http_stream_sink_t)(void *arg, const uint8_t *data, size_t len);
+
+typedef struct
+{
+    http_stream_sink_t sink;                /* set by the caller */
+    void *sink_arg;
+
+    uint32_t chunks;                        /* responses the body took */
+    uint32_t received;                      /* body bytes passed to the sink */
+    uint32_t total;                         /* length of the whole body */
+    bool complete;                          /* all of it reached the sink */
+
+    char if_range[HTTP_STREAM_VALIDATOR_LEN];  /* If-Range header value; empty if
+                                                * the body has no validator */
+} http_stream_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+cy_rslt_t http_stream_get(http_stream_t *stream, const char *host, uint16_t port,
+                          cy_http_client_request_header_t *request,
+                          cy_http_client_header_t *headers, uint32_t num_headers,
+                          cy_http_client_response_t *response,
+                          http_header_index_t *index);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* HTTP_STREAM_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,984 @@
+/******************************************************************************
+*
+* File Name: inflate_stream.c
+*
+* Description: This file contains a streaming DEFLATE (RFC 1951) decoder with gzip
+* (RFC 1952) and zlib (RFC 1950) framing. Input is accepted in pieces of any
+* size, and output is passed on through a fixed-size window, so neither the
+* compressed nor the decompressed body has to be held in full.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Header file includes */
+#include <string.h>
+#include "inflate_stream.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define INFLATE_WINDOW_MASK                      (INFLATE_WINDOW_SIZE - 1U)
+
+#if ((INFLATE_WINDOW_SIZE & INFLATE_WINDOW_MASK) != 0U) || (INFLATE_WINDOW_SIZE > 32768U)
+#error "INFLATE_WINDOW_SIZE must be a power of two no larger than 32768"
+#endif
+
+#define INFLATE_CODELEN_CODES                    (19U)
+#define INFLATE_ADLER_MOD                        (65521UL)
+#define INFLATE_ADLER_NMAX                       (5552U)
+
+/* gzip header flags */
+#define GZIP_FHCRC                               (0x02U)
+#define GZIP_FEXTRA                              (0x04U)
+#define GZIP_FNAME                               (0x08U)
+#define GZIP_FCOMMENT                            (0x10U)
+#define GZIP_FRESERVED                           (0xE0U)
+
+/* Result of inflate_decode() other than a symbol */
+#define INFLATE_DECODE_MORE                      (-1)
+#define INFLATE_DECODE_BAD                       (-2)
+
+enum
+{
+    MODE_DETECT,            /* INFLATE_FORMAT_DEFLATE: zlib or raw? */
+    MODE_ZLIB_HEADER,
+    MODE_GZIP_HEADER,
+    MODE_GZIP_EXTRA_LEN,
+    MODE_GZIP_EXTRA,
+    MODE_GZIP_NAME,         /* also used for the comment */
+    MODE_GZIP_HCRC,
+    MODE_BLOCK,             /* block header, or the end of the last block */
+    MODE_STORED_LEN,
+    MODE_STORED,
+    MODE_TABLE,             /* dynamic block code counts */
+    MODE_CODELENS,          /* code length code lengths */
+    MODE_LENLENS,           /* literal/length and distance code lengths */
+    MODE_LENLENS_REPEAT,
+    MODE_CODES,
+    MODE_LEN_EXTRA,
+    MODE_DIST,
+    MODE_DIST_EXTRA,
+    MODE_COPY,
+    MODE_TRAILER,
+    MODE_DONE,
+    MODE_ERROR
+};
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const uint16_t inflate_len_base[29] =
+{
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const uint8_t inflate_len_extra[29] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const uint16_t inflate_dist_base[30] =
+{
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+static const uint8_t inflate_dist_extra[30] =
+{
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+static const uint8_t inflate_codelen_order[INFLATE_CODELEN_CODES] =
+{
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+};
+
+/* CRC-32 (IEEE 802.3), four bits at a time */
+static const uint32_t inflate_crc_table[16] =
+{
+    0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL,
+    0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+    0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL,
+    0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL
+};
+
+/*******************************************************************************
+ * Function Name: inflate_need
+ *******************************************************************************
+ * Summary:
+ *  Makes sure at least n bits are in the bit buffer, taking input bytes as
+ *  needed.
+ *
+ * Return:
+ *  bool: false if the input ran out first
+ *
+ *******************************************************************************/
+static bool inflate_need(inflate_stream_t *strm, uint32_t n)
+{
+    while (strm->bit_count < n)
+    {
+        if (0U == strm->in_left)
+        {
+            return false;
+        }
+        strm->bit_buf |= (uint32_t)*strm->in++ << strm->bit_count;
+        strm->in_left--;
+        strm->bit_count += 8U;
+    }
+    return true;
+}
+
+/*******************************************************************************
+ * Function Name: inflate_take
+ *******************************************************************************
+ * Summary:
+ *  Removes n bits from the bit buffer, which must hold them.
+ *
+ *******************************************************************************/
+static uint32_t inflate_take(inflate_stream_t *strm, uint32_t n)
+{
+    uint32_t value = strm->bit_buf & ((1UL << n) - 1UL);
+
+    strm->bit_buf >>= n;
+    strm->bit_count -= n;
+    return value;
+}
+
+/*******************************************************************************
+ * Function Name: inflate_build
+ *******************************************************************************
+ * Summary:
+ *  Builds a canonical Huffman code from code lengths (RFC 1951 3.2.2).
+ *  Incomplete codes are accepted; decoding an unused code fails instead.
+ *
+ * Return:
+ *  bool: false if the lengths are over-subscribed
+ *
+ *******************************************************************************/
+static bool inflate_build(inflate_huffman_t *h, const uint8_t *lengths, uint32_t n)
+{
+    uint16_t offset[INFLATE_MAX_BITS + 1U];
+    int32_t left = 1;
+
+    (void)memset(h->count, 0, sizeof(h->count));
+    for (uint32_t sym = 0; sym < n; sym++)
+    {
+        h->count[lengths[sym]]++;
+    }
+
+    for (uint32_t len = 1; len <= INFLATE_MAX_BITS; len++)
+    {
+        left = (left << 1) - (int32_t)h->count[len];
+        if (left < 0)
+        {
+            return false;
+        }
+    }
+
+    offset[1] = 0;
+    for (uint32_t len = 1; len < INFLATE_MAX_BITS; len++)
+    {
+        offset[len + 1U] = offset[len] + h->count[len];
+    }
+
+    for (uint32_t sym = 0; sym < n; sym++)
+    {
+        if (0U != lengths[sym])
+        {
+            h->symbol[offset[lengths[sym]]++] = (uint16_t)sym;
+        }
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+ * Function Name: inflate_decode
+ *******************************************************************************
+ * Summary:
+ *  Decodes one symbol. Bits are only consumed once the code is complete, so
+ *  a code split across two inflate_stream_feed() calls is simply decoded
+ *  again from the start when the rest arrives.
+ *
+ * Return:
+ *  int32_t: the symbol, INFLATE_DECODE_MORE if the input ran out, or
+ *  INFLATE_DECODE_BAD for a code that is not in the table
+ *
+ *******************************************************************************/
+static int32_t inflate_decode(inflate_stream_t *strm, const inflate_huffman_t *h)
+{
+    int32_t code = 0;
+    int32_t first = 0;
+    int32_t index = 0;
+    uint32_t bits;
+
+    while ((strm->bit_count <= 24U) && (0U != strm->in_left))
+    {
+        strm->bit_buf |= (uint32_t)*strm->in++ << strm->bit_count;
+        strm->in_left--;
+        strm->bit_count += 8U;
+    }
+
+    bits = strm->bit_buf;
+    for (uint32_t len = 1; len <= INFLATE_MAX_BITS; len++)
+    {
+        int32_t count = (int32_t)h->count[len];
+
+        if (len > strm->bit_count)
+        {
+            return INFLATE_DECODE_MORE;
+        }
+
+        code |= (int32_t)(bits & 1U);
+        bits >>= 1;
+        if ((code - count) < first)
+        {
+            (void)inflate_take(strm, len);
+            return (int32_t)h->symbol[index + (code - first)];
+        }
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+
+    return INFLATE_DECODE_BAD;
+}
+
+/*******************************************************************************
+ * Function Name: inflate_flush
+ *******************************************************************************
+ * Summary:
+ *  Passes the output not yet flushed to the sink and adds it to the running
+ *  check value. Called whenever the window wraps, so the unflushed part is
+ *  always contiguous.
+ *
+ *******************************************************************************/
+static bool inflate_flush(inflate_stream_t *strm)
+{
+    const uint8_t *data = &strm->window[strm->flushed & INFLATE_WINDOW_MASK];
+    uint32_t len = strm->total_out - strm->flushed;
+
+    if (0U == len)
+    {
+        return true;
+    }
+
+    if (INFLATE_FORMAT_GZIP == strm->format)
+    {
+        uint32_t crc = strm->check;
+
+        for (uint32_t i = 0; i < len; i++)
+        {
+            crc ^= data[i];
+            crc = (crc >> 4) ^ inflate_crc_table[crc & 0x0FU];
+            crc = (crc >> 4) ^ inflate_crc_table[crc & 0x0FU];
+        }
+        strm->check = crc;
+    }
+    else if (INFLATE_FORMAT_ZLIB == strm->format)
+    {
+        uint32_t a = strm->check & 0xFFFFU;
+        uint32_t b = strm->check >> 16;
+
+        for (uint32_t i = 0; i < len; )
+        {
+            uint32_t end = ((len - i) > INFLATE_ADLER_NMAX) ? (i + INFLATE_ADLER_NMAX) : len;
+
+            for (; i < end; i++)
+            {
+                a += data[i];
+                b += a;
+            }
+            a %= INFLATE_ADLER_MOD;
+            b %= INFLATE_ADLER_MOD;
+        }
+        strm->check = (b << 16) | a;
+    }
+
+    strm->flushed = strm->total_out;
+    return strm->sink(strm->sink_arg, data, len);
+}
+
+/*******************************************************************************
+ * Function Name: inflate_put
+ *******************************************************************************
+ * Summary:
+ *  Appends one output byte to the window.
+ *
+ *******************************************************************************/
+static inline bool inflate_put(inflate_stream_t *strm, uint8_t byte)
+{
+    strm->window[strm->total_out & INFLATE_WINDOW_MASK] = byte;
+    strm->total_out++;
+
+    return (0U != (strm->total_out & INFLATE_WINDOW_MASK)) || inflate_flush(strm);
+}
+
+/*******************************************************************************
+ * Function Name: inflate_fail
+ *******************************************************************************
+ * Summary:
+ *  Stops the stream with an error; later calls return the same error.
+ *
+ *******************************************************************************/
+static inflate_status_t inflate_fail(inflate_stream_t *strm, inflate_status_t status)
+{
+    strm->mode = MODE_ERROR;
+    strm->status = (uint8_t)status;
+    return status;
+}
+
+/*******************************************************************************
+ * Function Name: inflate_gzip_next
+ *******************************************************************************
+ * Summary:
+ *  Moves on to the next optional gzip header field, or to the deflate data.
+ *
+ *******************************************************************************/
+static void inflate_gzip_next(inflate_stream_t *strm)
+{
+    if (0U != (strm->gzip_flags & GZIP_FEXTRA))
+    {
+        strm->gzip_flags &= (uint8_t)~GZIP_FEXTRA;
+        strm->mode = MODE_GZIP_EXTRA_LEN;
+    }
+    else if (0U != (strm->gzip_flags & GZIP_FNAME))
+    {
+        strm->gzip_flags &= (uint8_t)~GZIP_FNAME;
+        strm->mode = MODE_GZIP_NAME;
+    }
+    else if (0U != (strm->gzip_flags & GZIP_FCOMMENT))
+    {
+        strm->gzip_flags &= (uint8_t)~GZIP_FCOMMENT;
+        strm->mode = MODE_GZIP_NAME;
+    }
+    else if (0U != (strm->gzip_flags & GZIP_FHCRC))
+    {
+        strm->gzip_flags &= (uint8_t)~GZIP_FHCRC;
+        strm->mode = MODE_GZIP_HCRC;
+    }
+    else
+    {
+        strm->mode = MODE_BLOCK;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: inflate_fixed_tables
+ *******************************************************************************
+ * Summary:
+ *  Sets up the fixed Huffman codes of block type 1.
+ *
+ *******************************************************************************/
+static void inflate_fixed_tables(inflate_stream_t *strm)
+{
+    uint32_t sym;
+
+    for (sym = 0; sym < 144U; sym++)
+    {
+        strm->lengths[sym] = 8U;
+    }
+    for (; sym < 256U; sym++)
+    {
+        strm->lengths[sym] = 9U;
+    }
+    for (; sym < 280U; sym++)
+    {
+        strm->lengths[sym] = 7U;
+    }
+    for (; sym < INFLATE_MAX_LITLEN_CODES; sym++)
+    {
+        strm->lengths[sym] = 8U;
+    }
+    (void)inflate_build(&strm->litlen, strm->lengths, INFLATE_MAX_LITLEN_CODES);
+
+    (void)memset(strm->lengths, 5, INFLATE_MAX_DIST_CODES);
+    (void)inflate_build(&strm->dist, strm->lengths, INFLATE_MAX_DIST_CODES);
+}
+
+/*******************************************************************************
+ * Function Name: inflate_run
+ *******************************************************************************
+ * Summary:
+ *  Runs the decoder over the current input until it runs out, the stream
+ *  ends or an error occurs. Every mode either completes or returns without
+ *  consuming anything it would need again, so decoding can stop at any input
+ *  byte and resume with the next inflate_stream_feed().
+ *
+ *******************************************************************************/
+static inflate_status_t inflate_run(inflate_stream_t *strm)
+{
+    int32_t sym;
+    uint32_t n;
+
+    for (;;)
+    {
+        switch (strm->mode)
+        {
+            case MODE_DETECT:
+                if (!inflate_need(strm, 16U))
+                {
+                    return INFLATE_OK;
+                }
+                n = strm->bit_buf & 0xFFFFU;
+                if ((8U == (n & 0x0FU)) && ((n & 0xF0U) <= 0x70U) && (0U == (n & 0x2000U)) &&
+                    (0U == ((((n & 0xFFU) << 8) | (n >> 8)) % 31U)))
+                {
+                    strm->format = INFLATE_FORMAT_ZLIB;
+                    strm->check = 1U;
+                    strm->mode = MODE_ZLIB_HEADER;
+                }
+                else
+                {
+                    strm->format = INFLATE_FORMAT_RAW;
+                    strm->mode = MODE_BLOCK;
+                }
+                break;
+
+            case MODE_ZLIB_HEADER:
+                if (!inflate_need(strm, 16U))
+                {
+                    return INFLATE_OK;
+                }
+                n = inflate_take(strm, 16U);
+                if ((8U != (n & 0x0FU)) || ((n & 0xF0U) > 0x70U) || (0U != (n & 0x2000U)) ||
+                    (0U != ((((n & 0xFFU) << 8) | (n >> 8)) % 31U)))
+                {
+                    return inflate_fail(strm, INFLATE_ERR_DATA);
+                }
+                strm->mode = MODE_BLOCK;
+                break;
+
+            case MODE_GZIP_HEADER:
+                /* ID1 ID2 CM FLG MTIME(4) XFL OS */
+                while (strm->count < 10U)
+                {
+                    if (!inflate_need(strm, 8U))
+                    {
+                        return INFLATE_OK;
+                    }
+                    n = inflate_take(strm, 8U);
+                    if (((0U == strm->count) && (0x1FU != n)) ||
+                        ((1U == strm->count) && (0x8BU != n)) ||
+                        ((2U == strm->count) && (8U != n)) ||
+                        ((3U == strm->count) && (0U != (n & GZIP_FRESERVED))))
+                    {
+                        return inflate_fail(strm, INFLATE_ERR_DATA);
+                    }
+                    if (3U == strm->count)
+                    {
+                        strm->gzip_flags = (uint8_t)n;
+                    }
+                    strm->count++;
+                }
+                inflate_gzip_next(strm);
+                break;
+
+            case MODE_GZIP_EXTRA_LEN:
+                if (!inflate_need(strm, 16U))
+                {
+                    return INFLATE_OK;
+                }
+                strm->count = inflate_take(strm, 16U);
+                strm->mode = MODE_GZIP_EXTRA;
+                break;
+
+            case MODE_GZIP_EXTRA:
+                while (0U != strm->count)
+                {
+                    if (!inflate_need(strm, 8U))
+                    {
+                        return INFLATE_OK;
+                    }
+                    (void)inflate_take(strm, 8U);
+                    strm->count--;
+                }
+                inflate_gzip_next(strm);
+                break;
+
+            case MODE_GZIP_NAME:
+                do
+                {
+                    if (!inflate_need(strm, 8U))
+                    {
+                        return INFLATE_OK;
+                    }
+                } while (0U != inflate_take(strm, 8U));
+                inflate_gzip_next(strm);
+                break;
+
+            case MODE_GZIP_HCRC:
+                if (!inflate_need(strm, 16U))
+                {
+                    return INFLATE_OK;
+                }
+                (void)inflate_take(strm, 16U);
+                inflate_gzip_next(strm);
+                break;
+
+            case MODE_BLOCK:
+                if (strm->last_block)
+                {
+                    (void)inflate_take(strm, strm->bit_count & 7U);
+                    strm->count = 0;
+                    strm->value = 0;
+                    strm->mode = MODE_TRAILER;
+                    if (!inflate_flush(strm))
+                    {
+                        return inflate_fail(strm, INFLATE_ERR_SINK);
+                    }
+                    break;
+                }
+                if (!inflate_need(strm, 3U))
+                {
+                    return INFLATE_OK;
+                }
+                strm->last_block = (0U != inflate_take(strm, 1U));
+                switch (inflate_take(strm, 2U))
+                {
+                    case 0U:
+                        (void)inflate_take(strm, strm->bit_count & 7U);
+                        strm->mode = MODE_STORED_LEN;
+                        break;
+                    case 1U:
+                        inflate_fixed_tables(strm);
+                        strm->mode = MODE_CODES;
+                        break;
+                    case 2U:
+                        strm->mode = MODE_TABLE;
+                        break;
+                    default:
+                        return inflate_fail(strm, INFLATE_ERR_DATA);
+                }
+                break;
+
+            case MODE_STORED_LEN:
+                if (!inflate_need(strm, 32U))
+                {
+                    return INFLATE_OK;
+                }
+                strm->count = inflate_take(strm, 16U);
+                if ((strm->count ^ 0xFFFFU) != inflate_take(strm, 16U))
+                {
+                    return inflate_fail(strm, INFLATE_ERR_DATA);
+                }
+                strm->mode = MODE_STORED;
+                break;
+
+            case MODE_STORED:
+                while (0U != strm->count)
+                {
+                    uint8_t byte;
+
+                    if (0U != strm->bit_count)
+                    {
+                        byte = (uint8_t)inflate_take(strm, 8U);
+                    }
+                    else if (0U != strm->in_left)
+                    {
+                        byte = *strm->in++;
+                        strm->in_left--;
+                    }
+                    else
+                    {
+                        return INFLATE_OK;
+                    }
+                    if (!inflate_put(strm, byte))
+                    {
+                        return inflate_fail(strm, INFLATE_ERR_SINK);
+                    }
+                    strm->count--;
+                }
+                strm->mode = MODE_BLOCK;
+                break;
+
+            case MODE_TABLE:
+                if (!inflate_need(strm, 14U))
+                {
+                    return INFLATE_OK;
+                }
+                strm->nlen = (uint16_t)(inflate_take(strm, 5U) + 257U);
+                strm->ndist = (uint16_t)(inflate_take(strm, 5U) + 1U);
+                strm->ncode = (uint16_t)(inflate_take(strm, 4U) + 4U);
+                if ((strm->nlen > 286U) || (strm->ndist > INFLATE_MAX_DIST_CODES))
+                {
+                    return inflate_fail(strm, INFLATE_ERR_DATA);
+                }
+                strm->count = 0;
+                strm->mode = MODE_CODELENS;
+                break;
+
+            case MODE_CODELENS:
+                while (strm->count < strm->ncode)
+                {
+                    if (!inflate_need(strm, 3U))
+                    {
+                        return INFLATE_OK;
+                    }
+                    strm->lengths[inflate_codelen_order[strm->count++]] = (uint8_t)inflate_take(strm, 3U);
+                }
+                for (n = strm->count; n < INFLATE_CODELEN_CODES; n++)
+                {
+                    strm->lengths[inflate_codelen_order[n]] = 0U;
+                }
+                /* The code length code is kept in litlen until the real
+                 * literal/length code replaces it. */
+                if (!inflate_build(&strm->litlen, strm->lengths, INFLATE_CODELEN_CODES))
+                {
+                    return inflate_fail(strm, INFLATE_ERR_DATA);
+                }
+                strm->count = 0;
+                strm->mode = MODE_LENLENS;
+                break;
+
+            case MODE_LENLENS:
+                if (strm->count < (uint32_t)(strm->nlen + strm->ndist))
+                {
+                    sym = inflate_decode(strm, &strm->litlen);
+                    if (INFLATE_DECODE_MORE == sym)
+                    {
+                        return INFLATE_OK;
+                    }
+                    if (sym < 0)
+                    {
+                        return inflate_fail(strm, INFLATE_ERR_DATA);
+                    }
+                    if (sym < 16)
+                    {
+                        strm->lengths[strm->count++] = (uint8_t)sym;
+                    }
+                    else
+                    {
+                        strm->symbol = (uint16_t)sym;
+                        strm->mode = MODE_LENLENS_REPEAT;
+                    }
+                    break;
+                }
+                if ((0U == strm->lengths[256]) ||
+                    !inflate_build(&strm->litlen, strm->lengths, strm->nlen) ||
+                    !inflate_build(&strm->dist, &strm->lengths[strm->nlen], strm->ndist))
+                {
+                    return inflate_fail(strm, INFLATE_ERR_DATA);
+                }
+                strm->mode = MODE_CODES;
+                break;
+
+            case MODE_LENLENS_REPEAT:
+            {
+                uint32_t bits = (16U == strm->symbol) ? 2U : ((17U == strm->symbol) ? 3U : 7U);
+                uint32_t repeat;
+                uint8_t len = 0;
+
+                if (!inflate_need(strm, bits))
+                {
+                    return INFLATE_OK;
+                }
+                repeat = ((18U == strm->symbol) ? 11U : 3U) + inflate_take(strm, bits);
+                if (16U == strm->symbol)
+                {
+                    if (0U == strm->count)
+                    {
+                        return inflate_fail(strm, INFLATE_ERR_DATA);
+                    }
+                    len = strm->lengths[strm->count - 1U];
+                }
+                if ((strm->count + repeat) > (uint32_t)(strm->nlen + strm->ndist))
+                {
+                    return inflate_fail(strm, INFLATE_ERR_DATA);
+                }
+                (void)memset(&strm->lengths[strm->count], len, repeat);
+                strm->count += repeat;
+                strm->mode = MODE_LENLENS;
+                break;
+            }
+
+            case MODE_CODES:
+                sym = inflate_decode(strm, &strm->litlen);
+                if (INFLATE_DECODE_MORE == sym)
+                {
+                    return INFLATE_OK;
+                }
+                if (sym < 0)
+                {
+                    return inflate_fail(strm, INFLATE_ERR_DATA);
+                }
+                if (sym < 256)
+                {
+                    if (!inflate_put(strm, (uint8_t)sym))
+                    {
+                        return inflate_fail(strm, INFLATE_ERR_SINK);
+                    }
+                }
+                else if (256 == sym)
+                {
+                    strm->mode = MODE_BLOCK;
+                }
+                else if ((sym - 257) < 29)
+                {
+                    strm->symbol = (uint16_t)(sym - 257);
+                    strm->mode = MODE_LEN_EXTRA;
+                }
+                else
+                {
+                    return inflate_fail(strm, INFLATE_ERR_DATA);
+                }
+                break;
+
+            case MODE_LEN_EXTRA:
+                n = inflate_len_extra[strm->symbol];
+                if (!inflate_need(strm, n))
+                {
+                    return INFLATE_OK;
+                }
+                strm->copy_len = inflate_len_base[strm->symbol] + inflate_take(strm, n);
+                strm->mode = MODE_DIST;
+                break;
+
+            case MODE_DIST:
+                sym = inflate_decode(strm, &strm->dist);
+                if (INFLATE_DECODE_MORE == sym)
+                {
+                    return INFLATE_OK;
+                }
+                if ((sym < 0) || (sym >= (int32_t)INFLATE_MAX_DIST_CODES))
+                {
+                    return inflate_fail(strm, INFLATE_ERR_DATA);
+                }
+                strm->symbol = (uint16_t)sym;
+                strm->mode = MODE_DIST_EXTRA;
+                break;
+
+            case MODE_DIST_EXTRA:
+                n = inflate_dist_extra[strm->symbol];
+                if (!inflate_need(strm, n))
+                {
+                    return INFLATE_OK;
+                }
+                strm->copy_dist = inflate_dist_base[strm->symbol] + inflate_take(strm, n);
+                if (strm->copy_dist > strm->total_out)
+                {
+                    return inflate_fail(strm, INFLATE_ERR_DATA);
+                }
+                if (strm->copy_dist > INFLATE_WINDOW_SIZE)
+                {
+                    return inflate_fail(strm, INFLATE_ERR_WINDOW);
+                }
+                strm->mode = MODE_COPY;
+                break;
+
+            case MODE_COPY:
+                while (0U != strm->copy_len)
+                {
+                    strm->copy_len--;
+                    if (!inflate_put(strm, strm->window[(strm->total_out - strm->copy_dist) & INFLATE_WINDOW_MASK]))
+                    {
+                        return inflate_fail(strm, INFLATE_ERR_SINK);
+                    }
+                }
+                strm->mode = MODE_CODES;
+                break;
+
+            case MODE_TRAILER:
+                /* gzip: CRC-32 and ISIZE, little-endian. zlib: Adler-32,
+                 * big-endian. Raw: nothing. */
+                n = (INFLATE_FORMAT_GZIP == strm->format) ? 8U : ((INFLATE_FORMAT_ZLIB == strm->format) ? 4U : 0U);
+                while (strm->count < n)
+                {
+                    if (!inflate_need(strm, 8U))
+                    {
+                        return INFLATE_OK;
+                    }
+                    if (INFLATE_FORMAT_GZIP == strm->format)
+                    {
+                        strm->value |= inflate_take(strm, 8U) << (8U * (strm->count & 3U));
+                    }
+                    else
+                    {
+                        strm->value = (strm->value << 8) | inflate_take(strm, 8U);
+                    }
+                    strm->count++;
+
+                    if ((4U == strm->count) || (8U == strm->count))
+                    {
+                        uint32_t expected = (INFLATE_FORMAT_GZIP != strm->format) ? strm->check :
+                                            ((4U == strm->count) ? ~strm->check : strm->total_out);
+
+                        if (strm->value != expected)
+                        {
+                            return inflate_fail(strm, INFLATE_ERR_CHECK);
+                        }
+                        strm->value = 0;
+                    }
+                }
+                strm->mode = MODE_DONE;
+                break;
+
+            case MODE_DONE:
+                return INFLATE_DONE;
+
+            default:
+                return (inflate_status_t)strm->status;
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name: inflate_stream_init
+ *******************************************************************************
+ * Summary:
+ *  Prepares a stream for a new compressed body.
+ *
+ * Parameters:
+ *  strm: stream state, which holds the window
+ *  format: framing of the compressed data
+ *  sink: receives the decompressed data
+ *  sink_arg: passed to sink
+ *
+ *******************************************************************************/
+void inflate_stream_init(inflate_stream_t *strm, inflate_format_t format,
+                         inflate_sink_t sink, void *sink_arg)
+{
+    /* The window is left as it is; nothing is read from it before it is
+     * written. */
+    (void)memset(strm, 0, offsetof(inflate_stream_t, window));
+
+    strm->sink = sink;
+    strm->sink_arg = sink_arg;
+    strm->format = (uint8_t)format;
+    strm->status = (uint8_t)INFLATE_OK;
+
+    switch (format)
+    {
+        case INFLATE_FORMAT_GZIP:
+            strm->check = 0xFFFFFFFFUL;
+            strm->mode = MODE_GZIP_HEADER;
+            break;
+        case INFLATE_FORMAT_ZLIB:
+            strm->check = 1U;
+            strm->mode = MODE_ZLIB_HEADER;
+            break;
+        case INFLATE_FORMAT_DEFLATE:
+            strm->mode = MODE_DETECT;
+            break;
+        default:
+            strm->mode = MODE_BLOCK;
+            break;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: inflate_stream_feed
+ *******************************************************************************
+ * Summary:
+ *  Decompresses the next piece of the body. Everything it yields reaches the
+ *  sink before the call returns. Input after the end of the stream is
+ *  ignored.
+ *
+ * Parameters:
+ *  strm: stream state
+ *  data: next compressed bytes, any length
+ *  len: number of bytes
+ *
+ * Return:
+ *  inflate_status_t: INFLATE_OK if more input is expected, INFLATE_DONE at
+ *  the end of the stream, or an error
+ *
+ *******************************************************************************/
+inflate_status_t inflate_stream_feed(inflate_stream_t *strm, const uint8_t *data, size_t len)
+{
+    inflate_status_t status;
+
+    strm->in = data;
+    strm->in_left = len;
+    strm->total_in += (uint32_t)len;
+
+    status = inflate_run(strm);
+
+    if ((INFLATE_OK == status) && !inflate_flush(strm))
+    {
+        status = inflate_fail(strm, INFLATE_ERR_SINK);
+    }
+
+    strm->in = NULL;
+    strm->in_left = 0;
+    return status;
+}
+
+/*******************************************************************************
+ * Function Name: inflate_stream_finish
+ *******************************************************************************
+ * Summary:
+ *  Called after the last piece of the body.
+ *
+ * Return:
+ *  inflate_status_t: INFLATE_DONE if the stream was complete and its check
+ *  value matched, INFLATE_ERR_DATA if it was cut short, or an earlier error
+ *
+ *******************************************************************************/
+inflate_status_t inflate_stream_finish(inflate_stream_t *strm)
+{
+    if (MODE_DONE == strm->mode)
+    {
+        return INFLATE_DONE;
+    }
+    if (MODE_ERROR == strm->mode)
+    {
+        return (inflate_status_t)strm->status;
+    }
+    return inflate_fail(strm, INFLATE_ERR_DATA);
+}
+
+/*******************************************************************************
+ * Function Name: inflate_stream_status_str
+ *******************************************************************************
+ * Summary:
+ *  Name of a status for the log.
+ *
+ *******************************************************************************/
+const char *inflate_stream_status_str(inflate_status_t status)
+{
+    static const char *const names[] =
+    {
+        [INFLATE_OK]         = "ok",
+        [INFLATE_DONE]       = "done",
+        [INFLATE_ERR_DATA]   = "bad data",
+        [INFLATE_ERR_WINDOW] = "window too small",
+        [INFLATE_ERR_CHECK]  = "check mismatch",
+        [INFLATE_ERR_SINK]   = "aborted"
+    };
+
+    return ((uint32_t)status < (sizeof(names) / sizeof(names[0]))) ? names[status] : "?";
+}
+
+/* [] END OF FILE */
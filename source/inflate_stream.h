@@ -0,0 +1,161 @@
+/******************************************************************************
+*
+* File Name: inflate_stream.h
+*
+* Description: This file contains the public interface of the streaming inflater used
+* to decode gzip and deflate response bodies.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef INFLATE_STREAM_H_
+#define INFLATE_STREAM_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* History kept for back-references, a power of two up to 32768. Servers
+ * compress with the full 32 KB window, but a body no longer than the window
+ * never refers further back than its own start, so a smaller window is
+ * enough for small responses. A stream that refers further back fails with
+ * INFLATE_ERR_WINDOW. */
+#ifndef INFLATE_WINDOW_SIZE
+#define INFLATE_WINDOW_SIZE                      (32768U)
+#endif
+
+#define INFLATE_MAX_BITS                         (15U)
+#define INFLATE_MAX_LITLEN_CODES                 (288U)
+#define INFLATE_MAX_DIST_CODES                   (30U)
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+typedef enum
+{
+    INFLATE_FORMAT_RAW,         /* bare deflate data */
+    INFLATE_FORMAT_ZLIB,        /* zlib header and Adler-32 trailer */
+    INFLATE_FORMAT_GZIP,        /* gzip header and CRC-32 trailer */
+    INFLATE_FORMAT_DEFLATE      /* zlib, or raw if there is no zlib header */
+} inflate_format_t;
+
+typedef enum
+{
+    INFLATE_OK,                 /* all input used, more expected */
+    INFLATE_DONE,               /* end of stream reached and checked */
+    INFLATE_ERR_DATA,           /* malformed or truncated stream */
+    INFLATE_ERR_WINDOW,         /* back-reference beyond INFLATE_WINDOW_SIZE */
+    INFLATE_ERR_CHECK,          /* trailer checksum or length mismatch */
+    INFLATE_ERR_SINK            /* the sink asked to stop */
+} inflate_status_t;
+
+/* Receives decompressed data in order. Returns false to abort. */
+typedef bool (*inflate_sink_t)(void *arg, const uint8_t *data, size_t len);
+
+/* Canonical Huffman code: number of codes per length, and symbols ordered
+ * by code. */
+typedef struct
+{
+    uint16_t count[INFLATE_MAX_BITS + 1U];
+    uint16_t symbol[INFLATE_MAX_LITLEN_CODES];
+} inflate_huffman_t;
+
+typedef struct
+{
+    inflate_sink_t sink;
+    void *sink_arg;
+    uint8_t format;             /* inflate_format_t */
+    uint8_t mode;
+    uint8_t status;             /* inflate_status_t once finished */
+    bool last_block;
+
+    /* Input of the current inflate_stream_feed() call, and bits taken from
+     * it but not used yet. */
+    const uint8_t *in;
+    size_t in_left;
+    uint32_t bit_buf;
+    uint32_t bit_count;
+
+    /* Header, trailer and table reading */
+    uint32_t count;             /* items left or done, depending on mode */
+    uint32_t value;
+    uint8_t gzip_flags;
+    uint16_t nlen;
+    uint16_t ndist;
+    uint16_t ncode;
+    uint16_t symbol;
+    uint8_t lengths[INFLATE_MAX_LITLEN_CODES + INFLATE_MAX_DIST_CODES];
+
+    inflate_huffman_t litlen;
+    inflate_huffman_t dist;
+
+    /* Pending back-reference */
+    uint32_t copy_len;
+    uint32_t copy_dist;
+
+    /* Output */
+    uint32_t check;             /* running CRC-32 or Adler-32 of the output */
+    uint32_t total_out;         /* bytes written into the window */
+    uint32_t flushed;           /* bytes passed to the sink */
+    uint32_t total_in;
+    uint8_t window[INFLATE_WINDOW_SIZE];
+} inflate_stream_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void inflate_stream_init(inflate_stream_t *strm, inflate_format_t format,
+                         inflate_sink_t sink, void *sink_arg);
+inflate_status_t inflate_stream_feed(inflate_stream_t *strm, const uint8_t *data, size_t len);
+inflate_status_t inflate_stream_finish(inflate_stream_t *strm);
+const char *inflate_stream_status_str(inflate_status_t status);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* INFLATE_STREAM_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,514 @@
+/******************************************************************************
+*
+* File Name: json_extract.c
+*
+* Description: This file contains a single-pass JSON field extractor for the
+* geolocation and weather responses. It reads the body in place, in as
+* many pieces as it arrives, and writes the fields it knows straight into
+* their destination structure without allocating or copying the body.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Header file includes */
+#include <string.h>
+#include "json_extract.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Key hash: first character, last character and length. The key set is fixed,
+ * and the case labels in json_extract_lookup_key() are built from it, so a
+ * new key that collides is a duplicate case value and fails to compile. */
+#define JSON_KEY_HASH(first, last, len) \
+    ((((uint32_t)(uint8_t)(first)) + (((uint32_t)(uint8_t)(last)) << 1) + (uint32_t)(len)) & 63U)
+
+#define JSON_KEY_CASE(key_id, str, first, last) \
+    case JSON_KEY_HASH(first, last, sizeof(str) - 1U): \
+        id = key_id; id_str = str; id_len = sizeof(str) - 1U; break
+
+enum
+{
+    JSON_STATE_STRUCT,      /* between tokens */
+    JSON_STATE_KEY,         /* inside a key string */
+    JSON_STATE_STRING,      /* inside a string value */
+    JSON_STATE_LITERAL      /* inside a number, true, false or null */
+};
+
+/*******************************************************************************
+ * Function Name: json_extract_lookup_key
+ *******************************************************************************
+ * Summary:
+ *  Maps a key to its json_key_t with one hash and one compare.
+ *
+ * Parameters:
+ *  key: key characters, not NUL-terminated
+ *  len: number of characters
+ *
+ * Return:
+ *  json_key_t: the key, or JSON_KEY_NONE if it is not one of ours
+ *
+ *******************************************************************************/
+json_key_t json_extract_lookup_key(const char *key, size_t len)
+{
+    json_key_t id;
+    const char *id_str;
+    size_t id_len;
+
+    if (0U == len)
+    {
+        return JSON_KEY_NONE;
+    }
+
+    switch (JSON_KEY_HASH(key[0], key[len - 1U], len))
+    {
+        JSON_KEY_CASE(JSON_KEY_IP,                   "ip",                   'i', 'p');
+        JSON_KEY_CASE(JSON_KEY_LOC,                  "loc",                  'l', 'c');
+        JSON_KEY_CASE(JSON_KEY_CITY,                 "city",                 'c', 'y');
+        JSON_KEY_CASE(JSON_KEY_TIMEZONE,             "timezone",             't', 'e');
+        JSON_KEY_CASE(JSON_KEY_CURRENT,              "current",              'c', 't');
+        JSON_KEY_CASE(JSON_KEY_TEMPERATURE_2M,       "temperature_2m",       't', 'm');
+        JSON_KEY_CASE(JSON_KEY_RELATIVE_HUMIDITY_2M, "relative_humidity_2m", 'r', 'm');
+        JSON_KEY_CASE(JSON_KEY_WIND_SPEED_10M,       "wind_speed_10m",       'w', 'm');
+        JSON_KEY_CASE(JSON_KEY_WEATHER_CODE,         "weather_code",         'w', 'e');
+        JSON_KEY_CASE(JSON_KEY_TIME,                 "time",                 't', 'e');
+        JSON_KEY_CASE(JSON_KEY_INTERVAL,             "interval",             'i', 'l');
+        JSON_KEY_CASE(JSON_KEY_CURRENT_CONDITION,    "current_condition",    'c', 'n');
+        JSON_KEY_CASE(JSON_KEY_TEMP_C,               "temp_C",               't', 'C');
+        JSON_KEY_CASE(JSON_KEY_HUMIDITY,             "humidity",             'h', 'y');
+        JSON_KEY_CASE(JSON_KEY_WINDSPEED_KMPH,       "windspeedKmph",        'w', 'h');
+        JSON_KEY_CASE(JSON_KEY_WEATHERCODE,          "weatherCode",          'w', 'e');
+        default:
+            return JSON_KEY_NONE;
+    }
+
+    return ((len == id_len) && (0 == memcmp(key, id_str, len))) ? id : JSON_KEY_NONE;
+}
+
+/*******************************************************************************
+ * Function Name: json_begin_value
+ *******************************************************************************
+ * Summary:
+ *  Points the value sink at the destination of the current key, if the key
+ *  is in the schema and sits in the object the schema expects it in.
+ *
+ *******************************************************************************/
+static void json_begin_value(json_extract_t *ctx)
+{
+    const json_field_t *field;
+
+    ctx->field = NULL;
+
+    if ((JSON_KEY_NONE == ctx->key) || (0U == ctx->depth) ||
+        ('{' != ctx->container[ctx->depth - 1U]))
+    {
+        return;
+    }
+
+    field = &ctx->schema[ctx->key];
+    if ((JSON_FIELD_NONE == field->type) || (field->parent != ctx->opener[ctx->depth - 1U]))
+    {
+        return;
+    }
+
+    ctx->field = field;
+    ctx->dst = (char *)(ctx->target + field->offset);
+    ctx->dst_left = (uint16_t)(field->size - 1U);
+    ctx->second = false;
+    ctx->negative = false;
+    ctx->fraction = false;
+    ctx->number = 0;
+}
+
+/*******************************************************************************
+ * Function Name: json_truncate
+ *******************************************************************************
+ * Summary:
+ *  Called for each character of a text value that no longer fits. Drops a
+ *  multi-byte UTF-8 character whose tail did not fit, so the text never ends
+ *  in half a character, and flags the key in fields_truncated.
+ *
+ *******************************************************************************/
+static void json_truncate(json_extract_t *ctx)
+{
+    const json_field_t *field = ctx->field;
+    char *start = (char *)(ctx->target + (ctx->second ? field->offset2 : field->offset));
+    char *lead = ctx->dst;
+    uint8_t tail = 0U;
+
+    while ((lead > start) && (0x80U == ((uint8_t)lead[-1] & 0xC0U)))
+    {
+        lead--;
+        tail++;
+    }
+    if (lead > start)
+    {
+        uint8_t b = (uint8_t)lead[-1];
+        uint8_t need = (b >= 0xF0U) ? 3U : (b >= 0xE0U) ? 2U : (b >= 0xC0U) ? 1U : 0U;
+
+        if (tail < need)
+        {
+            ctx->dst = lead - 1;
+        }
+    }
+
+    ctx->fields_truncated |= 1UL << (uint32_t)(field - ctx->schema);
+}
+
+/*******************************************************************************
+ * Function Name: json_emit
+ *******************************************************************************
+ * Summary:
+ *  Feeds one character of the current value to its destination.
+ *
+ *******************************************************************************/
+static void json_emit(json_extract_t *ctx, char c)
+{
+    const json_field_t *field = ctx->field;
+
+    if (NULL == field)
+    {
+        return;
+    }
+
+    if (JSON_FIELD_INT32 == field->type)
+    {
+        if ('-' == c)
+        {
+            ctx->negative = true;
+        }
+        else if ('.' == c)
+        {
+            ctx->fraction = true;
+        }
+        else if ((c >= '0') && (c <= '9') && !ctx->fraction && (ctx->number < 100000000))
+        {
+            ctx->number = (ctx->number * 10) + (c - '0');
+        }
+        return;
+    }
+
+    if ((JSON_FIELD_COORDS == field->type) && (',' == c) && !ctx->second)
+    {
+        *ctx->dst = '\0';
+        ctx->dst = (char *)(ctx->target + field->offset2);
+        ctx->dst_left = (uint16_t)(field->size - 1U);
+        ctx->second = true;
+        return;
+    }
+
+    if (0U != ctx->dst_left)
+    {
+        *ctx->dst++ = c;
+        ctx->dst_left--;
+    }
+    else
+    {
+        json_truncate(ctx);
+    }
+}
+
+/*******************************************************************************
+ * Function Name: json_end_value
+ *******************************************************************************
+ * Summary:
+ *  Terminates the current value and counts it.
+ *
+ *******************************************************************************/
+static void json_end_value(json_extract_t *ctx)
+{
+    const json_field_t *field = ctx->field;
+
+    if (NULL == field)
+    {
+        return;
+    }
+
+    if (JSON_FIELD_INT32 == field->type)
+    {
+        int32_t value = ctx->negative ? -ctx->number : ctx->number;
+        memcpy(ctx->target + field->offset, &value, sizeof(value));
+    }
+    else
+    {
+        *ctx->dst = '\0';
+    }
+
+    ctx->fields_set++;
+    ctx->field = NULL;
+}
+
+/*******************************************************************************
+ * Function Name: json_extract_init
+ *******************************************************************************
+ * Summary:
+ *  Prepares a parser for one document.
+ *
+ * Parameters:
+ *  ctx: parser state
+ *  schema: JSON_KEY_COUNT field descriptors, indexed by json_key_t
+ *  target: structure the schema offsets refer to
+ *
+ *******************************************************************************/
+void json_extract_init(json_extract_t *ctx, const json_field_t *schema, void *target)
+{
+    (void)memset(ctx, 0, sizeof(*ctx));
+    ctx->schema = schema;
+    ctx->target = (uint8_t *)target;
+    ctx->state = JSON_STATE_STRUCT;
+}
+
+/*******************************************************************************
+ * Function Name: json_extract_feed
+ *******************************************************************************
+ * Summary:
+ *  Runs the next piece of the document through the parser. The document may
+ *  be split anywhere. Values are written to the target as they are read, so
+ *  the piece does not need to stay valid after the call.
+ *
+ * Parameters:
+ *  ctx: parser state
+ *  data: next bytes of the document
+ *  len: number of bytes
+ *
+ * Return:
+ *  bool: false once the document is found to be malformed
+ *
+ *******************************************************************************/
+bool json_extract_feed(json_extract_t *ctx, const char *data, size_t len)
+{
+    const char *end = data + len;
+
+    while ((data < end) && !ctx->error)
+    {
+        char c = *data;
+
+        switch (ctx->state)
+        {
+            case JSON_STATE_KEY:
+                if (!ctx->escape)
+                {
+                    /* Take the run of plain characters in one go. */
+                    while ((data < end) && ('"' != *data) && ('\\' != *data))
+                    {
+                        if (ctx->key_len < JSON_EXTRACT_KEY_MAX)
+                        {
+                            ctx->key_buf[ctx->key_len++] = *data;
+                        }
+                        data++;
+                    }
+                    if (data == end)
+                    {
+                        continue;
+                    }
+                    c = *data;
+                }
+
+                if (ctx->escape)
+                {
+                    /* Escaped keys are never ours; make sure it won't match. */
+                    ctx->escape = false;
+                    ctx->key_len = JSON_EXTRACT_KEY_MAX;
+                }
+                else if ('\\' == c)
+                {
+                    ctx->escape = true;
+                }
+                else if ('"' == c)
+                {
+                    ctx->key = (ctx->key_len < JSON_EXTRACT_KEY_MAX) ?
+                               json_extract_lookup_key(ctx->key_buf, ctx->key_len) : JSON_KEY_NONE;
+                    ctx->expect_key = false;
+                    ctx->state = JSON_STATE_STRUCT;
+                }
+                else if (ctx->key_len < JSON_EXTRACT_KEY_MAX)
+                {
+                    ctx->key_buf[ctx->key_len++] = c;
+                }
+                break;
+
+            case JSON_STATE_STRING:
+                if (!ctx->escape)
+                {
+                    const char *run = data;
+
+                    while ((data < end) && ('"' != *data) && ('\\' != *data))
+                    {
+                        data++;
+                    }
+                    if (NULL != ctx->field)
+                    {
+                        for (; run < data; run++)
+                        {
+                            json_emit(ctx, *run);
+                        }
+                    }
+                    if (data == end)
+                    {
+                        continue;
+                    }
+                    c = *data;
+                }
+
+                if (ctx->escape)
+                {
+                    static const char escaped[] = "\"\"\\\\//b\bf\fn\nr\rt\t";
+                    const char *match = memchr(escaped, c, sizeof(escaped) - 1U);
+
+                    /* \uXXXX comes out as uXXXX; none of our values use it. */
+                    json_emit(ctx, ((NULL != match) && (0 == ((match - escaped) & 1))) ? match[1] : c);
+                    ctx->escape = false;
+                }
+                else if ('\\' == c)
+                {
+                    ctx->escape = true;
+                }
+                else if ('"' == c)
+                {
+                    json_end_value(ctx);
+                    ctx->state = JSON_STATE_STRUCT;
+                }
+                else
+                {
+                    json_emit(ctx, c);
+                }
+                break;
+
+            case JSON_STATE_LITERAL:
+                while ((data < end) && (',' != *data) && ('}' != *data) && (']' != *data) &&
+                       (' ' != *data) && ('\t' != *data) && ('\r' != *data) && ('\n' != *data))
+                {
+                    json_emit(ctx, *data++);
+                }
+                if (data < end)
+                {
+                    json_end_value(ctx);
+                    ctx->state = JSON_STATE_STRUCT;
+                }
+                continue;   /* the delimiter is handled as structure */
+
+            default:
+                if (('{' == c) || ('[' == c))
+                {
+                    if (ctx->depth >= JSON_EXTRACT_MAX_DEPTH)
+                    {
+                        ctx->error = true;
+                        break;
+                    }
+                    /* An element of an array counts as opened by the key
+                     * of the array, so "a":[{"b":1}] puts b under a. */
+                    ctx->container[ctx->depth] = (uint8_t)c;
+                    if (0U == ctx->depth)
+                    {
+                        ctx->opener[ctx->depth] = JSON_KEY_ROOT;
+                    }
+                    else if ('[' == ctx->container[ctx->depth - 1U])
+                    {
+                        ctx->opener[ctx->depth] = ctx->opener[ctx->depth - 1U];
+                    }
+                    else
+                    {
+                        ctx->opener[ctx->depth] = (uint8_t)ctx->key;
+                    }
+                    ctx->depth++;
+                    ctx->expect_key = ('{' == c);
+                    ctx->key = JSON_KEY_NONE;
+                }
+                else if (('}' == c) || (']' == c))
+                {
+                    if ((0U == ctx->depth) || (ctx->container[ctx->depth - 1U] != (uint8_t)(c - 2)))
+                    {
+                        ctx->error = true;  /* '}' - 2 == '{', ']' - 2 == '[' */
+                        break;
+                    }
+                    ctx->depth--;
+                    ctx->expect_key = false;
+                    ctx->key = JSON_KEY_NONE;
+                }
+                else if (',' == c)
+                {
+                    ctx->expect_key = (0U != ctx->depth) && ('{' == ctx->container[ctx->depth - 1U]);
+                }
+                else if ('"' == c)
+                {
+                    if (ctx->expect_key)
+                    {
+                        ctx->key_len = 0;
+                        ctx->state = JSON_STATE_KEY;
+                    }
+                    else
+                    {
+                        json_begin_value(ctx);
+                        ctx->state = JSON_STATE_STRING;
+                    }
+                }
+                else if ((':' != c) && (' ' != c) && ('\t' != c) && ('\r' != c) && ('\n' != c))
+                {
+                    json_begin_value(ctx);
+                    ctx->state = JSON_STATE_LITERAL;
+                    json_emit(ctx, c);
+                }
+                break;
+        }
+
+        data++;
+    }
+
+    return !ctx->error;
+}
+
+/*******************************************************************************
+ * Function Name: json_extract_finish
+ *******************************************************************************
+ * Summary:
+ *  Ends the document: completes a trailing literal and checks that every
+ *  object and array was closed.
+ *
+ * Return:
+ *  bool: true if the document was complete and well nested
+ *
+ *******************************************************************************/
+bool json_extract_finish(json_extract_t *ctx)
+{
+    if (JSON_STATE_LITERAL == ctx->state)
+    {
+        json_end_value(ctx);
+        ctx->state = JSON_STATE_STRUCT;
+    }
+
+    return !ctx->error && (0U == ctx->depth) && (JSON_STATE_STRUCT == ctx->state);
+}
+
+/* [] END OF FILE */
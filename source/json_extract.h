@@ -0,0 +1,157 @@
+/******************************************************************************
+*
+* File Name: json_extract.h
+*
+* Description: This file is the public interface of json_extract.c source file
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef JSON_EXTRACT_H_
+#define JSON_EXTRACT_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Deepest object/array nesting followed; anything deeper is an error. */
+#define JSON_EXTRACT_MAX_DEPTH                   (8U)
+
+/* Longest key that can match. Longer keys are skipped without being held. */
+#define JSON_EXTRACT_KEY_MAX                     (24U)
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+/* Every key the application reads from any payload. */
+typedef enum
+{
+    JSON_KEY_NONE = 0,
+    JSON_KEY_IP,
+    JSON_KEY_LOC,
+    JSON_KEY_CITY,
+    JSON_KEY_TIMEZONE,
+    JSON_KEY_CURRENT,
+    JSON_KEY_TEMPERATURE_2M,
+    JSON_KEY_RELATIVE_HUMIDITY_2M,
+    JSON_KEY_WIND_SPEED_10M,
+    JSON_KEY_WEATHER_CODE,
+    JSON_KEY_TIME,
+    JSON_KEY_INTERVAL,
+    JSON_KEY_CURRENT_CONDITION,
+    JSON_KEY_TEMP_C,
+    JSON_KEY_HUMIDITY,
+    JSON_KEY_WINDSPEED_KMPH,
+    JSON_KEY_WEATHERCODE,
+    JSON_KEY_COUNT,
+    JSON_KEY_ROOT = JSON_KEY_COUNT   /* parent of top-level members */
+} json_key_t;
+
+typedef enum
+{
+    JSON_FIELD_NONE = 0,    /* key is not extracted */
+    JSON_FIELD_TEXT,        /* value text, NUL-terminated, truncated to size
+                             * on a UTF-8 character boundary */
+    JSON_FIELD_INT32,       /* integer part of a number */
+    JSON_FIELD_COORDS       /* "lat,lon" string split into two text fields */
+} json_field_type_t;
+
+/* Where one key's value goes in the target structure. A schema is an array
+ * of JSON_KEY_COUNT of these, indexed by json_key_t. */
+typedef struct
+{
+    uint8_t type;           /* json_field_type_t */
+    uint8_t parent;         /* json_key_t of the enclosing object, or of the
+                             * array holding it */
+    uint16_t offset;        /* offsetof() the destination */
+    uint16_t size;          /* sizeof() a text destination */
+    uint16_t offset2;       /* second destination of JSON_FIELD_COORDS */
+} json_field_t;
+
+/* Parser state kept between json_extract_feed() calls. */
+typedef struct
+{
+    const json_field_t *schema;
+    uint8_t *target;
+
+    uint8_t state;
+    uint8_t depth;
+    bool expect_key;
+    bool escape;
+    bool error;
+    uint8_t container[JSON_EXTRACT_MAX_DEPTH];  /* '{' or '[' */
+    uint8_t opener[JSON_EXTRACT_MAX_DEPTH];     /* key that opened the level */
+
+    json_key_t key;
+    uint8_t key_len;
+    char key_buf[JSON_EXTRACT_KEY_MAX];
+
+    const json_field_t *field;  /* destination of the value being read */
+    char *dst;
+    uint16_t dst_left;
+    bool second;
+    bool negative;
+    bool fraction;
+    int32_t number;
+
+    uint32_t fields_set;
+    uint32_t fields_truncated;  /* bit per json_key_t of text cut to size */
+} json_extract_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void json_extract_init(json_extract_t *ctx, const json_field_t *schema, void *target);
+bool json_extract_feed(json_extract_t *ctx, const char *data, size_t len);
+bool json_extract_finish(json_extract_t *ctx);
+json_key_t json_extract_lookup_key(const char *key, size_t len);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* JSON_EXTRACT_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,386 @@
+/******************************************************************************
+*
+* File Name: latency_hist.c
+*
+* Description: This file contains the network latency histograms: DWT
+* cycle timestamps, the log2 bucket counters of each request phase, the text
+* report and the binary export.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Header file includes */
+#include <stdio.h>
+#include <string.h>
+#include "cy_pdl.h"
+
+/* FreeRTOS header file */
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "latency_hist.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define LATENCY_HIST_CRC_INIT                    (0xFFFFU)
+#define LATENCY_HIST_CRC_POLY                    (0x1021U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Written by the HTTPS task and the weather lanes, so every update and copy
+ * is done in a critical section. */
+static latency_hist_t latency_hists[LATENCY_PHASE_COUNT];
+
+static const char *const latency_phase_names[LATENCY_PHASE_COUNT] =
+{
+    "dns", "connect", "tls", "ttfb", "body", "parse"
+};
+
+/*******************************************************************************
+ * Function Name: latency_hist_init
+ *******************************************************************************
+ * Summary:
+ *  Starts the DWT cycle counter the phase timestamps are taken from and
+ *  clears the histograms.
+ *
+ *******************************************************************************/
+void latency_hist_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    latency_hist_reset();
+}
+
+/*******************************************************************************
+ * Function Name: latency_hist_stamp
+ *******************************************************************************
+ * Summary:
+ *  Returns a timestamp for latency_hist_since(). The cycle counter wraps
+ *  after about 28 s at 150 MHz, well past the transport timeout.
+ *
+ *******************************************************************************/
+uint32_t latency_hist_stamp(void)
+{
+    return DWT->CYCCNT;
+}
+
+/*******************************************************************************
+ * Function Name: latency_hist_since
+ *******************************************************************************
+ * Summary:
+ *  Records the time from stamp until now under phase.
+ *
+ *******************************************************************************/
+void latency_hist_since(latency_phase_t phase, uint32_t stamp)
+{
+    latency_hist_record_cycles(phase, DWT->CYCCNT - stamp);
+}
+
+/*******************************************************************************
+ * Function Name: latency_hist_record_cycles
+ *******************************************************************************
+ * Summary:
+ *  Records a duration given in CPU cycles under phase.
+ *
+ *******************************************************************************/
+void latency_hist_record_cycles(latency_phase_t phase, uint32_t cycles)
+{
+    latency_hist_record(phase, cycles / (SystemCoreClock / 1000000UL));
+}
+
+/*******************************************************************************
+ * Function Name: latency_hist_bucket
+ *******************************************************************************
+ * Summary:
+ *  Returns the log2 bucket of a duration in microseconds.
+ *
+ *******************************************************************************/
+static uint32_t latency_hist_bucket(uint32_t us)
+{
+    uint32_t bucket;
+
+    if (us < (1UL << LATENCY_HIST_FIRST_LOG2))
+    {
+        return 0U;
+    }
+
+    bucket = (31U - __CLZ(us)) - (LATENCY_HIST_FIRST_LOG2 - 1U);
+    return (bucket < LATENCY_HIST_BUCKETS) ? bucket : (LATENCY_HIST_BUCKETS - 1U);
+}
+
+/*******************************************************************************
+ * Function Name: latency_hist_record
+ *******************************************************************************
+ * Summary:
+ *  Records a duration given in microseconds under phase.
+ *
+ *******************************************************************************/
+void latency_hist_record(latency_phase_t phase, uint32_t us)
+{
+    latency_hist_t *hist = &latency_hists[phase];
+    uint32_t bucket = latency_hist_bucket(us);
+
+    taskENTER_CRITICAL();
+    hist->count++;
+    hist->sum_ms += (us + 500U) / 1000U;
+    if (us > hist->max_us)
+    {
+        hist->max_us = us;
+    }
+    hist->buckets[bucket]++;
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+ * Function Name: latency_hist_get
+ *******************************************************************************
+ * Summary:
+ *  Copies out the histogram of one phase.
+ *
+ *******************************************************************************/
+void latency_hist_get(latency_phase_t phase, latency_hist_t *hist)
+{
+    taskENTER_CRITICAL();
+    *hist = latency_hists[phase];
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+ * Function Name: latency_hist_reset
+ *******************************************************************************
+ * Summary:
+ *  Clears every histogram.
+ *
+ *******************************************************************************/
+void latency_hist_reset(void)
+{
+    taskENTER_CRITICAL();
+    (void)memset(latency_hists, 0, sizeof(latency_hists));
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+ * Function Name: latency_hist_percentile
+ *******************************************************************************
+ * Summary:
+ *  Returns the upper bound, in microseconds, of the bucket holding the given
+ *  percentile (nearest rank), but no more than the largest value seen.
+ *
+ *******************************************************************************/
+static uint32_t latency_hist_percentile(const latency_hist_t *hist, uint32_t percent)
+{
+    uint32_t rank = ((hist->count * percent) + 99U) / 100U;
+    uint32_t seen = 0;
+
+    for (uint32_t b = 0; b < LATENCY_HIST_BUCKETS; b++)
+    {
+        seen += hist->buckets[b];
+        if ((seen >= rank) && (b < (LATENCY_HIST_BUCKETS - 1U)))
+        {
+            uint32_t bound = 1UL << (b + LATENCY_HIST_FIRST_LOG2);
+            return (bound < hist->max_us) ? bound : hist->max_us;
+        }
+    }
+
+    return hist->max_us;
+}
+
+/*******************************************************************************
+ * Function Name: latency_hist_print
+ *******************************************************************************
+ * Summary:
+ *  Prints count, average, p50, p95 and maximum of every phase, followed by
+ *  its bucket counts. The percentiles are bucket bounds, so at most twice
+ *  the true value.
+ *
+ *******************************************************************************/
+void latency_hist_print(void)
+{
+    latency_hist_t hist;
+
+    printf("\nphase      count   avg ms  p50<= us  p95<= us    max us\n");
+    for (uint32_t p = 0; p < LATENCY_PHASE_COUNT; p++)
+    {
+        latency_hist_get((latency_phase_t)p, &hist);
+
+        printf("%-8s %7lu %8lu %9lu %9lu %9lu\n", latency_phase_names[p],
+               (unsigned long)hist.count,
+               (unsigned long)((0U != hist.count) ? (hist.sum_ms / hist.count) : 0U),
+               (unsigned long)latency_hist_percentile(&hist, 50U),
+               (unsigned long)latency_hist_percentile(&hist, 95U),
+               (unsigned long)hist.max_us);
+        if (0U != hist.count)
+        {
+            printf("        ");
+            for (uint32_t b = 0; b < LATENCY_HIST_BUCKETS; b++)
+            {
+                printf(" %lu", (unsigned long)hist.buckets[b]);
+            }
+            printf("\n");
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name: latency_hist_put_u16
+ *******************************************************************************
+ * Summary:
+ *  Writes value little-endian for the binary export.
+ *
+ *******************************************************************************/
+static uint8_t *latency_hist_put_u16(uint8_t *out, uint32_t value)
+{
+    out[0] = (uint8_t)value;
+    out[1] = (uint8_t)(value >> 8);
+    return out + 2;
+}
+
+/*******************************************************************************
+ * Function Name: latency_hist_put_u32
+ *******************************************************************************
+ * Summary:
+ *  Writes value little-endian for the binary export.
+ *
+ *******************************************************************************/
+static uint8_t *latency_hist_put_u32(uint8_t *out, uint32_t value)
+{
+    out = latency_hist_put_u16(out, value & 0xFFFFU);
+    return latency_hist_put_u16(out, value >> 16);
+}
+
+/*******************************************************************************
+ * Function Name: latency_hist_crc16
+ *******************************************************************************
+ * Summary:
+ *  CRC-16/CCITT-FALSE over len bytes.
+ *
+ *******************************************************************************/
+static uint16_t latency_hist_crc16(const uint8_t *data, size_t len)
+{
+    uint16_t crc = LATENCY_HIST_CRC_INIT;
+
+    for (size_t i = 0; i < len; i++)
+    {
+        crc ^= (uint16_t)((uint16_t)data[i] << 8);
+        for (uint32_t bit = 0; bit < 8U; bit++)
+        {
+            crc = ((crc & 0x8000U) != 0U) ? (uint16_t)((crc << 1) ^ LATENCY_HIST_CRC_POLY)
+                                          : (uint16_t)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+/*******************************************************************************
+ * Function Name: latency_hist_export
+ *******************************************************************************
+ * Summary:
+ *  Writes every histogram into buf as one binary record, little-endian:
+ *
+ *    0  "LH", version, phase count, bucket count, log2 of bucket 0's bound,
+ *       2 bytes reserved, uptime in seconds (u32)
+ *   12  per phase: count, sum in ms and maximum in us (u32 each), then the
+ *       bucket counts (u16 each, saturating)
+ *  end  CRC-16/CCITT-FALSE of everything before it
+ *
+ *  scripts/latency_decode.py reads it back.
+ *
+ * Return:
+ *  size_t: LATENCY_HIST_EXPORT_LEN, or 0 if buf is too small
+ *
+ *******************************************************************************/
+size_t latency_hist_export(uint8_t *buf, size_t size)
+{
+    latency_hist_t hist;
+    uint8_t *out = buf;
+
+    if (size < LATENCY_HIST_EXPORT_LEN)
+    {
+        return 0U;
+    }
+
+    *out++ = 'L';
+    *out++ = 'H';
+    *out++ = LATENCY_HIST_EXPORT_VERSION;
+    *out++ = LATENCY_PHASE_COUNT;
+    *out++ = LATENCY_HIST_BUCKETS;
+    *out++ = LATENCY_HIST_FIRST_LOG2;
+    out = latency_hist_put_u16(out, 0U);
+    out = latency_hist_put_u32(out, xTaskGetTickCount() / configTICK_RATE_HZ);
+
+    for (uint32_t p = 0; p < LATENCY_PHASE_COUNT; p++)
+    {
+        latency_hist_get((latency_phase_t)p, &hist);
+
+        out = latency_hist_put_u32(out, hist.count);
+        out = latency_hist_put_u32(out, hist.sum_ms);
+        out = latency_hist_put_u32(out, hist.max_us);
+        for (uint32_t b = 0; b < LATENCY_HIST_BUCKETS; b++)
+        {
+            out = latency_hist_put_u16(out, (hist.buckets[b] < 0xFFFFU) ? hist.buckets[b] : 0xFFFFU);
+        }
+    }
+
+    out = latency_hist_put_u16(out, latency_hist_crc16(buf, (size_t)(out - buf)));
+
+    return (size_t)(out - buf);
+}
+
+/*******************************************************************************
+ * Function Name: latency_hist_print_export
+ *******************************************************************************
+ * Summary:
+ *  Prints the binary export as one "LATBIN " line of hex, which a collector
+ *  can pick out of the UART log.
+ *
+ *******************************************************************************/
+void latency_hist_print_export(void)
+{
+    static uint8_t record[LATENCY_HIST_EXPORT_LEN];
+    size_t len = latency_hist_export(record, sizeof(record));
+
+    printf("LATBIN ");
+    for (size_t i = 0; i < len; i++)
+    {
+        printf("%02X", record[i]);
+    }
+    printf("\n");
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,107 @@
+/******************************************************************************
+*
+* File Name: latency_hist.h
+*
+* Description: This file contains the network latency histograms. The
+* time spent in each phase of a request (DNS, connect, TLS, first byte, body,
+* parse) is counted into fixed log-scale buckets, which can be printed or
+* exported in a compact binary record.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef LATENCY_HIST_H_
+#define LATENCY_HIST_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Bucket 0 holds everything under 2^LATENCY_HIST_FIRST_LOG2 us; bucket b
+ * holds [2^(b+5), 2^(b+6)) us and the last one everything from ~16.8 s up. */
+#define LATENCY_HIST_BUCKETS                     (20U)
+#define LATENCY_HIST_FIRST_LOG2                  (6U)
+
+/* Binary export: "LH", version, then one record per phase and a CRC. */
+#define LATENCY_HIST_EXPORT_VERSION              (1U)
+#define LATENCY_HIST_EXPORT_HEADER_LEN           (12U)
+#define LATENCY_HIST_EXPORT_PHASE_LEN            (12U + (2U * LATENCY_HIST_BUCKETS))
+#define LATENCY_HIST_EXPORT_LEN                  (LATENCY_HIST_EXPORT_HEADER_LEN + \
+                                                  (LATENCY_PHASE_COUNT * LATENCY_HIST_EXPORT_PHASE_LEN) + 2U)
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+typedef enum
+{
+    LATENCY_PHASE_DNS,          /* host name lookup before a new connection */
+    LATENCY_PHASE_CONNECT,      /* TCP connect of a plain connection */
+    LATENCY_PHASE_TLS,          /* TCP connect and TLS handshake */
+    LATENCY_PHASE_TTFB,         /* request sent to first piece received */
+    LATENCY_PHASE_BODY,         /* each further Range piece of the body */
+    LATENCY_PHASE_PARSE,        /* decoding and parsing a whole body */
+    LATENCY_PHASE_COUNT
+} latency_phase_t;
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t sum_ms;
+    uint32_t max_us;
+    uint32_t buckets[LATENCY_HIST_BUCKETS];
+} latency_hist_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+void latency_hist_init(void);
+uint32_t latency_hist_stamp(void);
+void latency_hist_since(latency_phase_t phase, uint32_t stamp);
+void latency_hist_record_cycles(latency_phase_t phase, uint32_t cycles);
+void latency_hist_record(latency_phase_t phase, uint32_t us);
+void latency_hist_get(latency_phase_t phase, latency_hist_t *hist);
+void latency_hist_reset(void);
+void latency_hist_print(void);
+size_t latency_hist_export(uint8_t *buf, size_t size);
+void latency_hist_print_export(void);
+
+#endif /* LATENCY_HIST_H_ */
+
+/* [] END OF FILE */
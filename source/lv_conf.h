@@ -77,10 +77,14 @@
 
 /*Use a custom tick source that tells the elapsed time in milliseconds.
  *It removes the need to manually update the tick with `lv_tick_inc()`)*/
-#define LV_TICK_CUSTOM 0
+#if defined(LV_SIMULATOR) || defined(TFT_SCHED_POLLING)
+#define LV_TICK_CUSTOM 0    /*The simulator and the polling TFT loop advance time with lv_tick_inc()*/
+#else
+#define LV_TICK_CUSTOM 1
+#endif
 #if LV_TICK_CUSTOM
-    #define LV_TICK_CUSTOM_INCLUDE "Arduino.h"         /*Header for the system time function*/
-    #define LV_TICK_CUSTOM_SYS_TIME_EXPR (millis())    /*Expression evaluating to current system time in ms*/
+    #define LV_TICK_CUSTOM_INCLUDE "lvgl_support.h"    /*Header for the system time function*/
+    #define LV_TICK_CUSTOM_SYS_TIME_EXPR (lv_port_tick_get())    /*FreeRTOS tick in ms*/
 #endif   /*LV_TICK_CUSTOM*/
 
 /*Default Dot Per Inch. Used to initialize default sizes such as widgets sized, style paddings.
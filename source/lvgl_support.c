@@ -42,23 +42,22 @@
 #include "lv_conf.h"
 #include "lvgl.h"
 
+#include "cy_pdl.h"
 #include "mtb_st7789v.h"
+#include "st7789v_bus.h"
 #include "string.h"
+#include "stdio.h"
 #include "lvgl_support.h"
-
-/*******************************************************************************
-* Macros
-*******************************************************************************/
-#define DISP_HOR_RES 320
-#define DISP_VER_RES 240
+#include "FreeRTOS.h"
+#include "task.h"
 
 /*******************************************************************************
 * Global Variables
 *******************************************************************************/
 static lv_disp_drv_t disp_drv;
 
-static lv_color_t disp_buf1[DISP_HOR_RES * 10];
-static lv_color_t disp_buf2[DISP_HOR_RES * 10];
+static lv_color_t disp_buf1[DISP_BUF_SIZE];
+static lv_color_t disp_buf2[DISP_BUF_SIZE];
 
 /*******************************************************************************
 * Function Prototypes
@@ -87,7 +86,7 @@ void lv_port_disp_init()
     memset(disp_buf1, 0, sizeof(disp_buf1));
     memset(disp_buf2, 0, sizeof(disp_buf2));
 
-    lv_disp_draw_buf_init(&buf, disp_buf1, disp_buf2, DISP_HOR_RES * 10);
+    lv_disp_draw_buf_init(&buf, disp_buf1, disp_buf2, DISP_BUF_SIZE);
 
     lv_disp_drv_init(&disp_drv);
 
@@ -101,18 +100,35 @@ void lv_port_disp_init()
 
 
 /*******************************************************************************
-* Function Name: void lv_port_disp_init(void)
+* Function Name: uint32_t lv_port_tick_get(void)
+********************************************************************************
+*
+* Summary: Time source for LVGL (LV_TICK_CUSTOM). Reading the FreeRTOS tick
+*          keeps LVGL time in step with real time no matter how long the
+*          handler itself runs.
+*
+* Return:
+*  milliseconds since the scheduler started
+*
+*******************************************************************************/
+uint32_t lv_port_tick_get(void)
+{
+    return (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS);
+}
+
+/*******************************************************************************
+* Function Name: void flush_cb(lv_disp_drv_t * drv, const lv_area_t * area,
+*                              lv_color_t * color_p)
 ********************************************************************************
 *
 * Summary: This function is responsible for flushing the color buffer in LVGL.
+*          The pixels are clocked out by the CPU before it returns, so the
+*          buffer is handed back to LVGL at once.
 *
 * Parameters:
-*    x1      left coordinate of the rectangle
-*    x2      right coordinate of the rectangle     
-*    y1      top coordinate of the rectangle
-*    y2      bottom coordinate of the rectangle
-*    x2      right coordinate of the rectangle     
-*    color_p pointer to an array of colors
+*    drv     display driver, handed back with lv_disp_flush_ready()
+*    area    rectangle to write: x1/x2 left and right, y1/y2 top and bottom
+*    color_p pointer to the area's colors, row by row
 *
 * Return:
 *  None
@@ -129,25 +145,40 @@ static void flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * c
     if(area->x1 > DISP_HOR_RES - 1) return;
     if(area->y1 > DISP_VER_RES - 1) return;
 
+    /* LVGL hands over the area as one row-major block, which matches the
+     * address auto-increment of the controller, so the whole area goes out
+     * as a single burst. */
+    st7789v_bus_set_window(area->x1, area->y1, area->x2, area->y2);
+    st7789v_bus_write_pixels(&color_p->full, lv_area_get_size(area));
+
+    lv_disp_flush_ready(drv);
+}
+
+#if defined(LV_PORT_FLUSH_BENCHMARK)
+/*******************************************************************************
+* Function Name: void legacy_flush(const lv_area_t * area, lv_color_t * color_p)
+********************************************************************************
+*
+* Summary: The original per-byte flush loop, kept only as the benchmark
+*          baseline.
+*
+*******************************************************************************/
+static void legacy_flush(const lv_area_t * area, lv_color_t * color_p)
+{
     mtb_st7789v_write_command(0x2a);
-    /* Start Column offset - Lower byte. */
-    mtb_st7789v_write_data(area->x1 >> 8);  
-    /* Start Column offset - Higher Byte. */
-    mtb_st7789v_write_data(area->x1 & 0xFF); 
+    mtb_st7789v_write_data(area->x1 >> 8);
+    mtb_st7789v_write_data(area->x1 & 0xFF);
     mtb_st7789v_write_data(area->x2 >> 8);
     mtb_st7789v_write_data(area->x2 & 0xFF);
 
     mtb_st7789v_write_command(0x2b);
-    /* Start Column offset - Lower byte */
-    mtb_st7789v_write_data(area->y1 >> 8);  
-    /* Start Column offset - Higher Byte */
-    mtb_st7789v_write_data(area->y1 & 0xFF); 
+    mtb_st7789v_write_data(area->y1 >> 8);
+    mtb_st7789v_write_data(area->y1 & 0xFF);
     mtb_st7789v_write_data(area->y2 >> 8);
     mtb_st7789v_write_data(area->y2 & 0xFF);
 
     mtb_st7789v_write_command(0x2c);
 
-    /* setAddrWindow(area->x1, area->y1, area->x2, area->y2); */
     for(int x=area->x1;x<=area->x2;x++)
     {
         for(int y=area->y1;y<=area->y2;y++)
@@ -157,6 +188,82 @@ static void flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * c
             color_p++;
         }
     }
+}
 
-    lv_disp_flush_ready(drv);
+/*******************************************************************************
+* Function Name: uint32_t bench_area(const lv_area_t * area, bool burst)
+********************************************************************************
+*
+* Summary: Sends area with either path and returns the DWT cycle count. Areas
+*          taller than the draw buffer are sent band by band, as LVGL does.
+*
+*******************************************************************************/
+static uint32_t bench_area(const lv_area_t * area, bool burst)
+{
+    uint32_t start = DWT->CYCCNT;
+
+    for(lv_coord_t y = area->y1; y <= area->y2; y += DISP_BUF_LINES)
+    {
+        lv_area_t band = *area;
+        band.y1 = y;
+        band.y2 = LV_MIN(y + DISP_BUF_LINES - 1, area->y2);
+
+        if(burst)
+        {
+            st7789v_bus_set_window(band.x1, band.y1, band.x2, band.y2);
+            st7789v_bus_write_pixels(&disp_buf1[0].full, lv_area_get_size(&band));
+        }
+        else
+        {
+            legacy_flush(&band, disp_buf1);
+        }
+    }
+
+    return DWT->CYCCNT - start;
+}
+
+/*******************************************************************************
+* Function Name: void lv_port_flush_benchmark(void)
+********************************************************************************
+*
+* Summary: Prints the cycle count of the legacy and burst flush paths for a
+*          1-row, a 10-row and a full-screen area. Call it after
+*          lv_port_disp_init(); it draws a gradient over the screen.
+*
+*******************************************************************************/
+void lv_port_flush_benchmark(void)
+{
+    static const struct
+    {
+        const char *name;
+        lv_area_t area;
+    } cases[] =
+    {
+        { "1 row",       { 0, 0, DISP_HOR_RES - 1, 0 } },
+        { "10 rows",     { 0, 0, DISP_HOR_RES - 1, DISP_BUF_LINES - 1 } },
+        { "full screen", { 0, 0, DISP_HOR_RES - 1, DISP_VER_RES - 1 } },
+    };
+
+    for(uint32_t i = 0; i < DISP_BUF_SIZE; i++)
+    {
+        disp_buf1[i].full = (uint16_t)(i * 7u);
+    }
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    printf("\nFlush benchmark @ %lu Hz\n", (unsigned long)SystemCoreClock);
+    for(uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        uint32_t legacy = bench_area(&cases[i].area, false);
+        uint32_t burst = bench_area(&cases[i].area, true);
+
+        printf("  %-11s legacy %10lu cyc (%6lu us)  burst %10lu cyc (%6lu us)  x%lu.%02lu\n",
+               cases[i].name,
+               (unsigned long)legacy, (unsigned long)(legacy / (SystemCoreClock / 1000000u)),
+               (unsigned long)burst, (unsigned long)(burst / (SystemCoreClock / 1000000u)),
+               (unsigned long)(legacy / burst), (unsigned long)((legacy % burst) * 100u / burst));
+    }
 }
+#endif /* LV_PORT_FLUSH_BENCHMARK */
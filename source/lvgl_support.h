@@ -56,6 +56,12 @@
 /*******************************************************************************
 * Global constants
 *******************************************************************************/
+/* Panel geometry and the height of each of the two LVGL draw buffers. */
+#define DISP_HOR_RES 320
+#define DISP_VER_RES 240
+#define DISP_BUF_LINES 10
+#define DISP_BUF_SIZE (DISP_HOR_RES * DISP_BUF_LINES)
+
 
 /*******************************************************************************
  * Global variable
@@ -70,6 +76,11 @@ extern "C" {
 #endif
 
 void lv_port_disp_init(void);
+uint32_t lv_port_tick_get(void);
+
+#if defined(LV_PORT_FLUSH_BENCHMARK)
+void lv_port_flush_benchmark(void);
+#endif
 
 #if defined(__cplusplus)
 }
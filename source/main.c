@@ -51,6 +51,9 @@
 #include "cy_retarget_io.h"
 #include "secure_http_client.h"
 #include "tft_task.h"
+#include "ui_cmd_queue.h"
+#include "console.h"
+#include "timekeeper.h"
 #include "FreeRTOS.h"
 #include "task.h"
 
@@ -127,6 +130,12 @@ int main(void)
     APP_INFO(("HTTPS Client\n"));
     APP_INFO(("===================================\n\n"));
 
+    /* The queue must exist before any task can post UI commands. */
+    ui_cmd_queue_init();
+
+    /* UTC on the RTC, before any task reads or corrects it. */
+    timekeeper_init();
+
     /* Starts the HTTPS client in secure mode. */
 	xTaskCreate(tft_task, "tftTask", TFT_TASK_STACK_SIZE, NULL,
                 TFT_TASK_PRIORITY,  NULL);
@@ -134,6 +143,10 @@ int main(void)
     xTaskCreate(https_client_task, "HTTPS Client", HTTPS_CLIENT_TASK_STACK_SIZE, NULL,
                 HTTPS_CLIENT_TASK_PRIORITY, &https_client_task_handle);
 
+    /* Diagnostics typed on the debug UART; type "help" for the commands. */
+    xTaskCreate(console_task, "Console", CONSOLE_TASK_STACK_SIZE, NULL,
+                CONSOLE_TASK_PRIORITY, NULL);
+
     /* Start the FreeRTOS scheduler */
     vTaskStartScheduler();
 
@@ -0,0 +1,345 @@
+/******************************************************************************
+*
+* File Name: poll_sched.c
+*
+* Description: This file contains the fetch scheduler. It works out when the next
+* weather poll is worth making from the update interval reported in the
+* payload and the Cache-Control and Expires headers, spreads devices out
+* with jitter and backs off exponentially after failures.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Header file includes */
+#include <string.h>
+#include <strings.h>
+#include "poll_sched.h"
+
+/*******************************************************************************
+ * Function Name: poll_sched_random
+ *******************************************************************************
+ * Summary:
+ *  xorshift32 step. Only used to spread polls, so statistical quality does not
+ *  matter, but the seed should differ between devices.
+ *
+ *******************************************************************************/
+static uint32_t poll_sched_random(poll_sched_t *sched)
+{
+    uint32_t x = sched->rng;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    sched->rng = x;
+
+    return x;
+}
+
+/*******************************************************************************
+ * Function Name: poll_sched_fresh_for
+ *******************************************************************************
+ * Summary:
+ *  Seconds until the data in a successful response goes stale, and why.
+ *  The payload's own update interval wins, because the cache headers tend to
+ *  be much shorter than the rate the data actually changes at.
+ *
+ *******************************************************************************/
+static uint32_t poll_sched_fresh_for(const poll_hints_t *hints, poll_reason_t *reason)
+{
+    if ((0U != hints->now) && (0U != hints->observed) && (0U != hints->interval))
+    {
+        uint32_t next_update = hints->observed + hints->interval;
+
+        *reason = POLL_REASON_INTERVAL;
+        return (next_update > hints->now) ? (next_update - hints->now) : 0U;
+    }
+
+    if (0U != hints->max_age)
+    {
+        *reason = POLL_REASON_MAX_AGE;
+        return hints->max_age;
+    }
+
+    if ((0U != hints->now) && (0U != hints->expires))
+    {
+        *reason = POLL_REASON_EXPIRES;
+        return (hints->expires > hints->now) ? (hints->expires - hints->now) : 0U;
+    }
+
+    *reason = POLL_REASON_DEFAULT;
+    return POLL_DEFAULT_S;
+}
+
+/*******************************************************************************
+ * Function Name: poll_sched_init
+ *******************************************************************************
+ * Summary:
+ *  Resets the scheduler.
+ *
+ * Parameters:
+ *  sched: scheduler state
+ *  seed: per-device value for the jitter, e.g. derived from the MAC address
+ *
+ *******************************************************************************/
+void poll_sched_init(poll_sched_t *sched, uint32_t seed)
+{
+    sched->rng = (0U != seed) ? seed : 0x9E3779B9UL;
+    sched->failures = 0;
+    sched->last_delay_s = 0;
+    sched->last_reason = POLL_REASON_DEFAULT;
+}
+
+/*******************************************************************************
+ * Function Name: poll_sched_next
+ *******************************************************************************
+ * Summary:
+ *  Returns how long to wait before the next poll.
+ *
+ *  After a success the wait runs to the point the data goes stale plus
+ *  POLL_GRACE_S, clamped to POLL_MIN_S..POLL_MAX_S, plus up to
+ *  POLL_JITTER_PERCENT at random. After a failure it is a random point in
+ *  the upper half of a window that doubles per consecutive failure, from
+ *  POLL_BACKOFF_BASE_S up to POLL_BACKOFF_MAX_S.
+ *
+ * Parameters:
+ *  sched: scheduler state
+ *  success: whether the poll that just finished got its data
+ *  hints: freshness information from that poll; ignored on failure
+ *
+ * Return:
+ *  uint32_t: delay in seconds
+ *
+ *******************************************************************************/
+uint32_t poll_sched_next(poll_sched_t *sched, bool success, const poll_hints_t *hints)
+{
+    uint32_t delay;
+
+    if (!success)
+    {
+        uint32_t shift = (sched->failures < 16U) ? sched->failures : 16U;
+        uint32_t window = POLL_BACKOFF_BASE_S << shift;
+
+        if (window > POLL_BACKOFF_MAX_S)
+        {
+            window = POLL_BACKOFF_MAX_S;
+        }
+        sched->failures++;
+
+        delay = (window / 2U) + (poll_sched_random(sched) % ((window / 2U) + 1U));
+        sched->last_reason = POLL_REASON_BACKOFF;
+    }
+    else
+    {
+        sched->failures = 0;
+
+        delay = poll_sched_fresh_for(hints, &sched->last_reason) + POLL_GRACE_S;
+        if (delay < POLL_MIN_S)
+        {
+            delay = POLL_MIN_S;
+        }
+        else if (delay > POLL_MAX_S)
+        {
+            delay = POLL_MAX_S;
+        }
+
+        delay += poll_sched_random(sched) % (((delay * POLL_JITTER_PERCENT) / 100U) + 1U);
+    }
+
+    sched->last_delay_s = delay;
+    return delay;
+}
+
+/*******************************************************************************
+ * Function Name: poll_sched_is_tchar
+ *******************************************************************************
+ * Summary:
+ *  Tells whether c may appear in an HTTP token (RFC 9110 section 5.6.2).
+ *
+ *******************************************************************************/
+static bool poll_sched_is_tchar(char c)
+{
+    return ((c >= '0') && (c <= '9')) || ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) ||
+           (('\0' != c) && (NULL != strchr("!#$%&'*+-.^_`|~", c)));
+}
+
+/*******************************************************************************
+ * Function Name: poll_sched_skip_ows
+ *******************************************************************************/
+static const char *poll_sched_skip_ows(const char *p, const char *end)
+{
+    while ((p < end) && ((' ' == *p) || ('\t' == *p)))
+    {
+        p++;
+    }
+    return p;
+}
+
+/*******************************************************************************
+ * Function Name: poll_sched_skip_quoted
+ *******************************************************************************
+ * Summary:
+ *  Returns where the quoted string starting at p, on its opening quote,
+ *  ends: past the closing quote, or at end if it is unterminated.
+ *
+ *******************************************************************************/
+static const char *poll_sched_skip_quoted(const char *p, const char *end)
+{
+    for (p++; p < end; p++)
+    {
+        if ('"' == *p)
+        {
+            return p + 1;
+        }
+        if (('\\' == *p) && ((p + 1) < end))
+        {
+            p++;
+        }
+    }
+    return end;
+}
+
+/*******************************************************************************
+ * Function Name: poll_sched_parse_max_age
+ *******************************************************************************
+ * Summary:
+ *  Finds the max-age directive in a Cache-Control value. The value is split
+ *  into comma-separated directives, each a token optionally followed by "="
+ *  and a token or a quoted string, so that s-maxage, a longer name ending
+ *  in max-age, or "max-age=" inside a quoted string do not count. The first
+ *  max-age with a number wins; a number too large for uint32_t is clamped.
+ *
+ * Parameters:
+ *  value: header value, not necessarily NUL-terminated
+ *  len: its length
+ *  max_age: receives the seconds
+ *
+ * Return:
+ *  bool: false if the value has no usable max-age
+ *
+ *******************************************************************************/
+bool poll_sched_parse_max_age(const char *value, size_t len, uint32_t *max_age)
+{
+    const char *end = value + len;
+    const char *p = value;
+
+    while (p < end)
+    {
+        const char *name;
+        const char *arg = NULL;
+        const char *arg_end = NULL;
+        size_t name_len;
+
+        p = poll_sched_skip_ows(p, end);
+        name = p;
+        while ((p < end) && poll_sched_is_tchar(*p))
+        {
+            p++;
+        }
+        name_len = (size_t)(p - name);
+
+        p = poll_sched_skip_ows(p, end);
+        if ((p < end) && ('=' == *p))
+        {
+            p = poll_sched_skip_ows(p + 1, end);
+            if ((p < end) && ('"' == *p))
+            {
+                /* Digits are checked as they stand, so an escape inside the
+                 * quotes makes the value unusable. */
+                arg = p + 1;
+                p = poll_sched_skip_quoted(p, end);
+                arg_end = ((p > arg) && ('"' == p[-1])) ? (p - 1) : p;
+            }
+            else
+            {
+                arg = p;
+                while ((p < end) && poll_sched_is_tchar(*p))
+                {
+                    p++;
+                }
+                arg_end = p;
+            }
+        }
+
+        if ((7U == name_len) && (0 == strncasecmp(name, "max-age", 7U)) && (NULL != arg) && (arg_end > arg))
+        {
+            uint64_t seconds = 0;
+            const char *d = arg;
+
+            while ((d < arg_end) && (*d >= '0') && (*d <= '9'))
+            {
+                seconds = (seconds * 10U) + (uint64_t)(*d - '0');
+                seconds = (seconds > UINT32_MAX) ? UINT32_MAX : seconds;
+                d++;
+            }
+            if (d == arg_end)
+            {
+                *max_age = (uint32_t)seconds;
+                return true;
+            }
+        }
+
+        /* Whatever else is left of this directive is skipped, quoted
+         * strings whole, so that a comma inside one does not end it. */
+        while ((p < end) && (',' != *p))
+        {
+            p = ('"' == *p) ? poll_sched_skip_quoted(p, end) : (p + 1);
+        }
+        if (p < end)
+        {
+            p++;
+        }
+    }
+
+    return false;
+}
+
+/*******************************************************************************
+ * Function Name: poll_sched_reason_str
+ *******************************************************************************
+ * Summary:
+ *  Name of a poll_reason_t for the log.
+ *
+ *******************************************************************************/
+const char *poll_sched_reason_str(poll_reason_t reason)
+{
+    static const char *const names[] =
+    {
+        "payload interval", "max-age", "Expires", "default", "backoff"
+    };
+
+    return ((uint32_t)reason < (sizeof(names) / sizeof(names[0]))) ? names[reason] : "?";
+}
+
+/* [] END OF FILE */
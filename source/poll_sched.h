@@ -0,0 +1,121 @@
+/******************************************************************************
+*
+* File Name: poll_sched.h
+*
+* Description: This file is the public interface of poll_sched.c source file
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef POLL_SCHED_H_
+#define POLL_SCHED_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Bounds on the delay between polls, whatever the server says. */
+#define POLL_MIN_S                               (60UL)
+#define POLL_MAX_S                               (60UL * 60UL)
+
+/* Used when a response carries no freshness information at all. */
+#define POLL_DEFAULT_S                           (15UL * 60UL)
+
+/* Wait this long past the data's update time before asking for it. */
+#define POLL_GRACE_S                             (30UL)
+
+/* Up to this share of the delay is added at random. */
+#define POLL_JITTER_PERCENT                      (10UL)
+
+/* Failure backoff: base doubled per consecutive failure, up to the cap. */
+#define POLL_BACKOFF_BASE_S                      (15UL)
+#define POLL_BACKOFF_MAX_S                       (30UL * 60UL)
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+/* What a successful poll learned about the freshness of the data. Every
+ * field is 0 when unknown; times are UTC seconds since 1970. */
+typedef struct
+{
+    uint32_t now;           /* Date header */
+    uint32_t max_age;       /* Cache-Control max-age */
+    uint32_t expires;       /* Expires header */
+    uint32_t observed;      /* start of the payload's current interval */
+    uint32_t interval;      /* length of the payload's update interval */
+} poll_hints_t;
+
+typedef enum
+{
+    POLL_REASON_INTERVAL,   /* next payload update */
+    POLL_REASON_MAX_AGE,
+    POLL_REASON_EXPIRES,
+    POLL_REASON_DEFAULT,
+    POLL_REASON_BACKOFF
+} poll_reason_t;
+
+typedef struct
+{
+    uint32_t rng;
+    uint32_t failures;      /* consecutive failed polls */
+    uint32_t last_delay_s;
+    poll_reason_t last_reason;
+} poll_sched_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void poll_sched_init(poll_sched_t *sched, uint32_t seed);
+uint32_t poll_sched_next(poll_sched_t *sched, bool success, const poll_hints_t *hints);
+bool poll_sched_parse_max_age(const char *value, size_t len, uint32_t *max_age);
+const char *poll_sched_reason_str(poll_reason_t reason);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* POLL_SCHED_H_ */
+
+/* [] END OF FILE */
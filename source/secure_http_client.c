@@ -56,17 +56,37 @@
 #include "cy_wcm_error.h"
 
 /* Standard C header file */
+#include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 
 /* HTTPS client task header file. */
 #include "secure_http_client.h"
 #include "cy_http_client_api.h"
 #include "secure_keys.h"
-#include "ui.h"
+#include "ui_cmd_queue.h"
+#include "weather_state.h"
+#include "tft_task.h"
+#include "http_conn_pool.h"
+#include "geo_cache.h"
+#include "poll_sched.h"
+#include "fetch_cycle.h"
+#include "http_header_index.h"
+#include "cond_get.h"
+#include "inflate_stream.h"
+#include "http_stream.h"
+#include "weather_provider.h"
+#include "weather_hedge.h"
+#include "latency_hist.h"
+#include "tls_client.h"
+#include "civil_time.h"
+#include "timekeeper.h"
+#include "sntp_client.h"
 
 #include "lwip/ip_addr.h"
 
-#include "cy_json_parser.h"
+#include "json_extract.h"
 /*******************************************************************************
  * Global Variables
  ********************************************************************************/
@@ -74,71 +94,128 @@
 #define LAST_INDEX                                   (1U)
 #define MEMSET_VAL                                   (0U)
 #define INITIAL_VALUE                                (0U)
-#define HTTPS_CLIENT_TASK_DELAY_MS                  (1000U * 60U) /* 60 seconds */
 
 static cy_http_client_method_t http_client_method;
 
 /* Holds the IP address obtained using Wi-Fi Connection Manager (WCM). */
 static cy_wcm_ip_address_t ip_addr;
 
-/* Secure HTTP client instance. */
-static cy_http_client_t https_client;
+#if (HTTP_GET_BUFFER_LENGTH > HTTP_HEADER_INDEX_MAX_LEN)
+#error "http_header_index cannot address all of the receive buffer"
+#endif
 
-/* Holds the security configuration such as client certificate,
- * client key, and rootCA.
- */
-cy_http_client_request_header_t request;
-cy_http_client_header_t header;
-cy_http_client_response_t response;
+/*Holds the HTTP header fields */
+cy_http_client_header_t http_header[1];
 
-/* Secure HTTP server information. */
-cy_awsport_server_info_t server_info;
+char date_header[64] = {0};
 
-/*Buffer to store get response*/
-uint8_t http_get_buffer[HTTP_GET_BUFFER_LENGTH];
 
-/*Holds the HTTP header fields */
-cy_http_client_header_t http_header[1];
+/* Location the weather is fetched for, from the cache or the geo API. */
+static geo_cache_entry_t location;
 
-/*Holds the fields for response header and body*/
-cy_http_client_response_t http_response;
+/* Working copy filled by the parsers and published once per fetch cycle. */
+static weather_state_t fetch_state;
 
-char date_header[64] = {0};
+/* Freshness of the last response, for the fetch scheduler. */
+static poll_hints_t poll_hints;
+static poll_sched_t poll_sched;
+
+/* Set when a step of the current cycle changed what fetch_state shows: the
+ * city or timezone, or the weather. A 304 or a failed step leaves it clear. */
+static bool fetch_state_changed;
+
+/* Set once a server sends a compressed stream the inflater window is too
+ * small for; compression is not requested again. */
+static bool compression_refused;
+
+/* Decoding state of the response body being received. */
+typedef struct
+{
+    json_extract_t parser;
+    bool started;               /* first piece seen and content coding chosen */
+    bool inflating;
+    bool failed;
+    uint32_t parse_cycles;      /* spent decoding and parsing */
+} body_decoder_t;
+
+/* One request and its response, received and decoded piece by piece. The
+ * geolocation lookup has one, and so has each weather lane, so that hedged
+ * weather requests can be in flight side by side. */
+typedef struct
+{
+    cy_http_client_request_header_t request;
+    cy_http_client_header_t header[NUM_HTTP_HEADERS + HTTP_STREAM_EXTRA_HEADERS];
+    cy_http_client_response_t response;
+    http_header_index_t header_index;   /* indexed as the response arrives */
+    http_stream_t body_stream;
+    inflate_stream_t inflater;          /* for gzip and deflate bodies */
+    body_decoder_t decoder;
+    uint8_t buffer[HTTP_GET_BUFFER_LENGTH];
+} http_exchange_t;
+
+/* A weather request run by a weather_hedge lane. The lane task only touches
+ * its own entry; the conditional request cache is read for it beforehand. */
+typedef struct
+{
+    http_exchange_t exchange;
+    char path[WEATHER_PROVIDER_PATH_LEN];
+    bool conditional;                   /* validators were sent */
+    cond_get_entry_t validators;
+    weather_state_t state;              /* fields parsed from the body */
+} weather_lane_t;
+
+static http_exchange_t geo_exchange;
+static weather_lane_t weather_lanes[WEATHER_HEDGE_LANES];
+
+/* Provider whose data fetch_state holds. Only its requests are conditional:
+ * a 304 from another one would not vouch for what is shown. */
+static weather_provider_id_t shown_provider = WEATHER_PROVIDER_COUNT;
+
+/* Step, retry and resume state of the geo -> weather fetch chain. */
+static fetch_cycle_t fetch_cycle;
+
+/* Fields taken from the ipinfo.io response, written into location. */
+static const json_field_t geo_schema[JSON_KEY_COUNT] =
+{
+    [JSON_KEY_IP]       = { JSON_FIELD_TEXT, JSON_KEY_ROOT, offsetof(geo_cache_entry_t, public_ip),
+                            sizeof(location.public_ip), 0 },
+    [JSON_KEY_LOC]      = { JSON_FIELD_COORDS, JSON_KEY_ROOT, offsetof(geo_cache_entry_t, latitude),
+                            sizeof(location.latitude), offsetof(geo_cache_entry_t, longitude) },
+    [JSON_KEY_CITY]     = { JSON_FIELD_TEXT, JSON_KEY_ROOT, offsetof(geo_cache_entry_t, city),
+                            sizeof(location.city), 0 },
+    [JSON_KEY_TIMEZONE] = { JSON_FIELD_TEXT, JSON_KEY_ROOT, offsetof(geo_cache_entry_t, timezone),
+                            sizeof(location.timezone), 0 },
+};
 
-struct tm current_time;  // Stores synced local time
-bool time_synced = false; // Set after first sync
-
-static char latitude[16];   // For lat extracted from "loc"
-static char longitude[16];  // For lon extracted from "loc"
-static char timezone[32];   // For timezone
-static char city[16];       // For City
-static char timedata[32];
-static char temperature[16];
-static char hummidity[16];
-static char windspeed[16];
-static char weathercode[16];
-
-bool syncedAll = true;
-
-static bool temperatureSynced = false;
-static bool humiditySynced = false;
-static bool windSynced = false;
-static bool rainSynced = false;
-static bool locationSynced = false;
 /******************************************************************************
 * Function Prototypes
 *******************************************************************************/
-static void http_request(void);
-static void fetch_https_client_method(void);
-static void disconnect_callback_handler(cy_http_client_t handle,
-                                 cy_http_client_disconn_type_t type, void *args);
-static cy_rslt_t send_http_request(cy_http_client_t handle,
-                            cy_http_client_method_t method,const char * pPath);
-static cy_rslt_t configure_https_client(const char *host_name, uint16_t port);
+static bool fetch_https_client_method(void);
+static cy_rslt_t send_http_request(http_exchange_t *exchange, const char *host, uint16_t port,
+                            cy_http_client_method_t method,const char * pPath,
+                            const cond_get_entry_t *validators);
+static void body_begin(http_exchange_t *exchange, const json_field_t *schema, void *target);
+static bool body_sink(void *arg, const uint8_t *data, size_t len);
+static bool body_finish(http_exchange_t *exchange);
 static cy_rslt_t wifi_connect(void);
-
-void parse_json_payload(const char* payload);
-void parse_json_weather_payload(const char* payload, uint32_t payload_len);
+static void store_response_headers(const http_header_index_t *index);
+static uint32_t poll_seed(void);
+static void get_network_id(geo_cache_net_t *net);
+static fetch_outcome_t fetch_geolocation(void);
+static fetch_outcome_t fetch_weather(void);
+static void weather_lane_prepare(uint32_t lane, weather_provider_id_t provider);
+static fetch_outcome_t weather_lane_fetch(uint32_t lane, weather_provider_id_t provider);
+static fetch_outcome_t http_outcome(const http_exchange_t *exchange, cy_rslt_t result);
+
+void parse_json_payload(void);
+bool parse_json_weather_payload(http_exchange_t *exchange);
+
+/* Weather requests are hedged across the providers in weather lanes. */
+static const weather_hedge_ops_t weather_hedge_ops =
+{
+    .prepare = weather_lane_prepare,
+    .fetch = weather_lane_fetch,
+};
 /********************************************************************************
  * Function Name: wifi_connect
  ********************************************************************************
@@ -191,12 +268,12 @@ cy_rslt_t wifi_connect(void)
                  {
                      APP_INFO(("Assigned IP address: %s\n", ip6addr_ntoa((const ip6_addr_t *)&ip_addr.ip.v6)));
                  }
-                 lv_obj_clear_flag(ui_WiFiIcon, LV_OBJ_FLAG_HIDDEN);
+                 ui_cmd_post_wifi(true);
 
                  break;
              }
 
-            lv_obj_add_flag(ui_WiFiIcon, LV_OBJ_FLAG_HIDDEN);
+            ui_cmd_post_wifi(false);
             ERR_INFO(("Failed to join Wi-Fi network. Retrying...\n"));
         }
     }
@@ -205,152 +282,187 @@ cy_rslt_t wifi_connect(void)
 }
 
 /*******************************************************************************
-* Function Name: disconnect_callback
-********************************************************************************
-* Summary:
-*  Callback function for http disconnect.
-*******************************************************************************/
-static void disconnect_callback_handler(cy_http_client_t handle,
-        cy_http_client_disconn_type_t type, void *args)
-{
-    printf("\nApplication Disconnect callback triggered for handle = "
-            "%p type=%d\n", handle, type);
-
-    lv_obj_add_flag(ui_WiFiIcon, LV_OBJ_FLAG_HIDDEN);
-}
-
-/*******************************************************************************
- * Function Name: send_http_request
+ * Function Name: store_response_headers
  *******************************************************************************
  * Summary:
- *  The function handles an http send operation.
+ *  Picks the headers the application uses out of the response header index:
+ *  Date is handed to the timekeeper, which the SNTP task corrects from, and
+ *  goes into the working snapshot, and the Cache-Control max-age and Expires time go into
+ *  poll_hints for the fetch scheduler.
  *
  * Parameters:
- *  void
- *
- * Return:
- *  cy_rslt_t: Returns CY_RSLT_SUCCESS if the secure HTTP client is configured
- *  successfully, otherwise, it returns CY_RSLT_TYPE_ERROR.
+ *  index: headers of the response
  *
  *******************************************************************************/
-static cy_rslt_t send_http_request( cy_http_client_t handle,
-        cy_http_client_method_t method, const char * pPath)
+static void store_response_headers(const http_header_index_t *index)
 {
-    /* Return value of all methods from the HTTP Client library API. */
-    cy_rslt_t http_status = CY_RSLT_SUCCESS;
+    char value_buf[WEATHER_DATE_LEN];
+    const char *value;
+    size_t len;
+    uint32_t date;
 
-    /* Initialize the response object. The same buffer used for storing
-     * request headers is reused here. */
-    request.buffer = http_get_buffer;
-    request.buffer_len = HTTP_GET_BUFFER_LENGTH;
-
-    request.headers_len = HTTP_REQUEST_HEADER_LEN;
-    request.method = method;
-    request.range_end = HTTP_REQUEST_RANGE_END;
-    request.range_start = HTTP_REQUEST_RANGE_START;
-    request.resource_path = pPath;
-    header.field = "Connection";
-    header.field_len = strlen("Connection");
-    header.value = "keep-alive";
-    header.value_len = strlen("keep-alive");
-
-    http_status = cy_http_client_write_header(handle, &request, &header, NUM_HTTP_HEADERS);
-    if( http_status != CY_RSLT_SUCCESS )
+    poll_hints.max_age = 0;
+    poll_hints.expires = 0;
+
+    if (http_header_index_copy(index, HTTP_HDR_DATE, fetch_state.date, sizeof(fetch_state.date)) &&
+        civil_time_parse_http_date(fetch_state.date, &date))
     {
-        printf("\nWrite Header ----------- Fail \n");
-        return http_status;
+        timekeeper_note_http_date(date);
     }
-    else
+
+    if (http_header_index_copy(index, HTTP_HDR_EXPIRES, value_buf, sizeof(value_buf)))
     {
-        printf( "\n Sending Request Headers:\n%.*s\n",( int ) request.headers_len, ( char * ) request.buffer);
+        (void)civil_time_parse_http_date(value_buf, &poll_hints.expires);
     }
 
-    http_status = cy_http_client_send(handle, &request, (uint8_t *)REQUEST_BODY, REQUEST_BODY_LENGTH, &response);
-    if(CY_RSLT_SUCCESS != http_status)
+    if (http_header_index_get(index, HTTP_HDR_CACHE_CONTROL, &value, &len))
     {
-        printf("\nFailed to send HTTP method=%d\n Error=%ld\r\n",request.method,(unsigned long)http_status);
-        http_request();
+        (void)poll_sched_parse_max_age(value, len, &poll_hints.max_age);
     }
-    else
+}
+
+/*******************************************************************************
+ * Function Name: poll_seed
+ *******************************************************************************
+ * Summary:
+ *  FNV-1a hash of the station MAC address, so that the poll jitter differs
+ *  from device to device.
+ *
+ *******************************************************************************/
+static uint32_t poll_seed(void)
+{
+    cy_wcm_mac_t mac;
+    uint32_t hash = 2166136261UL;
+
+    if (CY_RSLT_SUCCESS == cy_wcm_get_mac_addr(CY_WCM_INTERFACE_TYPE_STA, &mac))
     {
-        if ( CY_HTTP_CLIENT_METHOD_HEAD != method )
+        for (uint32_t i = 0; i < sizeof(mac); i++)
         {
-            TEST_INFO(( "Received HTTP response from %.*s%.*s...\n"
-                   "Response Headers:\n %.*s\n"
-                   "Response Status :\n %u \n"
-                   "Response Body   :\n %.*s\n",
-                   ( int ) sizeof(GEO_SERVER_HOST)-LAST_INDEX, GEO_SERVER_HOST,
-                   ( int ) sizeof(request.resource_path) -LAST_INDEX, request.resource_path,
-                   ( int ) response.headers_len, response.header,
-                   response.status_code,
-                   ( int ) response.body_len, response.body ) );
-
+            hash = (hash ^ mac[i]) * 16777619UL;
         }
-        printf("\n buffer_len:[%d] headers_len:[%d] header_count:[%d] body_len:[%d] content_len:[%d]\n",
-                 response.buffer_len, response.headers_len, response.header_count, response.body_len, response.content_len);
     }
 
-    /* Disconnect the HTTP client from the server. */
-    http_status = cy_http_client_disconnect(handle);
-    (CY_RSLT_SUCCESS != http_status)?printf("Failed to diconnect handler\r\n"):
-            printf("Successfully disconnected handler\r\n");
-    
+    return hash;
+}
 
-    /* Delete the instance of the HTTP client. */
-    http_status = cy_http_client_delete(handle);
-    (CY_RSLT_SUCCESS != http_status)?printf("Failed to deleted handler\r\n"):
-            printf("Successfully deleted handler\r\n");
+/*******************************************************************************
+ * Function Name: get_network_id
+ *******************************************************************************
+ * Summary:
+ *  Fills in the access point BSSID and the assigned IPv4 address, which the
+ *  geolocation cache uses to tell whether the device may have moved.
+ *
+ *******************************************************************************/
+static void get_network_id(geo_cache_net_t *net)
+{
+    cy_wcm_associated_ap_info_t ap_info;
 
-    return http_status;
+    (void)memset(net, 0, sizeof(*net));
+
+    if (CY_RSLT_SUCCESS == cy_wcm_get_associated_ap_info(&ap_info))
+    {
+        memcpy(net->bssid, ap_info.BSSID, sizeof(net->bssid));
+    }
+
+    if (CY_WCM_IP_VER_V4 == ip_addr.version)
+    {
+        net->sta_ipv4 = ip_addr.ip.v4;
+    }
 }
+
 /*******************************************************************************
- * Function Name: configure_https_client
+ * Function Name: send_http_request
  *******************************************************************************
  * Summary:
- *  Configures the security parameters such as client certificate, private key,
- *  and the root CA certificate to start the HTTP client in secure mode.
+ *  The function handles an http send operation. The request goes out on the
+ *  pooled keep-alive connection to host:port, which stays open afterwards.
+ *  With validators it is a conditional request, which the server may answer
+ *  with 304 Not Modified and no body. A 2xx body is passed to body_sink() in
+ *  pieces while it arrives, so body_begin() must have been called.
  *
  * Parameters:
- *  void
+ *  exchange: request and response state to use
+ *  host: server host name
+ *  port: server port
+ *  method: HTTP method
+ *  pPath: resource path
+ *  validators: validators of the resource, or NULL for a plain request
  *
  * Return:
  *  cy_rslt_t: Returns CY_RSLT_SUCCESS if the secure HTTP client is configured
  *  successfully, otherwise, it returns CY_RSLT_TYPE_ERROR.
  *
  *******************************************************************************/
-static cy_rslt_t configure_https_client(const char *host_name, uint16_t port)
+static cy_rslt_t send_http_request(http_exchange_t *exchange, const char *host, uint16_t port,
+        cy_http_client_method_t method, const char * pPath,
+        const cond_get_entry_t *validators)
 {
-    cy_rslt_t result = CY_RSLT_SUCCESS;
-    cy_http_disconnect_callback_t http_cb;
-
-    /* Clear existing server_info structure. */
-    (void)memset(&server_info, MEMSET_VAL, sizeof(server_info));
-
-    /* Set the server hostname and port dynamically. */
-    server_info.host_name = host_name;
-    server_info.port = port;
+    /* Return value of all methods from the HTTP Client library API. */
+    cy_rslt_t http_status = CY_RSLT_SUCCESS;
+    cy_http_client_request_header_t *request = &exchange->request;
+    cy_http_client_header_t *header = exchange->header;
+    cy_http_client_response_t *response = &exchange->response;
+    uint32_t num_headers;
 
-    /* Initialize the HTTP Client Library. */
-    result = cy_http_client_init();
-    if (CY_RSLT_SUCCESS != result)
+    /* Initialize the response object. The same buffer used for storing
+     * request headers is reused here. */
+    request->buffer = exchange->buffer;
+    request->buffer_len = HTTP_GET_BUFFER_LENGTH;
+
+    request->headers_len = HTTP_REQUEST_HEADER_LEN;
+    request->method = method;
+    request->range_end = HTTP_REQUEST_RANGE_END;
+    request->range_start = HTTP_REQUEST_RANGE_START;
+    request->resource_path = pPath;
+    header[0].field = "Connection";
+    header[0].field_len = strlen("Connection");
+    header[0].value = "keep-alive";
+    header[0].value_len = strlen("keep-alive");
+    num_headers = 1U;
+    if (!compression_refused && ('\0' != HTTP_ACCEPT_ENCODING[0]))
     {
-        ERR_INFO(("Failed to initialize http client.\n"));
-        return result;
+        header[num_headers].field = "Accept-Encoding";
+        header[num_headers].field_len = strlen("Accept-Encoding");
+        header[num_headers].value = HTTP_ACCEPT_ENCODING;
+        header[num_headers].value_len = strlen(HTTP_ACCEPT_ENCODING);
+        num_headers++;
     }
+    num_headers += cond_get_add_headers(validators, &header[num_headers], NUM_HTTP_HEADERS - num_headers);
 
-    /* Set the disconnect callback handler (if needed). */
-    http_cb = disconnect_callback_handler;
-
-    /* Create an instance of the HTTP client for the given server information. */
-    result = cy_http_client_create(NULL, &server_info, http_cb, NULL, &https_client);
-    if (CY_RSLT_SUCCESS != result)
+    exchange->body_stream.sink = body_sink;
+    exchange->body_stream.sink_arg = exchange;
+    http_status = http_stream_get(&exchange->body_stream, host, port, request, header, num_headers,
+                                  response, &exchange->header_index);
+    if(CY_RSLT_SUCCESS != http_status)
     {
-        ERR_INFO(("Failed to create http client.\n"));
+        printf("\nFailed to send HTTP method=%d\n Error=%ld\r\n",request->method,(unsigned long)http_status);
     }
+    else
+    {
+        if ( CY_HTTP_CLIENT_METHOD_HEAD != method )
+        {
+            TEST_INFO(( "Received HTTP response from %.*s%.*s...\n"
+                   "Response Headers:\n %.*s\n"
+                   "Response Status :\n %u \n"
+                   "Response Body   :\n %.*s\n",
+                   ( int ) strlen(host), host,
+                   ( int ) sizeof(request->resource_path) -LAST_INDEX, request->resource_path,
+                   ( int ) response->headers_len, response->header,
+                   response->status_code,
+                   ( int ) response->body_len, response->body ) );
 
-    return result;
-}
+        }
+        printf("\n buffer_len:[%d] headers_len:[%d] header_count:[%d] body_len:[%d] content_len:[%d]\n",
+                 response->buffer_len, response->headers_len, response->header_count, response->body_len, response->content_len);
+        if (exchange->body_stream.chunks > 1U)
+        {
+            printf(" body of %lu bytes received in %lu pieces\n",
+                   (unsigned long)exchange->body_stream.total, (unsigned long)exchange->body_stream.chunks);
+        }
+    }
 
+    return http_status;
+}
 /*******************************************************************************
  * Function Name: https_client_task
  *******************************************************************************
@@ -374,17 +486,48 @@ void https_client_task(void *arg)
     cy_rslt_t result = CY_RSLT_TYPE_ERROR;
     CY_UNUSED_PARAMETER(arg);
 
+    /* Counts what mbedTLS allocates; set up before anything allocates. */
+    result = tls_client_init();
+    PRINT_AND_ASSERT(result, "Failed to set up the TLS heap counters.\n");
+
     /* Connects to the Wi-Fi Access Point. */
     result = wifi_connect();
     PRINT_AND_ASSERT(result, "Wi-Fi connection failed.\n");
 
+    /* Initialize the HTTP Client Library; connections are opened on demand. */
+    result = http_conn_pool_init();
+    PRINT_AND_ASSERT(result, "Failed to initialize http client.\n");
+
+    /* Parsed once here; every HTTPS connection verifies against it. */
+    result = tls_client_load_trust_anchor();
+    PRINT_AND_ASSERT(result, "Failed to load the trust anchor.\n");
+
+    /* SNTP sets the timekeeper from here on; Date headers only fill in. */
+    result = sntp_client_init();
+    PRINT_AND_ASSERT(result, "Failed to start SNTP.\n");
+
+    /* Without the flash cache every poll does the geolocation lookup. */
+    (void)geo_cache_init();
+
+    poll_sched_init(&poll_sched, poll_seed());
+    fetch_cycle_init(&fetch_cycle);
+
+    result = weather_hedge_init(&weather_hedge_ops);
+    PRINT_AND_ASSERT(result, "Failed to start the weather lanes.\n");
+
+    /* Starts the cycle counter the request phases and the parse are timed with. */
+    latency_hist_init();
+
     while(true)
     {
         /* Fetch the HTTPS client method. */
-        fetch_https_client_method();
+        bool success = fetch_https_client_method();
 
-        /* Delay before the next iteration. */
-        vTaskDelay(pdMS_TO_TICKS(HTTPS_CLIENT_TASK_DELAY_MS));
+        /* Sleep until the data is due to change, or back off after a failure. */
+        uint32_t delay_s = poll_sched_next(&poll_sched, success, &poll_hints);
+        printf("\nNext poll in %lu s (%s)\n", (unsigned long)delay_s,
+               poll_sched_reason_str(poll_sched.last_reason));
+        vTaskDelay(pdMS_TO_TICKS(delay_s * 1000U));
     }
 }
 
@@ -392,478 +535,519 @@ void https_client_task(void *arg)
  * Function Name: fetch_https_client_method
  *******************************************************************************
  * Summary:
- *  The function handles an http methods.
+ *  The function handles an http methods. It runs one fetch cycle through the
+ *  fetch_cycle state machine: geolocation, then weather, each retried on its
+ *  own after a transient failure. A cycle that gives up starts at the failed
+ *  step next time. It also fills in poll_hints from the weather response for
+ *  the fetch scheduler.
  *
  * Parameters:
  *  void
  *
  * Return:
- *  None.
+ *  bool: true if fresh weather data was received.
  *
  *******************************************************************************/
-static void fetch_https_client_method(void)
+static bool fetch_https_client_method(void)
 {
-    cy_rslt_t result = CY_RSLT_TYPE_ERROR;
+    fetch_action_t action = FETCH_ACTION_RUN;
+    fetch_outcome_t outcome;
+    bool success;
 
-    /* Step 1: Fetch geolocation data */
-    printf("\nConfiguring client for Geolocation API (ipinfo.io)...\n");
-    result = configure_https_client(GEO_SERVER_HOST, GEO_PORT);
-    if (CY_RSLT_SUCCESS != result) {
-        ERR_INFO(("Failed to configure HTTP client for geolocation API.\n"));
-        return;
-    }
-
-    /* Connect the HTTP client to the geolocation server */
-    result = cy_http_client_connect(https_client, TRANSPORT_SEND_RECV_TIMEOUT_MS, TRANSPORT_SEND_RECV_TIMEOUT_MS);
-    if (CY_RSLT_SUCCESS != result) {
-        ERR_INFO(("Failed to connect to the geolocation server.\n"));
-        return;
-    }
+    /* The Wi-Fi icon follows the AP link; server closes don't affect it. */
+    ui_cmd_post_wifi(0u != cy_wcm_is_connected_to_ap());
 
-    printf("\nFetching geolocation data from ipinfo.io...\n");
     http_client_method = CY_HTTP_CLIENT_METHOD_GET;
+    fetch_state_changed = false;
 
-    result = send_http_request(https_client, http_client_method, GEO_PATH);
-    if (CY_RSLT_SUCCESS == result) {
-        printf("\nSuccessfully received geolocation response. Parsing JSON...\n");
-        // Parse the received JSON
-        parse_json_payload((const char *)response.body);
-    } else {
-        ERR_INFO(("Failed to fetch geolocation data.\n"));
-        return;
-    }
+    fetch_cycle_begin(&fetch_cycle, xTaskGetTickCount() * portTICK_PERIOD_MS);
+
+    while ((FETCH_ACTION_RUN == action) || (FETCH_ACTION_WAIT == action))
+    {
+        if (FETCH_ACTION_WAIT == action)
+        {
+            printf("\nRetrying %s in %lu ms\n", fetch_cycle_step_str(fetch_cycle.step),
+                   (unsigned long)fetch_cycle.wait_ms);
+            vTaskDelay(pdMS_TO_TICKS(fetch_cycle.wait_ms));
+        }
 
-    /* Step 2: Construct the weather API path dynamically */
-    char weather_path[256] = {0};
-    snprintf(weather_path, sizeof(weather_path),
-             "/v1/forecast?latitude=%s&longitude=%s&models=ukmo_seamless&current=temperature_2m,relative_humidity_2m,wind_speed_10m,weather_code", latitude, longitude);
+        outcome = (FETCH_STEP_GEO == fetch_cycle.step) ? fetch_geolocation() : fetch_weather();
 
-    /* Step 3: Fetch weather data (remaining steps are unchanged) */
-    printf("\nFetching weather data from Open-Meteo...\n");
-    result = configure_https_client(WEATHER_SERVER_HOST, WEATHER_PORT);
-    if (CY_RSLT_SUCCESS != result) {
-        ERR_INFO(("Failed to configure HTTP client for weather API.\n"));
-        return;
+        action = fetch_cycle_report(&fetch_cycle, outcome, xTaskGetTickCount() * portTICK_PERIOD_MS);
     }
 
-    result = cy_http_client_connect(https_client, TRANSPORT_SEND_RECV_TIMEOUT_MS, TRANSPORT_SEND_RECV_TIMEOUT_MS);
-    if (CY_RSLT_SUCCESS != result) {
-        ERR_INFO(("Failed to connect to weather server.\n"));
-        return;
+    success = (FETCH_ACTION_DONE == action);
+    if (!success) {
+        ERR_INFO(("Failed to fetch %s data; next cycle resumes there.\n",
+                  fetch_cycle_step_str(fetch_cycle.step)));
     }
 
-    printf("\nSending request to Weather API...\n");
-    result = send_http_request(https_client, http_client_method, weather_path);
-    if (CY_RSLT_SUCCESS != result) {
-        ERR_INFO(("Failed to fetch weather data.\n"));
+    /* A 304 or a failed step leaves the display as it is. */
+    if (fetch_state_changed) {
+        weather_state_publish(&fetch_state);
+        tft_task_notify();
     }
-    else{
-        parse_json_weather_payload((const char *)response.body, response.body_len);
+
+    poll_hints.now = 0;
+    poll_hints.observed = 0;
+    poll_hints.interval = 0;
+    if (civil_time_parse_http_date(fetch_state.date, &poll_hints.now)) {
+        geo_cache_check_expiry(poll_hints.now);
+    }
+    if (success && (fetch_state.interval > 0) &&
+        civil_time_parse_iso(fetch_state.observed, &poll_hints.observed)) {
+        poll_hints.interval = (uint32_t)fetch_state.interval;
     }
 
-    syncedAll = false;
+    http_conn_pool_print_stats();
+    tls_client_print_stats();
+    weather_hedge_print_stats();
+    cond_get_print_stats();
+
+    return success;
 }
 
 /*******************************************************************************
- * Function Name: http_request
+ * Function Name: http_outcome
  *******************************************************************************
  * Summary:
- *  The function handles an http request operation.
- *
- * Parameters:
- *  void
- *
- * Return:
- *  None.
+ *  Classifies the result of send_http_request() for the retry logic.
+ *  Transport errors, 429 and 5xx are worth retrying; other statuses except
+ *  2xx and 304 are not.
  *
  *******************************************************************************/
-static void http_request(void)
+static fetch_outcome_t http_outcome(const http_exchange_t *exchange, cy_rslt_t result)
 {
-    cy_rslt_t result = CY_RSLT_SUCCESS;
-
-   /* Send the HTTP request and body to the server, and receive the response
-    * from it.
-    */
-    result = send_http_request(https_client, http_client_method, GEO_PATH);
+    const cy_http_client_response_t *response = &exchange->response;
 
-    if(CY_RSLT_SUCCESS != result)
+    if (CY_RSLT_SUCCESS != result)
     {
-        ERR_INFO(("Failed to send the http request.\n"));
+        return FETCH_RETRY;
     }
-    else
+
+    if (((response->status_code >= 200U) && (response->status_code < 300U)) ||
+        (HTTP_STATUS_NOT_MODIFIED == response->status_code))
     {
-        printf("\r\nSuccessfully sent GET request to http server\r\n");
-        printf("\r\nThe http status code is :: %d\r\n",
-                 http_response.status_code);
+        return FETCH_OK;
     }
+
+    ERR_INFO(("HTTP status %u\n", response->status_code));
+    return ((429U == response->status_code) || (response->status_code >= 500U)) ? FETCH_RETRY : FETCH_FATAL;
 }
 
 /*******************************************************************************
- * JSON
- ********************************************************************************/
-/* Callback for JSON parsing */
-cy_rslt_t json_callback(cy_JSON_object_t* json_object, void* arg) 
+ * Function Name: fetch_geolocation
+ *******************************************************************************
+ * Summary:
+ *  Geolocation step. Fills in location, from the geolocation cache if it has
+ *  a usable entry and from the geolocation API otherwise. A fresh answer is
+ *  written back to the cache.
+ *
+ * Return:
+ *  fetch_outcome_t: FETCH_OK once location, city and timezone are set
+ *
+ *******************************************************************************/
+static fetch_outcome_t fetch_geolocation(void)
 {
-    if (json_object == NULL) {
-        printf("Error: NULL JSON object in callback!\n");
-        return CY_RSLT_JSON_GENERIC_ERROR;
-    }
-
-    // Debug: Log every key-value pair received
-    // printf("Debug: Callback invoked. Key: %.*s, Value: %.*s, Type: %d\n",
-    //        (int)json_object->object_string_length, json_object->object_string,
-    //        (int)json_object->value_length, json_object->value,
-    //        json_object->value_type);
-
-    // Handle "loc" key (for latitude and longitude)
-    if (strncmp(json_object->object_string, "loc", json_object->object_string_length) == 0 &&
-        strlen("loc") == json_object->object_string_length) {
-        // printf("Debug: Found key 'loc'. Parsing latitude and longitude...\n");
-
-        // Parse "loc" value, e.g., "12.9719,77.5937"
-        char temp[64] = {0};
-        snprintf(temp, sizeof(temp), "%.*s", json_object->value_length, json_object->value);
-
-        char* separator = strchr(temp, ',');
-        if (separator != NULL) {
-            *separator = '\0';  // Null-terminate latitude
-            snprintf(latitude, sizeof(latitude), "%s", temp);
-            snprintf(longitude, sizeof(longitude), "%s", separator + 1);  // Parse longitude
-            printf("Extracted -> Latitude: %s, Longitude: %s\n", latitude, longitude);
-        } else {
-            printf("Error: Could not split 'loc' into latitude and longitude!\n");
-        }
-    }
-    // Handle "timezone" key
-    else if (strncmp(json_object->object_string, "timezone", json_object->object_string_length) == 0 &&
-             strlen("timezone") == json_object->object_string_length) {
-        // printf("Debug: Found key 'timezone'. Extracting value...\n");
-        snprintf(timezone, sizeof(timezone), "%.*s",
-                 (int)json_object->value_length, json_object->value);
-        printf("Extracted -> Timezone: %s\n", timezone);
-    }
-    else if (strncmp(json_object->object_string, "city", json_object->object_string_length) == 0 &&
-             strlen("city") == json_object->object_string_length) {
-        // printf("Debug: Found key 'city'. Extracting value...\n");
-        snprintf(city, sizeof(city), "%.*s",
-                 (int)json_object->value_length, json_object->value);
-        printf("Extracted -> city: %s\n", city);
+    fetch_outcome_t outcome;
+    geo_cache_net_t net;
+
+    get_network_id(&net);
+
+    if (geo_cache_lookup(&net, &location)) {
+        printf("\nUsing cached geolocation: %s (%s,%s)\n",
+               location.city, location.latitude, location.longitude);
     }
     else {
-        // printf("Debug: Unhandled key: %.*s\n",
-        //        (int)json_object->object_string_length, json_object->object_string);
-    }
-
-    return CY_RSLT_SUCCESS;
-}
+        (void)memset(&location, 0, sizeof(location));
+        body_begin(&geo_exchange, geo_schema, &location);
+
+        printf("\nFetching geolocation data from %s...\n", GEO_SERVER_HOST);
+        outcome = http_outcome(&geo_exchange, send_http_request(&geo_exchange, GEO_SERVER_HOST, GEO_PORT,
+                                                                http_client_method, GEO_PATH, NULL));
+        if (FETCH_OK != outcome) {
+            return outcome;
+        }
+        store_response_headers(&geo_exchange.header_index);
 
-static cy_rslt_t json_weather_cb(cy_JSON_object_t *object, void *arg)
-{
-    if(object == NULL || object->object_string == NULL)
-        return CY_RSLT_SUCCESS;
+        printf("\nSuccessfully received geolocation response. Parsing JSON...\n");
+        // Finish parsing the received JSON
+        parse_json_payload();
+        if ('\0' == location.latitude[0]) {
+            return FETCH_RETRY;
+        }
+        if (0U != (geo_exchange.decoder.parser.fields_truncated & (1UL << JSON_KEY_CITY))) {
+            printf("City name truncated to %u bytes: %s\n",
+                   (unsigned int)strlen(location.city), location.city);
+        }
 
-    if (strncmp(object->object_string, "time", object->object_string_length) == 0 &&
-        object->value_type == JSON_STRING_TYPE)
-    {
-        snprintf(timedata, sizeof(timedata), "%.*s",
-                 (int)object->value_length, object->value);
-    }
-    else if (strncmp(object->object_string, "temperature_2m", object->object_string_length) == 0)
-    {
-        snprintf(temperature, sizeof(temperature), "%.*s",
-                 (int)object->value_length, object->value);
-    }
-    else if (strncmp(object->object_string, "relative_humidity_2m", object->object_string_length) == 0)
-    {
-        snprintf(hummidity, sizeof(hummidity), "%.*s",
-                 (int)object->value_length, object->value);
-    }
-    else if (strncmp(object->object_string, "wind_speed_10m", object->object_string_length) == 0)
-    {
-        snprintf(windspeed, sizeof(windspeed), "%.*s",
-                 (int)object->value_length, object->value);
+        if (civil_time_parse_http_date(fetch_state.date, &location.resolved_at)) {
+            location.net = net;
+            (void)geo_cache_store(&location);
+        }
     }
-    else if (strncmp(object->object_string, "weather_code", object->object_string_length) == 0)
-    {
-        snprintf(weathercode, sizeof(weathercode), "%.*s",
-                 (int)object->value_length, object->value);
+
+    if ((0 != strncmp(fetch_state.city, location.city, sizeof(fetch_state.city) - 1U)) ||
+        (0 != strncmp(fetch_state.timezone, location.timezone, sizeof(fetch_state.timezone) - 1U))) {
+        snprintf(fetch_state.city, sizeof(fetch_state.city), "%s", location.city);
+        snprintf(fetch_state.timezone, sizeof(fetch_state.timezone), "%s", location.timezone);
+        fetch_state_changed = true;
     }
 
-    return CY_RSLT_SUCCESS;
+    return FETCH_OK;
 }
 
-void parse_json_payload(const char* payload) {
-    if (payload == NULL || strlen(payload) == 0) {
-        printf("Error: Payload is empty or NULL!\n");
-        return;
+/*******************************************************************************
+ * Function Name: fetch_weather
+ *******************************************************************************
+ * Summary:
+ *  Weather step. Fetches the current conditions for location into
+ *  fetch_state from whichever provider answers first, see weather_hedge.
+ *  The request to the provider already shown is conditional once a response
+ *  has been parsed; a 304 answer leaves fetch_state as it is. Fresh data sets
+ *  fetch_state_changed.
+ *
+ * Return:
+ *  fetch_outcome_t: FETCH_OK once a response has been parsed or was 304
+ *
+ *******************************************************************************/
+static fetch_outcome_t fetch_weather(void)
+{
+    fetch_outcome_t outcome;
+    weather_provider_id_t provider;
+    const weather_provider_t *source;
+    weather_lane_t *winner;
+    http_exchange_t *exchange;
+    cond_get_entry_t *validators;
+    uint32_t lane;
+    uint32_t now = 0;
+    uint32_t parse_us;
+
+    outcome = weather_hedge_run(&lane, &provider);
+    if (FETCH_OK != outcome) {
+        return outcome;
     }
 
-    // printf("Debug: Raw payload: %s\n", payload);
+    source = &weather_providers[provider];
+    winner = &weather_lanes[lane];
+    exchange = &winner->exchange;
 
-    // Validate JSON structure
-    char* json_end = strchr(payload, '}');
-    if (json_end == NULL) {
-        printf("Error: Payload does not contain a valid JSON object!\n");
-        return;
-    }
-
-    size_t json_length = json_end - payload + 1;
-    char valid_json[json_length + 1];
-    strncpy(valid_json, payload, json_length);
-    valid_json[json_length] = '\0';
+    store_response_headers(&exchange->header_index);
+    (void)civil_time_parse_http_date(fetch_state.date, &now);
 
-    // printf("Debug: Valid JSON payload: %s\n", valid_json);
+    validators = cond_get_lookup(source->host, winner->path);
 
-    // Debug: Add callback registration validation
-    cy_rslt_t reg_result = cy_JSON_parser_register_callback(json_callback, NULL);
-    if (reg_result != CY_RSLT_SUCCESS) {
-        printf("Error: Failed to register JSON callback! Error: %ld\n", (long)reg_result);
-        return;
+    if (HTTP_STATUS_NOT_MODIFIED == exchange->response.status_code) {
+        /* fetch_state still holds the data this response confirms. */
+        printf("Weather data from %s not modified; parse and UI update skipped.\n", source->name);
+        cond_get_not_modified(validators, now);
+        return FETCH_OK;
     }
 
-    // printf("Debug: Callback registered. Starting parsing...\n");
-
-    // Call the parser and capture result
-    cy_rslt_t result = cy_JSON_parser(valid_json, json_length);
-    if (result != CY_RSLT_SUCCESS) {
-        printf("Error: Failed to parse JSON payload! Error: %ld\n", (long)result);
-        return;
+    printf("Weather from %s:\n", source->name);
+    printf("Temperature: %s °C\n", winner->state.temperature);
+    printf("Humidity: %s %%\n", winner->state.humidity);
+    printf("Wind Speed: %s km/h\n", winner->state.windspeed);
+    printf("Weather Code: %ld\n", (long)winner->state.weather_code);
+    printf("Observed: %s, every %ld s\n", winner->state.observed, (long)winner->state.interval);
+
+    (void)memcpy(fetch_state.temperature, winner->state.temperature, sizeof(fetch_state.temperature));
+    (void)memcpy(fetch_state.humidity, winner->state.humidity, sizeof(fetch_state.humidity));
+    (void)memcpy(fetch_state.windspeed, winner->state.windspeed, sizeof(fetch_state.windspeed));
+    fetch_state.weather_code = winner->state.weather_code;
+    (void)memcpy(fetch_state.observed, winner->state.observed, sizeof(fetch_state.observed));
+    fetch_state.interval = winner->state.interval;
+    shown_provider = provider;
+    fetch_state_changed = true;
+
+    /* Validators the request did not carry must not be counted as sent. */
+    if (!winner->conditional) {
+        cond_get_forget(validators);
     }
-
-    // printf("Debug: Parsing complete. Extracted values:\n");
-    printf("Latitude: %s\n", latitude);
-    printf("Longitude: %s\n", longitude);
-    printf("Timezone: %s\n", timezone);
+    parse_us = exchange->decoder.parse_cycles / (SystemCoreClock / 1000000UL);
+    cond_get_store(validators, &exchange->header_index, exchange->body_stream.received, parse_us, now);
+    return FETCH_OK;
 }
 
-void parse_json_weather_payload(const char* payload, uint32_t payload_len)
+/*******************************************************************************
+ * Function Name: weather_lane_prepare
+ *******************************************************************************
+ * Summary:
+ *  weather_hedge prepare step: builds the provider's request path for
+ *  location and, for the provider shown, copies its validators out of the
+ *  conditional request cache.
+ *
+ *******************************************************************************/
+static void weather_lane_prepare(uint32_t lane, weather_provider_id_t provider)
 {
-    if (payload == NULL || payload_len == 0) {
-        printf("Error: Payload is NULL or empty!\n");
-        return;
-    }
+    const weather_provider_t *source = &weather_providers[provider];
+    weather_lane_t *entry = &weather_lanes[lane];
 
-    // Copy payload into mutable buffer
-    char *json_buf = malloc(payload_len + 1);
-    if (!json_buf) {
-        printf("Error: malloc failed!\n");
-        return;
-    }
-    memcpy(json_buf, payload, payload_len);
-    json_buf[payload_len] = '\0'; // null terminate
+    source->build_path(entry->path, sizeof(entry->path), &location);
 
-    // Register callback (do once globally ideally)
-    cy_rslt_t reg_result = cy_JSON_parser_register_callback(json_weather_cb, NULL);
-    if (reg_result != CY_RSLT_SUCCESS) {
-        printf("Error: Failed to register JSON callback! Error: %ld\n", (long)reg_result);
-        free(json_buf);
-        return;
+    entry->conditional = (provider == shown_provider);
+    if (entry->conditional) {
+        entry->validators = *cond_get_lookup(source->host, entry->path);
     }
+}
 
-    // Call parser
-    cy_rslt_t result = cy_JSON_parser(json_buf, payload_len);
-
-    if (result == CY_RSLT_SUCCESS)
-    {
-        printf("Time(GMT): %s\n", timedata);
-        printf("Temperature: %s °C\n", temperature);
-        printf("Humidity: %s %%\n", hummidity);
-        printf("Wind Speed: %s km/h\n", windspeed);
-        printf("Weather Code: %s\n", weathercode);
-    }
-    else
-    {
-        printf("JSON parsing failed! Error: 0x%08lX\n", (long)result);
+/*******************************************************************************
+ * Function Name: weather_lane_fetch
+ *******************************************************************************
+ * Summary:
+ *  weather_hedge fetch step, run in a lane task: requests the current
+ *  conditions from the provider and parses them into the lane's own
+ *  weather_state_t, in the Open-Meteo conventions.
+ *
+ * Return:
+ *  fetch_outcome_t: FETCH_OK once the response has been parsed or was 304
+ *
+ *******************************************************************************/
+static fetch_outcome_t weather_lane_fetch(uint32_t lane, weather_provider_id_t provider)
+{
+    const weather_provider_t *source = &weather_providers[provider];
+    weather_lane_t *entry = &weather_lanes[lane];
+    http_exchange_t *exchange = &entry->exchange;
+    fetch_outcome_t outcome;
+
+    (void)memset(&entry->state, 0, sizeof(entry->state));
+    body_begin(exchange, source->schema, &entry->state);
+
+    printf("\nFetching weather data from %s...\n", source->name);
+    outcome = http_outcome(exchange, send_http_request(exchange, source->host, source->port, http_client_method,
+                                                       entry->path, entry->conditional ? &entry->validators : NULL));
+    if ((FETCH_OK != outcome) || (HTTP_STATUS_NOT_MODIFIED == exchange->response.status_code)) {
+        return outcome;
     }
 
-    temperatureSynced = false;
-    humiditySynced = false;
-    windSynced = false;
-    rainSynced = false;
+    if (!parse_json_weather_payload(exchange)) {
+        return FETCH_RETRY;
+    }
 
-    free(json_buf);
+    if (NULL != source->map) {
+        source->map(&entry->state);
+    }
+    return FETCH_OK;
 }
 
-
 /*******************************************************************************
- * Data Sync
+ * JSON
  ********************************************************************************/
-void sync_temperature(bool flag)
+/*******************************************************************************
+ * Function Name: json_sink
+ *******************************************************************************
+ * Summary:
+ *  inflate_sink_t that passes decompressed body text on to the JSON
+ *  extractor.
+ *
+ *******************************************************************************/
+static bool json_sink(void *arg, const uint8_t *data, size_t len)
 {
-    if(!flag)
-    {
-        lv_label_set_text(ui_Temperature, temperature);
-        flag = true;
-    }     
+    return json_extract_feed((json_extract_t *)arg, (const char *)data, len);
 }
 
-void sync_humidity(bool flag)
+/*******************************************************************************
+ * Function Name: body_begin
+ *******************************************************************************
+ * Summary:
+ *  Sets up the body decoder of an exchange for its next response: the JSON
+ *  goes into target as described by schema.
+ *
+ *******************************************************************************/
+static void body_begin(http_exchange_t *exchange, const json_field_t *schema, void *target)
 {
-    if(!flag)
-    {
-        lv_label_set_text(ui_Humidity, hummidity);
-        flag = true;
-    }
-} 
+    body_decoder_t *decoder = &exchange->decoder;
 
-void sync_windspeed(bool flag)
-{
-    if(!flag)
-    {
-        lv_label_set_text(ui_WindSpeed, windspeed);
-        flag = true;
-    }
+    json_extract_init(&decoder->parser, schema, target);
+    decoder->started = false;
+    decoder->inflating = false;
+    decoder->failed = false;
+    decoder->parse_cycles = 0;
 }
 
-void sync_rain(bool flag)
+/*******************************************************************************
+ * Function Name: body_start
+ *******************************************************************************
+ * Summary:
+ *  Chooses how to decode the body from its Content-Encoding, once the first
+ *  piece has arrived and the response headers are indexed. A gzip or deflate
+ *  body is inflated on the way into the parser, one window at a time, so the
+ *  decompressed text is never held in full. This is also where a weather lane
+ *  learns that its response has started.
+ *
+ * Return:
+ *  bool: false for a content coding that cannot be decoded
+ *
+ *******************************************************************************/
+static bool body_start(http_exchange_t *exchange)
 {
-    if(!flag)
+    body_decoder_t *decoder = &exchange->decoder;
+    const char *coding;
+    size_t coding_len;
+    inflate_format_t format;
+
+    decoder->started = true;
+    weather_hedge_first_byte();
+
+    if (!http_header_index_get(&exchange->header_index, HTTP_HDR_CONTENT_ENCODING, &coding, &coding_len) ||
+        ((8U == coding_len) && (0 == strncasecmp(coding, "identity", 8))))
     {
-        int code = atoi(weathercode);  // weathercode extracted from JSON
-
-        // Codes that indicate precipitation
-        bool is_rain = (
-                        code == 51 || code == 53 || code == 55 ||   // Drizzle
-                        code == 56 || code == 57 ||                 // Freezing drizzle
-                        code == 61 || code == 63 || code == 65 ||   // Rain
-                        code == 66 || code == 67 ||                 // Freezing rain
-                        code == 80 || code == 81 || code == 82 ||   // Rain showers
-                        code == 95 || code == 96 || code == 99      // Thunderstorm / hail
-                        );
-
-        if(is_rain)
-            lv_label_set_text(ui_Rain, "Y");
-        else
-            lv_label_set_text(ui_Rain, "N");
-            
-        flag = true;
+        return true;
     }
-}
 
-int month_str_to_index(const char* month)
-{
-    const char* months[] = {"Jan","Feb","Mar","Apr","May","Jun",
-                            "Jul","Aug","Sep","Oct","Nov","Dec"};
-    for(int i=0;i<12;i++)
+    if ((4U == coding_len) && (0 == strncasecmp(coding, "gzip", 4)))
     {
-        if(strncmp(months[i], month, 3) == 0)
-            return i;
+        format = INFLATE_FORMAT_GZIP;
     }
-    return 0;
+    else if ((7U == coding_len) && (0 == strncasecmp(coding, "deflate", 7)))
+    {
+        format = INFLATE_FORMAT_DEFLATE;
+    }
+    else
+    {
+        ERR_INFO(("Unsupported Content-Encoding: %.*s\n", (int)coding_len, coding));
+        return false;
+    }
+
+    inflate_stream_init(&exchange->inflater, format, json_sink, &decoder->parser);
+    decoder->inflating = true;
+    return true;
 }
 
-time_t timegm(struct tm *t)
+/*******************************************************************************
+ * Function Name: body_sink
+ *******************************************************************************
+ * Summary:
+ *  http_stream_sink_t for response bodies: decodes each piece as it arrives
+ *  and runs it through the JSON extractor.
+ *
+ *******************************************************************************/
+static bool body_sink(void *arg, const uint8_t *data, size_t len)
 {
-    // Save current timezone
-    char *tz = getenv("TZ");
-    setenv("TZ", "UTC", 1);
-    tzset(); // apply new TZ
+    http_exchange_t *exchange = (http_exchange_t *)arg;
+    body_decoder_t *decoder = &exchange->decoder;
+    uint32_t start = DWT->CYCCNT;
+    inflate_status_t status;
 
-    time_t result = mktime(t); // mktime interprets t as local time (now UTC)
+    if (!decoder->started && !body_start(exchange))
+    {
+        decoder->failed = true;
+    }
+
+    if (decoder->failed)
+    {
+        return false;
+    }
 
-    // Restore previous timezone
-    if (tz)
-        setenv("TZ", tz, 1);
+    if (decoder->inflating)
+    {
+        status = inflate_stream_feed(&exchange->inflater, data, len);
+        decoder->failed = (INFLATE_OK != status) && (INFLATE_DONE != status);
+    }
     else
-        unsetenv("TZ");
-    tzset();
+    {
+        decoder->failed = !json_extract_feed(&decoder->parser, (const char *)data, len);
+    }
 
-    return result;
+    decoder->parse_cycles += DWT->CYCCNT - start;
+    return !decoder->failed;
 }
 
-void sync_time(const char* http_headers, float timezone_offset_hours)
+/*******************************************************************************
+ * Function Name: body_finish
+ *******************************************************************************
+ * Summary:
+ *  Completes the decoding of a body once the last piece has been passed to
+ *  body_sink().
+ *
+ * Return:
+ *  bool: true if the whole body arrived, decoded and parsed
+ *
+ *******************************************************************************/
+static bool body_finish(http_exchange_t *exchange)
 {
-    if(time_synced || http_headers == NULL)
-        return;
+    body_decoder_t *decoder = &exchange->decoder;
+    uint32_t start = DWT->CYCCNT;
+    inflate_status_t status;
+    bool ok;
+
+    if (!decoder->started) {
+        printf("Error: Payload is empty!\n");
+        return false;
+    }
 
-    char exact_time[64] = {0};
+    ok = !decoder->failed && exchange->body_stream.complete;
 
-    // Extract Date header
-    char *date_ptr = strstr(http_headers, "Date:");
-    if(date_ptr)
+    if (decoder->inflating)
     {
-        date_ptr += 5;
-        while(*date_ptr == ' ') date_ptr++;
-        char *end = strpbrk(date_ptr, "\r\n");
-        if(end != NULL && (end - date_ptr) < sizeof(exact_time))
+        status = inflate_stream_finish(&exchange->inflater);
+        if (INFLATE_DONE != status)
         {
-            strncpy(exact_time, date_ptr, end - date_ptr);
-            exact_time[end - date_ptr] = '\0';
+            ERR_INFO(("Failed to decode body: %s\n", inflate_stream_status_str(status)));
+            if (INFLATE_ERR_WINDOW == status)
+            {
+                printf("Compressed bodies turned off: %u byte inflate window too small\n",
+                       (unsigned int)INFLATE_WINDOW_SIZE);
+                compression_refused = true;
+            }
+            ok = false;
         }
         else
         {
-            strncpy(exact_time, date_ptr, sizeof(exact_time)-1);
-            exact_time[sizeof(exact_time)-1] = '\0';
+            printf("Decoded body: %lu -> %lu bytes\n",
+                   (unsigned long)exchange->inflater.total_in, (unsigned long)exchange->inflater.total_out);
         }
     }
 
-    if(strlen(exact_time) == 0)
-        return;
+    ok = json_extract_finish(&decoder->parser) && ok;
 
-    // Parse GMT time
-    int day, month, year, hour, min, sec;
-    char month_str[4];
-    if(sscanf(exact_time, "%*3s, %d %3s %d %d:%d:%d",
-              &day, month_str, &year, &hour, &min, &sec) == 6)
-    {
-        // Fill struct tm
-        current_time.tm_year = year - 1900;
-        current_time.tm_mon  = month_str_to_index(month_str);
-        current_time.tm_mday = day;
-        current_time.tm_hour = hour;
-        current_time.tm_min  = min;
-        current_time.tm_sec  = sec;
-
-        // Convert GMT to local by offset
-        time_t gmt_time = timegm(&current_time);
-        gmt_time += (int)(timezone_offset_hours * 3600);
-        gmtime_r(&gmt_time, &current_time);  // local time
-
-        // Update LVGL labels once
-        char hour_str[3], min_str[3], day_str[3];
-        snprintf(hour_str, sizeof(hour_str), "%02d", current_time.tm_hour);
-        snprintf(min_str, sizeof(min_str), "%02d", current_time.tm_min);
-        snprintf(day_str, sizeof(day_str), "%02d", current_time.tm_mday);
-
-        lv_label_set_text(ui_HHH, hour_str);
-        lv_label_set_text(ui_MMM, min_str); 
-        lv_label_set_text(ui_Date, day_str);
-
-        const char* months[] = {"Jan","Feb","Mar","Apr","May","Jun",
-                                "Jul","Aug","Sep","Oct","Nov","Dec"};
-        lv_label_set_text(ui_Month, months[current_time.tm_mon]);
-
-        const char* weekdays[] = {"Sun","Mon","Tue","Wed","Thu","Fri","Sat"};
-        lv_label_set_text(ui_Vaar, weekdays[current_time.tm_wday]);
-
-        time_synced = true;
-    }
+    decoder->parse_cycles += DWT->CYCCNT - start;
+    latency_hist_record_cycles(LATENCY_PHASE_PARSE, decoder->parse_cycles);
+    return ok;
 }
 
-void sync_location(bool flag)
+/*******************************************************************************
+ * Function Name: parse_json_payload
+ *******************************************************************************
+ * Summary:
+ *  Finishes extracting the location from the ipinfo.io response body into
+ *  location. The body was parsed while it arrived, and inflated on the fly if
+ *  it was compressed.
+ *
+ *******************************************************************************/
+void parse_json_payload(void)
 {
-    if(!flag)
-    {
-        char buffer[40];
-        sprintf(buffer, "%s", city);
-    
-        lv_label_set_text(ui_Location, buffer);
-
-        flag = true;
+    if (!body_finish(&geo_exchange)) {
+        printf("Error: Failed to parse JSON payload!\n");
+        location.latitude[0] = '\0';
+        return;
     }
+
+    printf("Latitude: %s\n", location.latitude);
+    printf("Longitude: %s\n", location.longitude);
+    printf("Timezone: %s\n", location.timezone);
+    printf("City: %s\n", location.city);
 }
 
-void sync_all_data(bool flag)
+/*******************************************************************************
+ * Function Name: parse_json_weather_payload
+ *******************************************************************************
+ * Summary:
+ *  Finishes extracting the current conditions from a weather response body
+ *  into the target given to body_begin(). The body was parsed while it
+ *  arrived, and inflated on the fly if it was compressed.
+ *
+ * Return:
+ *  bool: true if the body was parsed completely
+ *
+ *******************************************************************************/
+bool parse_json_weather_payload(http_exchange_t *exchange)
 {
-    if(!flag)
+    if (body_finish(exchange))
     {
-        sync_temperature(temperatureSynced);
-        sync_humidity(humiditySynced);
-        sync_windspeed(windSynced);
-        sync_rain(rainSynced);
-        sync_time((const char *)response.header, IST);
-        sync_location(locationSynced);
-
-        flag = true;
+        return true;
     }
-}
\ No newline at end of file
+
+    printf("JSON parsing failed after %lu fields\n", (unsigned long)exchange->decoder.parser.fields_set);
+    return false;
+}
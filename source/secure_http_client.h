@@ -77,15 +77,37 @@
                                              CY_ASSERT(0);              \
                                          }                              \
                                      } while(0);
+/* Connections to this port are made over TLS, verified against the trust
+ * anchor in configs/trust_anchor.pem. */
+#define HTTPS_PORT                                  (443)
+
+#if defined(MOCK_SERVER_HOST)
+/* Geolocation and both weather providers answered by mockserver/ on the
+ * local network, with the latency it is told to inject. */
+#define WEATHER_SERVER_HOST                         MOCK_SERVER_HOST
+#define WEATHER_PORT                                (8081)
+#define WEATHER_ALT_SERVER_HOST                     MOCK_SERVER_HOST
+#define WEATHER_ALT_PORT                            (8082)
+#define GEO_SERVER_HOST                             MOCK_SERVER_HOST
+#define GEO_PORT                                    (8080)
+#else
 #define WEATHER_SERVER_HOST                         "api.open-meteo.com"
-#define WEATHER_PORT                                (80)
-#define WEATHER_PATH                                "/v1/forecast?latitude=12.9719&longitude=77.5937&current_weather=true"
+#define WEATHER_PORT                                (HTTPS_PORT)
+/* Second weather provider, asked when Open-Meteo is slow or failing. */
+#define WEATHER_ALT_SERVER_HOST                     "wttr.in"
+#define WEATHER_ALT_PORT                            (HTTPS_PORT)
 #define GEO_SERVER_HOST                             "ipinfo.io"
 #define GEO_PORT                                    (80)
+#endif
+#define WEATHER_PATH                                "/v1/forecast?latitude=12.9719&longitude=77.5937&current_weather=true"
 #define GEO_PATH                                    "/json"
 
 #define TRANSPORT_SEND_RECV_TIMEOUT_MS           (5000)
 #define HTTP_GET_BUFFER_LENGTH                   (2048 * 4)
+
+/* Content codings offered to the servers. Define as "" to only accept plain
+ * bodies. */
+#define HTTP_ACCEPT_ENCODING                     "gzip, deflate"
 #define REQUEST_BODY                             (NULL)
 #define HTTP_GET_PATH_AFTER_PUT                  "/"
 #define REQUEST_BODY_LENGTH                      ( 0 )
@@ -101,8 +123,9 @@
 /* Start Range from where the server should return. */
 #define HTTP_REQUEST_RANGE_START                 (0U)
 
-/* Number of headers in the header list */
-#define NUM_HTTP_HEADERS                         (1U)
+/* Number of headers in the header list: Connection and Accept-Encoding,
+ * plus If-None-Match and If-Modified-Since on conditional requests. */
+#define NUM_HTTP_HEADERS                         (4U)
 
 /* Length of the request header. */
 #define HTTP_REQUEST_HEADER_LEN                  (0U)
@@ -117,7 +140,6 @@
         "3. HTTPS_PUT_METHOD\n"                                                     \
         "4. HTTPS_GET_METHOD_AFTER_PUT\n"                                           \
 
-#define IST                                           (5.5)
 /******************************************************
  *                   Enumerations
  ******************************************************/
@@ -135,15 +157,6 @@ typedef enum
 ********************************************************************************/
 void https_client_task(void *arg);
 
-void sync_temperature(bool flag);
-void sync_humidity(bool flag);
-void sync_windspeed(bool flag);
-void sync_rain(bool flag);
-void sync_time(const char* http_headers, float timezone_offset_hours);
-void sync_location(bool flag);
-
-void sync_all_data(bool flag);
-
 #endif /* SECURE_HTTP_CLIENT_H_ */
 
 
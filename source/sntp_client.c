@@ -0,0 +1,443 @@
+/******************************************************************************
+*
+* File Name: sntp_client.c
+*
+* Description: This file contains the SNTP client (RFC 4330). Each poll
+* sends a few requests to one server of the pool. The answer with the
+* shortest round trip corrects the timekeeper, with the offset taken halfway
+* through the round trip. Polls are frequent until the offsets stay small,
+* then back off to hourly.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Header file includes */
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+/* FreeRTOS header file */
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "cy_secure_sockets.h"
+#include "sntp_client.h"
+#include "timekeeper.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SNTP_TASK_STACK_SIZE                     (3U * 1024U)
+#define SNTP_TASK_PRIORITY                       (configMAX_PRIORITIES - 3)
+
+#define SNTP_PACKET_LEN                          (48U)
+
+/* LI 0, version 4, mode 3 (client). */
+#define SNTP_CLIENT_HEADER                       (0x23U)
+#define SNTP_MODE_SERVER                         (4U)
+#define SNTP_LI_UNSYNCHRONIZED                   (3U)
+
+/* Versions accepted in an answer, as RFC 4330 asks of a client. */
+#define SNTP_VERSION_MIN                         (3U)
+#define SNTP_VERSION_MAX                         (4U)
+
+#define SNTP_ORIGINATE_OFFSET                    (24U)
+#define SNTP_RECEIVE_OFFSET                      (32U)
+#define SNTP_TRANSMIT_OFFSET                     (40U)
+
+/* Seconds from 1900, the NTP epoch, to 1970. */
+#define SNTP_UNIX_OFFSET_S                       (2208988800ULL)
+
+/* Local timestamps are whole milliseconds. */
+#define SNTP_LOCAL_RESOLUTION_MS                 (1U)
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+typedef struct
+{
+    int64_t offset_ms;
+    uint32_t delay_ms;
+    uint8_t stratum;
+} sntp_sample_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char *const sntp_servers[] = { SNTP_SERVERS };
+#define SNTP_SERVER_COUNT                        (sizeof(sntp_servers) / sizeof(sntp_servers[0]))
+
+static sntp_client_stats_t sntp_client_stats;
+
+static TaskHandle_t sntp_task_handle;
+
+/*******************************************************************************
+ * Function Name: sntp_put_timestamp
+ *******************************************************************************
+ * Summary:
+ *  Writes ms since 1970 as an NTP timestamp.
+ *
+ *******************************************************************************/
+static void sntp_put_timestamp(uint8_t *p, uint64_t ms)
+{
+    uint32_t seconds = (uint32_t)((ms / 1000U) + SNTP_UNIX_OFFSET_S);
+    uint32_t fraction = (uint32_t)(((ms % 1000U) << 32) / 1000U);
+
+    for (uint32_t i = 0; i < 4U; i++)
+    {
+        p[i] = (uint8_t)(seconds >> (24U - (8U * i)));
+        p[4U + i] = (uint8_t)(fraction >> (24U - (8U * i)));
+    }
+}
+
+/*******************************************************************************
+ * Function Name: sntp_get_timestamp
+ *******************************************************************************
+ * Summary:
+ *  Reads an NTP timestamp as ms since 1970. Seconds with the top bit clear
+ *  are taken to be in the era that starts in 2036.
+ *
+ *******************************************************************************/
+static int64_t sntp_get_timestamp(const uint8_t *p)
+{
+    uint64_t seconds = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+    uint64_t fraction = ((uint32_t)p[4] << 24) | ((uint32_t)p[5] << 16) | ((uint32_t)p[6] << 8) | p[7];
+
+    if (0U == (seconds & 0x80000000ULL))
+    {
+        seconds += 0x100000000ULL;
+    }
+    return (int64_t)(((seconds - SNTP_UNIX_OFFSET_S) * 1000U) + ((fraction * 1000U) >> 32));
+}
+
+/*******************************************************************************
+ * Function Name: sntp_query
+ *******************************************************************************
+ * Summary:
+ *  Sends one request and takes one answer. The request's transmit time must
+ *  come back as the answer's originate time, which drops late answers to
+ *  earlier requests.
+ *
+ * Parameters:
+ *  sock: UDP socket
+ *  server: address of the server
+ *  sample: receives the offset, round trip and stratum
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS, a socket error, or CY_RSLT_TYPE_ERROR if the
+ *  answer is unusable
+ *
+ *******************************************************************************/
+static cy_rslt_t sntp_query(cy_socket_t sock, const cy_socket_sockaddr_t *server, sntp_sample_t *sample)
+{
+    uint8_t packet[SNTP_PACKET_LEN];
+    uint8_t sent_stamp[8];
+    cy_socket_sockaddr_t from;
+    uint32_t from_len = sizeof(from);
+    uint32_t count;
+    uint64_t t1, t4;
+    int64_t t2, t3;
+    cy_rslt_t result;
+
+    (void)memset(packet, 0, sizeof(packet));
+    packet[0] = SNTP_CLIENT_HEADER;
+    t1 = timekeeper_now_ms();
+    sntp_put_timestamp(&packet[SNTP_TRANSMIT_OFFSET], t1);
+    (void)memcpy(sent_stamp, &packet[SNTP_TRANSMIT_OFFSET], sizeof(sent_stamp));
+
+    result = cy_socket_sendto(sock, packet, sizeof(packet), CY_SOCKET_FLAGS_NONE,
+                              server, sizeof(*server), &count);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+
+    do
+    {
+        result = cy_socket_recvfrom(sock, packet, sizeof(packet), CY_SOCKET_FLAGS_NONE,
+                                    &from, &from_len, &count);
+        t4 = timekeeper_now_ms();
+        if (CY_RSLT_SUCCESS != result)
+        {
+            return result;
+        }
+    } while ((count < SNTP_PACKET_LEN) ||
+             (0 != memcmp(&packet[SNTP_ORIGINATE_OFFSET], sent_stamp, sizeof(sent_stamp))));
+
+    /* Only a server answer can carry a kiss of death. */
+    if (((packet[0] & 0x07U) != SNTP_MODE_SERVER) ||
+        (((packet[0] >> 3) & 0x07U) < SNTP_VERSION_MIN) || (((packet[0] >> 3) & 0x07U) > SNTP_VERSION_MAX))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    sample->stratum = packet[1];
+    if (0U == sample->stratum)
+    {
+        sntp_client_stats.kiss_of_death++;
+        printf("SNTP: kiss of death \"%.4s\"\n", (const char *)&packet[12]);
+        return CY_RSLT_TYPE_ERROR;
+    }
+    if (((packet[0] >> 6) == SNTP_LI_UNSYNCHRONIZED) || (sample->stratum > 15U))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    t2 = sntp_get_timestamp(&packet[SNTP_RECEIVE_OFFSET]);
+    t3 = sntp_get_timestamp(&packet[SNTP_TRANSMIT_OFFSET]);
+
+    /* The server's time is taken halfway through the network part of the
+     * round trip, leaving out the time it spent on the request. */
+    sample->offset_ms = ((t2 - (int64_t)t1) + (t3 - (int64_t)t4)) / 2;
+    sample->delay_ms = (((int64_t)(t4 - t1) - (t3 - t2)) > 0) ? (uint32_t)((int64_t)(t4 - t1) - (t3 - t2)) : 0U;
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+ * Function Name: sntp_poll
+ *******************************************************************************
+ * Summary:
+ *  Asks one server SNTP_SAMPLES times and keeps the answer with the
+ *  shortest round trip, the one least skewed by queueing on the way.
+ *
+ * Parameters:
+ *  host: server name
+ *  best: receives the chosen answer
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS if any request was answered
+ *
+ *******************************************************************************/
+static cy_rslt_t sntp_poll(const char *host, sntp_sample_t *best)
+{
+    cy_socket_sockaddr_t server;
+    cy_socket_t sock;
+    uint32_t timeout = SNTP_TIMEOUT_MS;
+    bool answered = false;
+    cy_rslt_t result;
+
+    (void)memset(&server, 0, sizeof(server));
+    result = cy_socket_gethostbyname(host, CY_SOCKET_IP_VER_V4, &server.ip_address);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+    server.port = SNTP_PORT;
+
+    result = cy_socket_create(CY_SOCKET_DOMAIN_AF_INET, CY_SOCKET_TYPE_DGRAM, CY_SOCKET_IPPROTO_UDP, &sock);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        return result;
+    }
+    (void)cy_socket_setsockopt(sock, CY_SOCKET_SOL_SOCKET, CY_SOCKET_SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    for (uint32_t i = 0; i < SNTP_SAMPLES; i++)
+    {
+        sntp_sample_t sample;
+
+        if (0U != i)
+        {
+            vTaskDelay(pdMS_TO_TICKS(SNTP_SAMPLE_GAP_MS));
+        }
+        if ((CY_RSLT_SUCCESS == sntp_query(sock, &server, &sample)) &&
+            (!answered || (sample.delay_ms < best->delay_ms)))
+        {
+            *best = sample;
+            answered = true;
+        }
+    }
+
+    (void)cy_socket_delete(sock);
+    return answered ? CY_RSLT_SUCCESS : CY_RSLT_TYPE_ERROR;
+}
+
+/*******************************************************************************
+ * Function Name: sntp_http_date_notify
+ *******************************************************************************
+ * Summary:
+ *  Wakes the SNTP task to apply a Date header; see sntp_wait().
+ *
+ *******************************************************************************/
+static void sntp_http_date_notify(void)
+{
+    (void)xTaskNotifyGive(sntp_task_handle);
+}
+
+/*******************************************************************************
+ * Function Name: sntp_wait
+ *******************************************************************************
+ * Summary:
+ *  Sleeps until the next poll, applying each Date header the timekeeper is
+ *  given meanwhile.
+ *
+ *******************************************************************************/
+static void sntp_wait(uint32_t wait_s)
+{
+    TickType_t start = xTaskGetTickCount();
+    TickType_t period = pdMS_TO_TICKS(wait_s * 1000U);
+    TickType_t elapsed;
+
+    timekeeper_apply_http_date();
+    while ((elapsed = xTaskGetTickCount() - start) < period)
+    {
+        (void)ulTaskNotifyTake(pdTRUE, period - elapsed);
+        timekeeper_apply_http_date();
+    }
+}
+
+/*******************************************************************************
+ * Function Name: sntp_task
+ *******************************************************************************
+ * Summary:
+ *  Polls the servers in turn, moving on after a failure, and hands every
+ *  answer to the timekeeper. Its uncertainty is half the round trip. Between
+ *  polls it applies the Date headers of HTTP responses, so that the slow
+ *  part of a correction never runs in the HTTP client task.
+ *
+ *******************************************************************************/
+static void sntp_task(void *arg)
+{
+    uint32_t server = 0;
+    uint32_t interval_s = SNTP_POLL_MIN_S;
+    CY_UNUSED_PARAMETER(arg);
+
+    /* Offsets are taken against the clock before they are applied, so the
+     * tick rate has to be known by then. */
+    timekeeper_calibrate();
+    timekeeper_set_http_date_notify(sntp_http_date_notify);
+
+    while (true)
+    {
+        const char *host = sntp_servers[server];
+        sntp_sample_t sample;
+        uint32_t wait_s;
+
+        sntp_client_stats.polls++;
+        sntp_client_stats.server = host;
+        if (CY_RSLT_SUCCESS == sntp_poll(host, &sample))
+        {
+            timekeeper_correct(TIMEKEEPER_SOURCE_SNTP, sample.offset_ms,
+                               (sample.delay_ms / 2U) + SNTP_LOCAL_RESOLUTION_MS);
+
+            if ((sample.offset_ms <= SNTP_STABLE_MS) && (sample.offset_ms >= -SNTP_STABLE_MS))
+            {
+                interval_s = ((2U * interval_s) < SNTP_POLL_MAX_S) ? (2U * interval_s) : SNTP_POLL_MAX_S;
+            }
+            else
+            {
+                interval_s = SNTP_POLL_MIN_S;
+            }
+            wait_s = interval_s;
+
+            /* A first answer can be decades off; long is 32 bits here. */
+            sntp_client_stats.last_offset_ms = (sample.offset_ms > INT32_MAX) ? INT32_MAX :
+                                               ((sample.offset_ms < INT32_MIN) ? INT32_MIN :
+                                                (int32_t)sample.offset_ms);
+            sntp_client_stats.last_delay_ms = sample.delay_ms;
+            sntp_client_stats.last_stratum = sample.stratum;
+            printf("SNTP %s stratum %u: offset %+ld ms, round trip %lu ms, next poll in %lu s\n",
+                   host, sample.stratum, (long)sntp_client_stats.last_offset_ms,
+                   (unsigned long)sample.delay_ms, (unsigned long)wait_s);
+        }
+        else
+        {
+            sntp_client_stats.failures++;
+            server = (server + 1U) % SNTP_SERVER_COUNT;
+            wait_s = SNTP_RETRY_S;
+            printf("SNTP %s failed, trying %s in %lu s\n", host, sntp_servers[server],
+                   (unsigned long)wait_s);
+        }
+
+        sntp_client_stats.interval_s = wait_s;
+        sntp_wait(wait_s);
+    }
+}
+
+/*******************************************************************************
+ * Function Name: sntp_client_init
+ *******************************************************************************
+ * Summary:
+ *  Starts polling. Call once the network is up and sockets are initialized.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS, or CY_RSLT_TYPE_ERROR if out of memory
+ *
+ *******************************************************************************/
+cy_rslt_t sntp_client_init(void)
+{
+    (void)memset(&sntp_client_stats, 0, sizeof(sntp_client_stats));
+
+    if (pdPASS != xTaskCreate(sntp_task, "SNTP", SNTP_TASK_STACK_SIZE, NULL, SNTP_TASK_PRIORITY,
+                              &sntp_task_handle))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+ * Function Name: sntp_client_get_stats
+ *******************************************************************************
+ * Summary:
+ *  Copies the poll counters and the last answer.
+ *
+ *******************************************************************************/
+void sntp_client_get_stats(sntp_client_stats_t *stats)
+{
+    taskENTER_CRITICAL();
+    *stats = sntp_client_stats;
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+ * Function Name: sntp_client_print_stats
+ *******************************************************************************
+ * Summary:
+ *  Prints the poll counts, the last answer and the poll interval.
+ *
+ *******************************************************************************/
+void sntp_client_print_stats(void)
+{
+    sntp_client_stats_t s;
+
+    sntp_client_get_stats(&s);
+    printf("SNTP polls %lu, failed %lu, kiss of death %lu; last %s stratum %u offset %+ld ms "
+           "round trip %lu ms; next poll in %lu s\n",
+           (unsigned long)s.polls, (unsigned long)s.failures, (unsigned long)s.kiss_of_death,
+           (NULL != s.server) ? s.server : "-", s.last_stratum, (long)s.last_offset_ms,
+           (unsigned long)s.last_delay_ms, (unsigned long)s.interval_s);
+}
+
+/* [] END OF FILE */
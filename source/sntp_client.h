@@ -0,0 +1,114 @@
+/******************************************************************************
+*
+* File Name: sntp_client.h
+*
+* Description: This file contains the SNTP client, which sets the
+* timekeeper from a pool of NTP servers over UDP.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef SNTP_CLIENT_H_
+#define SNTP_CLIENT_H_
+
+#include <stdint.h>
+#include "cy_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#if defined(MOCK_SERVER_HOST)
+/* mockserver/ answers SNTP too, with the clock offset it is told to fake. */
+#define SNTP_SERVERS                             MOCK_SERVER_HOST
+#define SNTP_PORT                                (8123U)
+#elif !defined(SNTP_SERVERS)
+#define SNTP_SERVERS                             "0.pool.ntp.org", "1.pool.ntp.org", \
+                                                 "2.pool.ntp.org", "3.pool.ntp.org"
+#endif
+
+#ifndef SNTP_PORT
+#define SNTP_PORT                                (123U)
+#endif
+
+/* Requests per poll, two seconds apart; the shortest round trip is used. */
+#define SNTP_SAMPLES                             (3U)
+#define SNTP_SAMPLE_GAP_MS                       (2000U)
+#define SNTP_TIMEOUT_MS                          (2000U)
+
+/* The poll interval doubles from the minimum while offsets stay within
+ * SNTP_STABLE_MS, and goes back to it when one does not. */
+#define SNTP_POLL_MIN_S                          (64U)
+#define SNTP_POLL_MAX_S                          (3600U)
+#define SNTP_STABLE_MS                           (50)
+
+/* Wait before asking the next server after a failed poll. */
+#define SNTP_RETRY_S                             (30U)
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+typedef struct
+{
+    uint32_t polls;
+    uint32_t failures;
+    uint32_t kiss_of_death;     /* answers telling the client to go away */
+    int32_t last_offset_ms;     /* server minus local, at the last good poll */
+    uint32_t last_delay_ms;     /* its round trip */
+    uint8_t last_stratum;
+    uint32_t interval_s;        /* until the next poll */
+    const char *server;         /* server of the last poll */
+} sntp_client_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+cy_rslt_t sntp_client_init(void);
+void sntp_client_get_stats(sntp_client_stats_t *stats);
+void sntp_client_print_stats(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SNTP_CLIENT_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,265 @@
+/******************************************************************************
+*
+* File Name: st7789v_bus.c
+*
+* Description: This file contains a burst write path for the ST7789V display
+* controller on the 8-bit 8080 parallel bus. The data lines are driven through
+* the port OUT_SET/OUT_CLR registers using per-port lookup tables built once
+* at start-up, so one bus byte costs a few register stores instead of nine
+* HAL calls.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <string.h>
+#include "cy_pdl.h"
+#include "cyhal.h"
+#include "st7789v_bus.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define BUS_DATA_WIDTH                   (8u)
+#define BUS_BYTE_VALUES                  (256u)
+
+/* Pixels written per iteration of the unrolled burst loop. */
+#define BUS_BURST_UNROLL                 (4u)
+
+/*******************************************************************************
+ * Data structure and enumeration
+ ******************************************************************************/
+/* One GPIO port that carries some of the data lines. set[v] holds the OUT_SET
+ * mask for byte value v; the bits of mask not in set[v] are cleared. */
+typedef struct
+{
+    GPIO_PRT_Type *base;
+    uint32_t mask;
+    uint32_t set[BUS_BYTE_VALUES];
+} bus_port_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static bus_port_t bus_ports[BUS_DATA_WIDTH];
+static uint32_t bus_port_count;
+
+static GPIO_PRT_Type *nwr_base;
+static uint32_t nwr_mask;
+static GPIO_PRT_Type *dc_base;
+static uint32_t dc_mask;
+
+/*******************************************************************************
+* Function Name: bus_write_byte
+********************************************************************************
+*
+* Summary: Places one byte on the data lines and strobes nWR. DC must already
+*          be in the required state.
+*
+*******************************************************************************/
+static inline void bus_write_byte(uint8_t value)
+{
+    for (uint32_t i = 0u; i < bus_port_count; i++)
+    {
+        const bus_port_t *port = &bus_ports[i];
+        uint32_t set = port->set[value];
+
+        GPIO_PRT_OUT_CLR(port->base) = port->mask & ~set;
+        GPIO_PRT_OUT_SET(port->base) = set;
+    }
+
+    GPIO_PRT_OUT_CLR(nwr_base) = nwr_mask;
+    GPIO_PRT_OUT_SET(nwr_base) = nwr_mask;
+}
+
+/*******************************************************************************
+* Function Name: bus_write_pixel
+********************************************************************************
+*
+* Summary: Writes one RGB565 pixel, high byte first as expected by COLMOD 0x65.
+*
+*******************************************************************************/
+static inline void bus_write_pixel(uint16_t pixel)
+{
+    bus_write_byte((uint8_t)(pixel >> 8));
+    bus_write_byte((uint8_t)(pixel & 0xFFu));
+}
+
+/*******************************************************************************
+* Function Name: cy_rslt_t st7789v_bus_init(const mtb_st7789v_pins_t *pins)
+********************************************************************************
+*
+* Summary: Builds the per-port lookup tables for the data lines. The pins must
+*          already be configured as outputs by mtb_st7789v_init8().
+*
+* Parameters:
+*  pins: the pin mapping passed to mtb_st7789v_init8()
+*
+* Return:
+*  CY_RSLT_SUCCESS, or CY_RSLT_TYPE_ERROR if pins is NULL
+*
+*******************************************************************************/
+cy_rslt_t st7789v_bus_init(const mtb_st7789v_pins_t *pins)
+{
+    if (NULL == pins)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    /* db08 carries bit 0 of the bus byte, db15 carries bit 7. */
+    const cyhal_gpio_t data_pins[BUS_DATA_WIDTH] =
+    {
+        pins->db08, pins->db09, pins->db10, pins->db11,
+        pins->db12, pins->db13, pins->db14, pins->db15
+    };
+
+    memset(bus_ports, 0, sizeof(bus_ports));
+    bus_port_count = 0u;
+
+    for (uint32_t bit = 0u; bit < BUS_DATA_WIDTH; bit++)
+    {
+        GPIO_PRT_Type *base = Cy_GPIO_PortToAddr(CYHAL_GET_PORT(data_pins[bit]));
+        uint32_t pin_mask = 1uL << CYHAL_GET_PIN(data_pins[bit]);
+        uint32_t i;
+
+        for (i = 0u; i < bus_port_count; i++)
+        {
+            if (bus_ports[i].base == base)
+            {
+                break;
+            }
+        }
+
+        if (i == bus_port_count)
+        {
+            bus_ports[i].base = base;
+            bus_port_count++;
+        }
+
+        bus_ports[i].mask |= pin_mask;
+        for (uint32_t value = 0u; value < BUS_BYTE_VALUES; value++)
+        {
+            if (0u != (value & (1uL << bit)))
+            {
+                bus_ports[i].set[value] |= pin_mask;
+            }
+        }
+    }
+
+    nwr_base = Cy_GPIO_PortToAddr(CYHAL_GET_PORT(pins->nwr));
+    nwr_mask = 1uL << CYHAL_GET_PIN(pins->nwr);
+    dc_base = Cy_GPIO_PortToAddr(CYHAL_GET_PORT(pins->dc));
+    dc_mask = 1uL << CYHAL_GET_PIN(pins->dc);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: void st7789v_bus_write_command(uint8_t command)
+********************************************************************************
+*
+* Summary: Writes a command byte (DC low) and leaves DC high for the
+*          parameters that follow.
+*
+*******************************************************************************/
+void st7789v_bus_write_command(uint8_t command)
+{
+    GPIO_PRT_OUT_CLR(dc_base) = dc_mask;
+    bus_write_byte(command);
+    GPIO_PRT_OUT_SET(dc_base) = dc_mask;
+}
+
+/*******************************************************************************
+* Function Name: void st7789v_bus_set_window(...)
+********************************************************************************
+*
+* Summary: Sets the column/row address window and issues RAMWR so that the
+*          next st7789v_bus_write_pixels() call fills it row by row.
+*
+* Parameters:
+*  x1, y1: top-left corner (inclusive)
+*  x2, y2: bottom-right corner (inclusive)
+*
+*******************************************************************************/
+void st7789v_bus_set_window(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    st7789v_bus_write_command(ST7789V_CMD_CASET);
+    bus_write_byte((uint8_t)(x1 >> 8));
+    bus_write_byte((uint8_t)(x1 & 0xFFu));
+    bus_write_byte((uint8_t)(x2 >> 8));
+    bus_write_byte((uint8_t)(x2 & 0xFFu));
+
+    st7789v_bus_write_command(ST7789V_CMD_RASET);
+    bus_write_byte((uint8_t)(y1 >> 8));
+    bus_write_byte((uint8_t)(y1 & 0xFFu));
+    bus_write_byte((uint8_t)(y2 >> 8));
+    bus_write_byte((uint8_t)(y2 & 0xFFu));
+
+    st7789v_bus_write_command(ST7789V_CMD_RAMWR);
+}
+
+/*******************************************************************************
+* Function Name: void st7789v_bus_write_pixels(const uint16_t *pixels, uint32_t count)
+********************************************************************************
+*
+* Summary: Streams count RGB565 pixels in the order they are stored. DC is
+*          set once for the whole burst and the loop is unrolled by
+*          BUS_BURST_UNROLL pixels.
+*
+*******************************************************************************/
+void st7789v_bus_write_pixels(const uint16_t *pixels, uint32_t count)
+{
+    GPIO_PRT_OUT_SET(dc_base) = dc_mask;
+
+    while (count >= BUS_BURST_UNROLL)
+    {
+        bus_write_pixel(pixels[0]);
+        bus_write_pixel(pixels[1]);
+        bus_write_pixel(pixels[2]);
+        bus_write_pixel(pixels[3]);
+        pixels += BUS_BURST_UNROLL;
+        count -= BUS_BURST_UNROLL;
+    }
+
+    while (count > 0u)
+    {
+        bus_write_pixel(*pixels++);
+        count--;
+    }
+}
+
+/* [] END OF FILE */
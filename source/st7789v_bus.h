@@ -0,0 +1,82 @@
+/******************************************************************************
+*
+* File Name: st7789v_bus.h
+*
+* Description: This file is the public interface of st7789v_bus.c, the burst
+* write path for the ST7789V 8-bit 8080 parallel bus.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include guard
+ ******************************************************************************/
+#ifndef ST7789V_BUS_H_
+#define ST7789V_BUS_H_
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdint.h>
+#include "cy_result.h"
+#include "mtb_st7789v.h"
+
+/*******************************************************************************
+* Global constants
+*******************************************************************************/
+/* ST7789V commands used by the flush path. */
+#define ST7789V_CMD_CASET                        (0x2Au)
+#define ST7789V_CMD_RASET                        (0x2Bu)
+#define ST7789V_CMD_RAMWR                        (0x2Cu)
+
+/*******************************************************************************
+ * Function prototype
+ ******************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+cy_rslt_t st7789v_bus_init(const mtb_st7789v_pins_t *pins);
+void st7789v_bus_write_command(uint8_t command);
+void st7789v_bus_set_window(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+void st7789v_bus_write_pixels(const uint16_t *pixels, uint32_t count);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* ST7789V_BUS_H_ */
+
+/* [] END OF FILE */
@@ -50,6 +50,7 @@
 #include "cyhal.h"
 #include "cybsp.h"
 #include "mtb_st7789v.h"
+#include "st7789v_bus.h"
 #include "tft_task.h"
 #include "FreeRTOS.h"
 #include "task.h"
@@ -63,6 +64,8 @@
 #include "lv_timer.h"
 #include "cy_http_client_api.h"
 #include "secure_http_client.h"
+#include "ui_sync.h"
+#include "ui_cmd_queue.h"
 
 /*******************************************************************************
 * Macros
@@ -71,14 +74,17 @@
 #define DELAY_300_MS      (300)   /* milliseconds */
 #define DELAY_10_MS       (10)    /* milliseconds */
 
-extern cy_http_client_response_t response;
+/* Upper bound on how long the TFT task sleeps when LVGL has no timer due. */
+#define TFT_MAX_SLEEP_MS          (1000u)
 
-extern bool syncedAll;
+/* Interval of the wakeup/idle report printed with TFT_SCHED_STATS. */
+#define TFT_SCHED_STATS_PERIOD_MS (10000u)
 
-extern bool time_synced;
-extern struct tm current_time;
+static TaskHandle_t tft_task_handle;
+
+/* Queued UI commands are applied at most once per display refresh period. */
+#define UI_CMD_DRAIN_PERIOD_MS    (LV_DISP_DEF_REFR_PERIOD)
 
-time_t sync_epoch_time; // UTC epoch at sync
 /*******************************************************************************
  * Data structure and enumeration
  ******************************************************************************/
@@ -100,46 +106,173 @@ const mtb_st7789v_pins_t tft_pins =
     .rst  = CYBSP_D13
 };
 
-void clock_tick_cb(lv_timer_t *timer)
+/*******************************************************************************
+* Function Name: uint32_t tft_drain_ui_commands(void)
+********************************************************************************
+*
+* Summary: Drains one batch of the UI command queue if a frame period has
+*          passed since the previous batch, so that a burst of posts is folded
+*          into a single redraw.
+*
+* Return:
+*  milliseconds until the next batch may run if commands are still waiting,
+*  otherwise LV_NO_TIMER_READY
+*
+*******************************************************************************/
+static uint32_t tft_drain_ui_commands(void)
 {
-    if (!time_synced) return;
+    static TickType_t last_drain;
+    TickType_t period = pdMS_TO_TICKS(UI_CMD_DRAIN_PERIOD_MS);
+    TickType_t since = xTaskGetTickCount() - last_drain;
 
-    time_t now = time(NULL);
-    int elapsed = (int)difftime(now, sync_epoch_time);
+    if (!ui_cmd_pending())
+    {
+        return LV_NO_TIMER_READY;
+    }
 
-    struct tm t = current_time;
-    t.tm_sec += elapsed;
-    mktime(&t);  // normalize
+    if (since >= period)
+    {
+        (void)ui_cmd_drain();
+        last_drain += since;
+
+        if (!ui_cmd_pending())
+        {
+            return LV_NO_TIMER_READY;
+        }
+        since = 0;
+    }
 
-    static int last_displayed_day = -1;
+    return (uint32_t)((period - since) * portTICK_PERIOD_MS);
+}
 
-    // Detect date rollover (day change)
-    if (t.tm_mday != last_displayed_day) 
-    {
-        last_displayed_day = t.tm_mday;
-        current_time = t;
-        sync_epoch_time = now;
+/*******************************************************************************
+* Function Name: void tft_add_run_time(uint32_t start)
+********************************************************************************
+*
+* Summary: Adds the cycles since start to the UI run time in ui_sync. Time
+*          taken by higher priority tasks that preempt the TFT task in between
+*          is counted too.
+*
+* Parameters:
+*  start: DWT cycle count at the start of the pass
+*
+*******************************************************************************/
+static void tft_add_run_time(uint32_t start)
+{
+    uint32_t cycles = DWT->CYCCNT - start;
+
+    ui_sync_add_run_time(cycles / (SystemCoreClock / 1000000u));
+}
+
+#if defined(TFT_SCHED_STATS)
+/*******************************************************************************
+* Function Name: void tft_sched_stats_timer_init(void)
+********************************************************************************
+*
+* Summary: FreeRTOS run time counter setup: starts the DWT cycle counter.
+*
+*******************************************************************************/
+void tft_sched_stats_timer_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/*******************************************************************************
+* Function Name: uint32_t tft_sched_stats_timer_get(void)
+********************************************************************************
+*
+* Summary: FreeRTOS run time counter (portGET_RUN_TIME_COUNTER_VALUE): the
+*          DWT cycle count. It wraps every 2^32 cycles and stops while the
+*          core sleeps.
+*
+* Return:
+*  CPU cycles counted since tft_sched_stats_timer_init()
+*
+*******************************************************************************/
+uint32_t tft_sched_stats_timer_get(void)
+{
+    return DWT->CYCCNT;
+}
 
-        // Update date UI locally
-        char day_str[3];
-        snprintf(day_str, sizeof(day_str), "%02d", t.tm_mday);
-        lv_label_set_text(ui_Date, day_str);
+/*******************************************************************************
+* Function Name: void tft_sched_stats_update(void)
+********************************************************************************
+*
+* Summary: Counts one TFT task wakeup and every TFT_SCHED_STATS_PERIOD_MS
+*          prints wakeups per second and the CPU idle percentage. The cycle
+*          counter stops while the core sleeps, so busy time is taken as the
+*          counted cycles minus the idle task's share, and idle is whatever is
+*          left of the wall-clock window.
+*
+*******************************************************************************/
+static void tft_sched_stats_update(void)
+{
+    static uint32_t wakeups;
+    static TickType_t window_start;
+    static uint32_t cycles_start;
+    static uint32_t idle_start;
 
-        const char* months[] = {"Jan","Feb","Mar","Apr","May","Jun",
-                                "Jul","Aug","Sep","Oct","Nov","Dec"};
-        lv_label_set_text(ui_Month, months[t.tm_mon]);
+    TickType_t now = xTaskGetTickCount();
+    uint32_t elapsed_ms = (now - window_start) * portTICK_PERIOD_MS;
 
-        const char* weekdays[] = {"Sun","Mon","Tue","Wed","Thu","Fri","Sat"};
-        lv_label_set_text(ui_Vaar, weekdays[t.tm_wday]);
+    wakeups++;
+    if (elapsed_ms < TFT_SCHED_STATS_PERIOD_MS)
+    {
+        return;
     }
 
-    // Update clock display
-    char buf[3];
-    snprintf(buf, sizeof(buf), "%02d", t.tm_hour);
-    lv_label_set_text(ui_HHH, buf);
+    uint32_t cycles = tft_sched_stats_timer_get();
+    uint32_t idle = ulTaskGetIdleRunTimeCounter();
+    uint64_t busy = (uint64_t)(uint32_t)(cycles - cycles_start) - (uint32_t)(idle - idle_start);
+    uint64_t window = (uint64_t)elapsed_ms * (SystemCoreClock / 1000u);
+    uint32_t busy_permille = (uint32_t)((busy * 1000u) / window);
+
+    printf("tft: %lu wakeups/s, CPU idle %lu.%lu%%\n",
+           (unsigned long)((wakeups * 1000u) / elapsed_ms),
+           (unsigned long)((1000u - busy_permille) / 10u),
+           (unsigned long)((1000u - busy_permille) % 10u));
+
+    wakeups = 0;
+    window_start = now;
+    cycles_start = cycles;
+    idle_start = idle;
+}
+#endif /* TFT_SCHED_STATS */
 
-    snprintf(buf, sizeof(buf), "%02d", t.tm_min);
-    lv_label_set_text(ui_MMM, buf);
+/*******************************************************************************
+* Function Name: void tft_task_notify(void)
+********************************************************************************
+*
+* Summary: Wakes the TFT task so that it runs the LVGL handler and picks up new
+*          data now instead of at its next timer deadline. Call it from any
+*          task after changing something the display shows.
+*
+*******************************************************************************/
+void tft_task_notify(void)
+{
+    if (NULL != tft_task_handle)
+    {
+        xTaskNotifyGive(tft_task_handle);
+    }
+}
+
+/*******************************************************************************
+* Function Name: void tft_task_notify_from_isr(BaseType_t *woken)
+********************************************************************************
+*
+* Summary: Interrupt-safe variant of tft_task_notify().
+*
+* Parameters:
+*  woken: set to pdTRUE if a context switch should be requested on exit
+*
+*******************************************************************************/
+void tft_task_notify_from_isr(BaseType_t *woken)
+{
+    if (NULL != tft_task_handle)
+    {
+        vTaskNotifyGiveFromISR(tft_task_handle, woken);
+    }
 }
 
 /*******************************************************************************
@@ -150,6 +283,14 @@ void clock_tick_cb(lv_timer_t *timer)
 *          LVGL-related tasks and operations. The LVGL music player demo gets
 *          called inside this function after all initialization are done.
 *
+*          The task sleeps until the next LVGL timer is due, as returned by
+*          lv_timer_handler(), or until tft_task_notify() is called. Other
+*          tasks change the display only through the UI command queue, which
+*          is drained here at most once per frame. LVGL
+*          takes its time from the FreeRTOS tick (LV_TICK_CUSTOM). Define
+*          TFT_SCHED_POLLING to get the previous fixed 5 ms loop back, with
+*          LVGL time advanced by lv_tick_inc() as before.
+*
 * Parameters:
 *  arg: task argument
 *
@@ -161,23 +302,59 @@ void tft_task(void *arg)
 {
     cy_rslt_t result;
 
+    tft_task_handle = xTaskGetCurrentTaskHandle();
+
     /* Initialize graphics */
     result = graphics_init();
     CY_ASSERT(result == CY_RSLT_SUCCESS);
     
-    lv_timer_create(clock_tick_cb, DELAY_300_MS, NULL); // 1-second timer for clock
-    
     /* Initialize LVGL demo */
     ui_init();
 
+    ui_sync_clock_start();              // minute-aligned clock timer
+
+    /* The run time handed to ui_sync comes from the DWT cycle counter. */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
     /* Main loop */
     for (;;)
     {
+#if defined(TFT_SCHED_POLLING)
+        uint32_t start = DWT->CYCCNT;
         lv_task_handler();               // LVGL task processing
         lv_tick_inc(DELAY_PARAM);        // increment LVGL ticks
+        tft_add_run_time(start);
 
         vTaskDelay(pdMS_TO_TICKS(DELAY_PARAM)); // FreeRTOS delay
-        sync_all_data(syncedAll);        // sync your HTTP/weather data
+        start = DWT->CYCCNT;
+        sync_all_data();                 // sync your HTTP/weather data
+        (void)tft_drain_ui_commands();
+        tft_add_run_time(start);
+#else
+        uint32_t start = DWT->CYCCNT;
+        sync_all_data();                 // sync your HTTP/weather data
+        uint32_t drain_ms = tft_drain_ui_commands();
+
+        uint32_t next_ms = lv_timer_handler();
+        tft_add_run_time(start);
+        if (next_ms > drain_ms)
+        {
+            next_ms = drain_ms;
+        }
+        if (next_ms > TFT_MAX_SLEEP_MS)
+        {
+            next_ms = TFT_MAX_SLEEP_MS;  // also covers LV_NO_TIMER_READY
+        }
+
+        /* The deadline is at least one tick away so a timer that is already
+         * due does not turn this into a busy loop. */
+        (void)ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(next_ms) + 1u);
+#endif
+
+#if defined(TFT_SCHED_STATS)
+        tft_sched_stats_update();
+#endif
     }
 }
 
@@ -202,6 +379,10 @@ cy_rslt_t  graphics_init()
     /* Initialize the display controller */
     result = mtb_st7789v_init8(&tft_pins);
     CY_ASSERT(result == CY_RSLT_SUCCESS);
+
+    /* Build the lookup tables for the burst write path used by flush_cb. */
+    result = st7789v_bus_init(&tft_pins);
+    CY_ASSERT(result == CY_RSLT_SUCCESS);
     
     /* Perform initialization specific to the ST7789V display controller. */
     st7789v_init();
@@ -212,6 +393,10 @@ cy_rslt_t  graphics_init()
     /*Initialize display driver. */
     lv_port_disp_init();
 
+#if defined(LV_PORT_FLUSH_BENCHMARK)
+    lv_port_flush_benchmark();
+#endif
+
     return result;
 
 }
@@ -45,6 +45,12 @@
 #ifndef TFT_TASK_H_
 #define TFT_TASK_H_
 
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include "cy_result.h"
+#include "FreeRTOS.h"
+
 /*******************************************************************************
 * Global constants
 *******************************************************************************/
@@ -58,6 +64,8 @@
  ******************************************************************************/
 cy_rslt_t graphics_init(void);
 void tft_task(void *arg);
+void tft_task_notify(void);
+void tft_task_notify_from_isr(BaseType_t *woken);
 void st7789v_init(void);
 
 #endif /* TFT_TASK_H_ */
@@ -0,0 +1,831 @@
+/******************************************************************************
+*
+* File Name: timekeeper.c
+*
+* Description: This file contains the timekeeping service. The RTC
+* counts UTC seconds off the 32.768 kHz crystal and keeps counting through
+* task stalls and resets; the RTOS tick, placed on the RTC turnovers and
+* scaled to their rate, fills in the milliseconds between RTC reads. Small
+* corrections are slewed in at a bounded rate, large ones step the clock,
+* whole seconds go into the RTC on a second boundary, and the corrections
+* measure the crystal drift.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Header file includes */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "cyhal.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "civil_time.h"
+#include "timekeeper.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char *const timekeeper_source_names[TIMEKEEPER_SOURCE_COUNT] =
+{
+    [TIMEKEEPER_SOURCE_NONE] = "none",
+    [TIMEKEEPER_SOURCE_RTC]  = "RTC",
+    [TIMEKEEPER_SOURCE_HTTP] = "HTTP",
+    [TIMEKEEPER_SOURCE_SNTP] = "SNTP",
+};
+
+static cyhal_rtc_t timekeeper_rtc;
+static SemaphoreHandle_t timekeeper_lock;
+
+/* Held while the phase is measured or the RTC written, outside
+ * timekeeper_lock, so that one correction does not see another's write. */
+static SemaphoreHandle_t timekeeper_rtc_lock;
+
+/* RTC time in ms at anchor_tick, taken when the RTC was seen to turn over.
+ * Between turnovers the tick extrapolates it, scaled by tick_rate_ppb. As a
+ * guard, a read of the RTC every TIMEKEEPER_ANCHOR_MS pulls it into the
+ * second the RTC shows, once the phase has been measured. */
+static uint64_t anchor_ms;
+static TickType_t anchor_tick;
+static TickType_t rtc_read_tick;
+static bool rtc_phase_known;
+
+/* RTC ms per tick ms, minus one, in ppb. The first two turnovers give a
+ * rough one, then two at least TIMEKEEPER_RATE_MIN_SPAN_S apart; rate_base
+ * is the first of them. */
+static int32_t tick_rate_ppb;
+static bool rate_known;
+static bool rate_base_set;
+static int64_t rate_base_ms;
+static TickType_t rate_base_tick;
+
+/* RTC writes so far, taken out of the RTC time to give the free-running
+ * crystal time the drift and the tick rate are measured on. */
+static int64_t rtc_written_ms;
+
+/* UTC is the RTC time plus correction_ms plus the part of slew_ms applied at
+ * TIMEKEEPER_SLEW_PPM since slew_tick. */
+static int64_t correction_ms;
+static int32_t slew_ms;
+static TickType_t slew_tick;
+
+/* Tick of the last SNTP reading; Date headers are not used while recent. */
+static bool sntp_seen;
+static TickType_t sntp_tick;
+
+/* Latest Date header not applied yet, as an offset against the clock when it
+ * arrived, and how to wake the task that applies it. Guarded by critical
+ * sections. */
+static bool http_date_pending;
+static int64_t http_date_offset_ms;
+static void (*http_date_notify)(void);
+
+/* Last time handed out; reads never go backwards except on a step. */
+static uint64_t last_ms;
+
+/* First phase (reference minus crystal time) of the drift baseline. */
+static bool drift_base_set;
+static uint64_t drift_base_ref_ms;
+static int64_t drift_base_phase_ms;
+static uint32_t drift_base_uncertainty_ms;
+
+static timekeeper_stats_t timekeeper_stats;
+
+/*******************************************************************************
+ * Function Name: timekeeper_rtc_read
+ *******************************************************************************
+ * Summary:
+ *  Reads the RTC as UTC seconds since 1970.
+ *
+ *******************************************************************************/
+static bool timekeeper_rtc_read(uint32_t *utc)
+{
+    struct tm tm;
+    civil_time_t t;
+
+    if (CY_RSLT_SUCCESS != cyhal_rtc_read(&timekeeper_rtc, &tm))
+    {
+        return false;
+    }
+
+    t.year = (uint16_t)(tm.tm_year + 1900);
+    t.month = (uint8_t)(tm.tm_mon + 1);
+    t.day = (uint8_t)tm.tm_mday;
+    t.hour = (uint8_t)tm.tm_hour;
+    t.minute = (uint8_t)tm.tm_min;
+    t.second = (uint8_t)tm.tm_sec;
+    if (t.year < CIVIL_YEAR_MIN)
+    {
+        return false;
+    }
+
+    *utc = civil_time_to_epoch(&t);
+    return true;
+}
+
+/*******************************************************************************
+ * Function Name: timekeeper_rtc_write
+ *******************************************************************************
+ * Summary:
+ *  Sets the RTC to UTC seconds since 1970.
+ *
+ *******************************************************************************/
+static cy_rslt_t timekeeper_rtc_write(uint32_t utc)
+{
+    struct tm tm;
+    civil_time_t t;
+
+    civil_time_from_epoch(utc, &t);
+    (void)memset(&tm, 0, sizeof(tm));
+    tm.tm_year = t.year - 1900;
+    tm.tm_mon = t.month - 1;
+    tm.tm_mday = t.day;
+    tm.tm_hour = t.hour;
+    tm.tm_min = t.minute;
+    tm.tm_sec = t.second;
+    tm.tm_wday = t.weekday;
+    tm.tm_yday = (int)((utc / CIVIL_SECONDS_PER_DAY) - civil_days_from_civil(t.year, 1U, 1U));
+
+    return cyhal_rtc_write(&timekeeper_rtc, &tm);
+}
+
+/*******************************************************************************
+ * Function Name: timekeeper_rtc_extrapolate
+ *******************************************************************************
+ * Summary:
+ *  Returns the RTC time in ms from the anchor and the tick alone. Called
+ *  with the lock held.
+ *
+ *******************************************************************************/
+static uint64_t timekeeper_rtc_extrapolate(TickType_t now)
+{
+    int64_t elapsed = (int64_t)((uint64_t)(now - anchor_tick) * portTICK_PERIOD_MS);
+
+    return (uint64_t)((int64_t)anchor_ms + elapsed + ((elapsed * tick_rate_ppb) / 1000000000LL));
+}
+
+/*******************************************************************************
+ * Function Name: timekeeper_rtc_ms
+ *******************************************************************************
+ * Summary:
+ *  Returns the RTC time in ms. Called with the lock held.
+ *
+ *******************************************************************************/
+static uint64_t timekeeper_rtc_ms(TickType_t now)
+{
+    uint64_t predicted = timekeeper_rtc_extrapolate(now);
+    uint64_t second;
+    uint32_t rtc;
+
+    /* Until the phase is measured, pulling into the RTC second would move
+     * the time by up to a second. */
+    if (!rtc_phase_known || (((now - rtc_read_tick) * portTICK_PERIOD_MS) < TIMEKEEPER_ANCHOR_MS) ||
+        !timekeeper_rtc_read(&rtc))
+    {
+        return predicted;
+    }
+    rtc_read_tick = now;
+
+    /* Only a wrong tick rate gets the extrapolation out of the RTC second.
+     * A day without a turnover restarts it, before the tick count wraps. */
+    second = (uint64_t)rtc * 1000U;
+    if (predicted < second)
+    {
+        predicted = second;
+    }
+    else if (predicted > (second + 999U))
+    {
+        predicted = second + 999U;
+    }
+    else if (((now - anchor_tick) * portTICK_PERIOD_MS) < (CIVIL_SECONDS_PER_DAY * 1000U))
+    {
+        return predicted;
+    }
+
+    anchor_ms = predicted;
+    anchor_tick = now;
+    return predicted;
+}
+
+/*******************************************************************************
+ * Function Name: timekeeper_slew_applied
+ *******************************************************************************
+ * Summary:
+ *  Returns how much of the current slew is in effect. A finished slew is
+ *  folded into correction_ms. Called with the lock held.
+ *
+ *******************************************************************************/
+static int32_t timekeeper_slew_applied(TickType_t now)
+{
+    uint32_t magnitude = (slew_ms < 0) ? (uint32_t)(-slew_ms) : (uint32_t)slew_ms;
+    uint64_t allowed = ((uint64_t)(now - slew_tick) * portTICK_PERIOD_MS * TIMEKEEPER_SLEW_PPM) / 1000000U;
+
+    if (allowed >= magnitude)
+    {
+        correction_ms += slew_ms;
+        slew_ms = 0;
+        return 0;
+    }
+    return (slew_ms < 0) ? -(int32_t)allowed : (int32_t)allowed;
+}
+
+/*******************************************************************************
+ * Function Name: timekeeper_utc_ms
+ *******************************************************************************
+ * Summary:
+ *  Returns UTC in ms, before the monotonic floor. Called with the lock held.
+ *
+ *******************************************************************************/
+static int64_t timekeeper_utc_ms(TickType_t now, uint64_t *rtc_ms)
+{
+    int32_t applied = timekeeper_slew_applied(now);
+
+    *rtc_ms = timekeeper_rtc_ms(now);
+    return (int64_t)*rtc_ms + correction_ms + applied;
+}
+
+/*******************************************************************************
+ * Function Name: timekeeper_measure_phase
+ *******************************************************************************
+ * Summary:
+ *  Watches the RTC turn over, polling it every tick, and moves the anchor
+ *  onto that instant. The first time, UTC is kept where it was by taking
+ *  the move out of correction_ms; later moves are tick error and go. Two
+ *  turnovers far enough apart give the tick rate. With
+ *  the phase known it sleeps until just before the turnover, otherwise it
+ *  polls for up to a second. Called with timekeeper_rtc_lock held and
+ *  without the lock, so that the clock can be read meanwhile.
+ *
+ *******************************************************************************/
+static void timekeeper_measure_phase(void)
+{
+    uint32_t first;
+    uint32_t rtc = 0;
+    TickType_t start;
+    TickType_t tick;
+    uint32_t span_ms;
+    int64_t crystal_ms;
+    int64_t moved;
+
+    if (rtc_phase_known)
+    {
+        uint32_t into;
+
+        (void)xSemaphoreTake(timekeeper_lock, portMAX_DELAY);
+        into = (uint32_t)(timekeeper_rtc_extrapolate(xTaskGetTickCount()) % 1000U);
+        (void)xSemaphoreGive(timekeeper_lock);
+
+        if (into < (1000U - TIMEKEEPER_PHASE_GUARD_MS))
+        {
+            vTaskDelay(pdMS_TO_TICKS(1000U - TIMEKEEPER_PHASE_GUARD_MS - into));
+        }
+    }
+
+    start = xTaskGetTickCount();
+    if (!timekeeper_rtc_read(&first))
+    {
+        return;
+    }
+
+    do
+    {
+        vTaskDelay(1);
+        tick = xTaskGetTickCount();
+        if (!timekeeper_rtc_read(&rtc))
+        {
+            return;
+        }
+    } while ((rtc == first) && (((tick - start) * portTICK_PERIOD_MS) < TIMEKEEPER_PHASE_WAIT_MS));
+
+    if (rtc == first)
+    {
+        return;
+    }
+
+    (void)xSemaphoreTake(timekeeper_lock, portMAX_DELAY);
+
+    moved = ((int64_t)rtc * 1000) - (int64_t)timekeeper_rtc_extrapolate(tick);
+    crystal_ms = ((int64_t)rtc * 1000) - rtc_written_ms;
+    span_ms = (tick - rate_base_tick) * portTICK_PERIOD_MS;
+    if (rate_base_set && (span_ms <= (CIVIL_SECONDS_PER_DAY * 1000U)) &&
+        ((span_ms >= (TIMEKEEPER_RATE_MIN_SPAN_S * 1000U)) || (!rate_known && (span_ms >= 500U))))
+    {
+        tick_rate_ppb = (int32_t)((((crystal_ms - rate_base_ms) - (int64_t)span_ms) * 1000000000LL) /
+                                  (int64_t)span_ms);
+        rate_known = true;
+    }
+    if (!rate_base_set || (span_ms >= (TIMEKEEPER_RATE_MIN_SPAN_S * 1000U)))
+    {
+        rate_base_set = true;
+        rate_base_ms = crystal_ms;
+        rate_base_tick = tick;
+    }
+
+    /* With the phase known the anchor was already on the RTC, and the move
+     * is what the tick got wrong since. Otherwise it is the unknown phase,
+     * which must not move UTC. */
+    if (!rtc_phase_known)
+    {
+        correction_ms -= moved;
+    }
+    anchor_ms = (uint64_t)rtc * 1000U;
+    anchor_tick = tick;
+    rtc_read_tick = tick;
+    rtc_phase_known = true;
+    timekeeper_stats.tick_rate_ppb = tick_rate_ppb;
+
+    (void)xSemaphoreGive(timekeeper_lock);
+}
+
+/*******************************************************************************
+ * Function Name: timekeeper_measure_first
+ *******************************************************************************
+ * Summary:
+ *  Measures the phase if it is not known, and then the next turnover gives
+ *  a first tick rate, to a part per thousand, until two far enough apart
+ *  give a better one. Called with timekeeper_rtc_lock held and without the
+ *  lock; takes up to two seconds the first time.
+ *
+ *******************************************************************************/
+static void timekeeper_measure_first(void)
+{
+    if (!rtc_phase_known)
+    {
+        timekeeper_measure_phase();
+    }
+    if (!rate_known)
+    {
+        timekeeper_measure_phase();
+    }
+}
+
+/*******************************************************************************
+ * Function Name: timekeeper_fold_into_rtc
+ *******************************************************************************
+ * Summary:
+ *  Moves the whole seconds of correction_ms into the RTC so that it keeps
+ *  UTC across a reset. The RTC is read and written TIMEKEEPER_FOLD_AT_MS
+ *  after it turns over: its second is then certain, and a write that
+ *  restarts the second moves the phase by no more than that. The phase is
+ *  measured again afterwards, and the tick rate restarts from there. Called
+ *  with timekeeper_rtc_lock held and without the lock; waits up to a few
+ *  seconds.
+ *
+ *******************************************************************************/
+static void timekeeper_fold_into_rtc(void)
+{
+    for (uint32_t attempt = 1U; ; attempt++)
+    {
+        uint64_t rtc_ms;
+        uint32_t rtc;
+        uint32_t into;
+        int64_t whole;
+        bool written = false;
+
+        (void)xSemaphoreTake(timekeeper_lock, portMAX_DELAY);
+        rtc_ms = timekeeper_rtc_extrapolate(xTaskGetTickCount());
+        whole = (correction_ms / 1000) * 1000;
+        into = (uint32_t)(rtc_ms % 1000U);
+
+        if ((0 == whole) || !rtc_phase_known)
+        {
+            (void)xSemaphoreGive(timekeeper_lock);
+            return;
+        }
+
+        if ((into < TIMEKEEPER_FOLD_AT_MS) || (into > (TIMEKEEPER_FOLD_AT_MS + TIMEKEEPER_FOLD_SLACK_MS)))
+        {
+            (void)xSemaphoreGive(timekeeper_lock);
+            if (attempt >= TIMEKEEPER_FOLD_TRIES)
+            {
+                return;
+            }
+            vTaskDelay(pdMS_TO_TICKS(((1000U + TIMEKEEPER_FOLD_AT_MS) - into) % 1000U));
+            continue;
+        }
+
+        if (timekeeper_rtc_read(&rtc) && (rtc == (uint32_t)(rtc_ms / 1000U)) &&
+            (CY_RSLT_SUCCESS == timekeeper_rtc_write((uint32_t)((int64_t)rtc + (whole / 1000)))))
+        {
+            anchor_ms = (uint64_t)((int64_t)anchor_ms + whole);
+            rtc_written_ms += whole;
+            correction_ms -= whole;
+            rtc_phase_known = false;
+            rate_base_set = false;
+            written = true;
+        }
+        (void)xSemaphoreGive(timekeeper_lock);
+
+        if (!written)
+        {
+            printf("Timekeeper: RTC write failed\n");
+            return;
+        }
+        timekeeper_measure_phase();
+        return;
+    }
+}
+
+/*******************************************************************************
+ * Function Name: timekeeper_init
+ *******************************************************************************
+ * Summary:
+ *  Starts the RTC. If it kept a time through the reset, that time is used
+ *  until the first correction. Without the RTC the tick keeps the time.
+ *
+ *******************************************************************************/
+void timekeeper_init(void)
+{
+    cy_rslt_t result;
+    uint32_t rtc;
+
+    timekeeper_lock = xSemaphoreCreateMutex();
+    timekeeper_rtc_lock = xSemaphoreCreateMutex();
+
+    result = cyhal_rtc_init(&timekeeper_rtc);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        printf("Timekeeper: RTC init failed 0x%08lx\n", (unsigned long)result);
+        return;
+    }
+
+    if (cyhal_rtc_is_enabled(&timekeeper_rtc) && timekeeper_rtc_read(&rtc) &&
+        (rtc >= (civil_days_from_civil(TIMEKEEPER_MIN_YEAR, 1U, 1U) * CIVIL_SECONDS_PER_DAY)))
+    {
+        anchor_ms = (uint64_t)rtc * 1000U;
+        anchor_tick = xTaskGetTickCount();
+        rtc_read_tick = anchor_tick;
+        timekeeper_stats.valid = true;
+        timekeeper_stats.source = TIMEKEEPER_SOURCE_RTC;
+        printf("Timekeeper: RTC kept the time through the reset\n");
+    }
+}
+
+/*******************************************************************************
+ * Function Name: timekeeper_calibrate
+ *******************************************************************************
+ * Summary:
+ *  Measures the RTC phase and a first tick rate ahead of the first
+ *  correction, so that an offset taken before it is not thrown by a tick
+ *  that runs off. Must be called from a task; takes up to two seconds.
+ *  timekeeper_correct() does the same if this was not called.
+ *
+ *******************************************************************************/
+void timekeeper_calibrate(void)
+{
+    (void)xSemaphoreTake(timekeeper_rtc_lock, portMAX_DELAY);
+    timekeeper_measure_first();
+    (void)xSemaphoreGive(timekeeper_rtc_lock);
+}
+
+/*******************************************************************************
+ * Function Name: timekeeper_valid
+ *******************************************************************************
+ * Summary:
+ *  Tells whether the clock holds a time, set since boot or kept by the RTC.
+ *
+ *******************************************************************************/
+bool timekeeper_valid(void)
+{
+    return timekeeper_stats.valid;
+}
+
+/*******************************************************************************
+ * Function Name: timekeeper_now_ms
+ *******************************************************************************
+ * Summary:
+ *  Returns UTC in ms since 1970. Reads the RTC at most once per
+ *  TIMEKEEPER_ANCHOR_MS and otherwise costs a tick read and some additions.
+ *
+ *******************************************************************************/
+uint64_t timekeeper_now_ms(void)
+{
+    uint64_t rtc_ms;
+    int64_t utc;
+
+    (void)xSemaphoreTake(timekeeper_lock, portMAX_DELAY);
+    utc = timekeeper_utc_ms(xTaskGetTickCount(), &rtc_ms);
+    if ((utc > 0) && ((uint64_t)utc > last_ms))
+    {
+        last_ms = (uint64_t)utc;
+    }
+    utc = (int64_t)last_ms;
+    (void)xSemaphoreGive(timekeeper_lock);
+
+    return (uint64_t)utc;
+}
+
+/*******************************************************************************
+ * Function Name: timekeeper_now
+ *******************************************************************************
+ * Summary:
+ *  Returns UTC seconds since 1970.
+ *
+ *******************************************************************************/
+uint32_t timekeeper_now(void)
+{
+    return (uint32_t)(timekeeper_now_ms() / 1000U);
+}
+
+/*******************************************************************************
+ * Function Name: timekeeper_update_drift
+ *******************************************************************************
+ * Summary:
+ *  Measures the crystal drift from the phase between a reference and the
+ *  free-running RTC time, against the first correction of the baseline. A
+ *  more precise source restarts the baseline. Called with the lock held.
+ *
+ *******************************************************************************/
+static void timekeeper_update_drift(uint64_t ref_ms, uint64_t rtc_ms, uint32_t uncertainty_ms)
+{
+    int64_t phase = (int64_t)ref_ms - ((int64_t)rtc_ms - rtc_written_ms);
+    uint64_t span_ms;
+
+    if (!drift_base_set || (uncertainty_ms < drift_base_uncertainty_ms))
+    {
+        drift_base_set = true;
+        drift_base_ref_ms = ref_ms;
+        drift_base_phase_ms = phase;
+        drift_base_uncertainty_ms = uncertainty_ms;
+        timekeeper_stats.drift_span_s = 0;
+        return;
+    }
+
+    span_ms = ref_ms - drift_base_ref_ms;
+    if (span_ms < (TIMEKEEPER_DRIFT_MIN_SPAN_S * 1000ULL))
+    {
+        return;
+    }
+
+    /* A growing phase means the reference gains on the crystal. */
+    timekeeper_stats.drift_ppb = (int32_t)(((drift_base_phase_ms - phase) * 1000000000LL) / (int64_t)span_ms);
+    timekeeper_stats.drift_uncertainty_ppb =
+        (uint32_t)(((uint64_t)(uncertainty_ms + drift_base_uncertainty_ms) * 1000000000ULL) / span_ms);
+    timekeeper_stats.drift_span_s = (uint32_t)(span_ms / 1000U);
+}
+
+/*******************************************************************************
+ * Function Name: timekeeper_correct
+ *******************************************************************************
+ * Summary:
+ *  Takes a reading from a time source. The first reading, and any that
+ *  differ by more than TIMEKEEPER_STEP_MS, set the RTC. Readings within
+ *  their own uncertainty change nothing. Other readings are slewed in at
+ *  TIMEKEEPER_SLEW_PPM, replacing any slew still in progress, so the time
+ *  keeps moving forward. Whole seconds of accumulated offset are then moved
+ *  into the RTC so that it keeps UTC across a reset; the part of a second
+ *  stays in correction_ms. Readings finer than a Date header, and the first
+ *  one after boot, first measure where the RTC turns over. The call can take
+ *  a few seconds.
+ *
+ * Parameters:
+ *  source: where the reading came from
+ *  offset_ms: reference time minus timekeeper_now_ms() when it was taken
+ *  uncertainty_ms: how far off the reference may be
+ *
+ *******************************************************************************/
+void timekeeper_correct(timekeeper_source_t source, int64_t offset_ms, uint32_t uncertainty_ms)
+{
+    TickType_t now;
+    uint64_t rtc_ms;
+    int64_t utc;
+    uint64_t ref;
+    const char *action;
+
+    (void)xSemaphoreTake(timekeeper_rtc_lock, portMAX_DELAY);
+
+    /* Readings finer than a Date header are worth waiting for the RTC to
+     * turn over, which puts the RTC time to the tick. */
+    if (rtc_phase_known && (uncertainty_ms < TIMEKEEPER_HTTP_UNCERTAINTY_MS))
+    {
+        timekeeper_measure_phase();
+    }
+    timekeeper_measure_first();
+
+    (void)xSemaphoreTake(timekeeper_lock, portMAX_DELAY);
+
+    now = xTaskGetTickCount();
+    utc = timekeeper_utc_ms(now, &rtc_ms);
+
+    /* The caller's offset is against what timekeeper_now_ms() returns. */
+    ref = (uint64_t)((((utc > 0) && ((uint64_t)utc > last_ms)) ? utc : (int64_t)last_ms) + offset_ms);
+    offset_ms = (int64_t)ref - utc;
+
+    timekeeper_stats.corrections[source]++;
+    if (TIMEKEEPER_SOURCE_SNTP == source)
+    {
+        sntp_seen = true;
+        sntp_tick = now;
+    }
+    timekeeper_stats.last_offset_ms = (offset_ms > INT32_MAX) ? INT32_MAX :
+                                      ((offset_ms < INT32_MIN) ? INT32_MIN : (int32_t)offset_ms);
+    timekeeper_stats.last_correction = (uint32_t)(ref / 1000U);
+
+    if (!timekeeper_stats.valid || (offset_ms > TIMEKEEPER_STEP_MS) || (offset_ms < -TIMEKEEPER_STEP_MS))
+    {
+        correction_ms = (int64_t)ref - (int64_t)rtc_ms;
+        slew_ms = 0;
+        last_ms = ref;
+        timekeeper_stats.valid = true;
+        timekeeper_stats.source = source;
+        timekeeper_stats.steps++;
+        action = "stepped";
+    }
+    else if ((offset_ms <= (int64_t)uncertainty_ms) && (offset_ms >= -(int64_t)uncertainty_ms))
+    {
+        action = "within uncertainty";
+    }
+    else
+    {
+        correction_ms += timekeeper_slew_applied(now);
+        slew_ms = (int32_t)offset_ms;
+        slew_tick = now;
+        timekeeper_stats.source = source;
+        timekeeper_stats.slews++;
+        action = "slewing";
+    }
+
+    timekeeper_update_drift(ref, rtc_ms, uncertainty_ms);
+    timekeeper_stats.slew_remaining_ms = slew_ms;
+
+    (void)xSemaphoreGive(timekeeper_lock);
+
+    timekeeper_fold_into_rtc();
+    (void)xSemaphoreGive(timekeeper_rtc_lock);
+
+    printf("Timekeeper: %s offset %+ld ms, %s\n", timekeeper_source_names[source],
+           (long)timekeeper_stats.last_offset_ms, action);
+}
+
+/*******************************************************************************
+ * Function Name: timekeeper_set_http_date_notify
+ *******************************************************************************
+ * Summary:
+ *  Sets how to wake the task that applies Date headers with
+ *  timekeeper_apply_http_date(). notify is called, without blocking, each
+ *  time one arrives.
+ *
+ *******************************************************************************/
+void timekeeper_set_http_date_notify(void (*notify)(void))
+{
+    taskENTER_CRITICAL();
+    http_date_notify = notify;
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+ * Function Name: timekeeper_note_http_date
+ *******************************************************************************
+ * Summary:
+ *  Records the Date header of a response that just arrived, for the task
+ *  woken through timekeeper_set_http_date_notify() to apply. It has whole seconds, so
+ *  the middle of that second is used. Only the latest header is kept. Does
+ *  not block, so it can be called from a response handler.
+ *
+ * Parameters:
+ *  date: Date header value as UTC seconds since 1970
+ *
+ *******************************************************************************/
+void timekeeper_note_http_date(uint32_t date)
+{
+    int64_t offset_ms = (((int64_t)date * 1000) + 500) - (int64_t)timekeeper_now_ms();
+    void (*notify)(void);
+
+    taskENTER_CRITICAL();
+    http_date_offset_ms = offset_ms;
+    http_date_pending = true;
+    notify = http_date_notify;
+    taskEXIT_CRITICAL();
+
+    if (NULL != notify)
+    {
+        notify();
+    }
+}
+
+/*******************************************************************************
+ * Function Name: timekeeper_apply_http_date
+ *******************************************************************************
+ * Summary:
+ *  Takes the Date header recorded by timekeeper_note_http_date(), if any, as
+ *  a reading. While SNTP answers, it is dropped. Call from the task woken
+ *  through timekeeper_set_http_date_notify(); like timekeeper_correct() it
+ *  can take a few seconds.
+ *
+ *******************************************************************************/
+void timekeeper_apply_http_date(void)
+{
+    bool pending;
+    int64_t offset_ms;
+
+    taskENTER_CRITICAL();
+    pending = http_date_pending;
+    offset_ms = http_date_offset_ms;
+    http_date_pending = false;
+    taskEXIT_CRITICAL();
+
+    if (!pending ||
+        (sntp_seen && ((xTaskGetTickCount() - sntp_tick) < pdMS_TO_TICKS(TIMEKEEPER_SNTP_HOLD_S * 1000U))))
+    {
+        return;
+    }
+
+    timekeeper_correct(TIMEKEEPER_SOURCE_HTTP, offset_ms, TIMEKEEPER_HTTP_UNCERTAINTY_MS);
+}
+
+/*******************************************************************************
+ * Function Name: timekeeper_get_stats
+ *******************************************************************************
+ * Summary:
+ *  Copies the timekeeping counters and the drift measurement.
+ *
+ *******************************************************************************/
+void timekeeper_get_stats(timekeeper_stats_t *stats)
+{
+    (void)xSemaphoreTake(timekeeper_lock, portMAX_DELAY);
+    timekeeper_stats.slew_remaining_ms = slew_ms - timekeeper_slew_applied(xTaskGetTickCount());
+    *stats = timekeeper_stats;
+    (void)xSemaphoreGive(timekeeper_lock);
+}
+
+/*******************************************************************************
+ * Function Name: timekeeper_print_stats
+ *******************************************************************************
+ * Summary:
+ *  Prints the time, where it last came from, the correction counts, the
+ *  tick rate and the crystal drift in ppm.
+ *
+ *******************************************************************************/
+void timekeeper_print_stats(void)
+{
+    timekeeper_stats_t s;
+    civil_time_t t;
+    uint32_t abs_ppb;
+
+    timekeeper_get_stats(&s);
+    if (!s.valid)
+    {
+        printf("Time not set\n");
+        return;
+    }
+
+    civil_time_from_epoch(timekeeper_now(), &t);
+    printf("Time %04u-%02u-%02u %02u:%02u:%02u UTC from %s, last offset %+ld ms, slew left %+ld ms; "
+           "HTTP %lu SNTP %lu corrections, %lu steps, %lu slews\n",
+           t.year, t.month, t.day, t.hour, t.minute, t.second, timekeeper_source_names[s.source],
+           (long)s.last_offset_ms, (long)s.slew_remaining_ms,
+           (unsigned long)s.corrections[TIMEKEEPER_SOURCE_HTTP],
+           (unsigned long)s.corrections[TIMEKEEPER_SOURCE_SNTP],
+           (unsigned long)s.steps, (unsigned long)s.slews);
+
+    abs_ppb = (s.tick_rate_ppb < 0) ? (uint32_t)(-s.tick_rate_ppb) : (uint32_t)s.tick_rate_ppb;
+    printf("RTC %c%lu.%02lu ppm against the tick\n", (s.tick_rate_ppb < 0) ? '-' : '+',
+           (unsigned long)(abs_ppb / 1000U), (unsigned long)((abs_ppb % 1000U) / 10U));
+
+    if (0U == s.drift_span_s)
+    {
+        printf("RTC drift not measured yet\n");
+        return;
+    }
+    abs_ppb = (s.drift_ppb < 0) ? (uint32_t)(-s.drift_ppb) : (uint32_t)s.drift_ppb;
+    printf("RTC drift %c%lu.%02lu ppm +/- %lu.%02lu over %lu min\n", (s.drift_ppb < 0) ? '-' : '+',
+           (unsigned long)(abs_ppb / 1000U), (unsigned long)((abs_ppb % 1000U) / 10U),
+           (unsigned long)(s.drift_uncertainty_ppb / 1000U),
+           (unsigned long)((s.drift_uncertainty_ppb % 1000U) / 10U),
+           (unsigned long)(s.drift_span_s / 60U));
+}
+
+/* [] END OF FILE */
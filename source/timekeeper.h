@@ -0,0 +1,144 @@
+/******************************************************************************
+*
+* File Name: timekeeper.h
+*
+* Description: This file contains the timekeeping service: UTC kept
+* on the PSoC 6 RTC, corrected from HTTP Date headers and SNTP, with a cheap
+* seconds-since-1970 read for the clock and the fetch logic.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef TIMEKEEPER_H_
+#define TIMEKEEPER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* An RTC that reads earlier than this after a reset was never set. */
+#define TIMEKEEPER_MIN_YEAR                      (2024U)
+
+/* Offsets up to this are slewed in, larger ones step the RTC. */
+#define TIMEKEEPER_STEP_MS                       (2000)
+
+/* Slew rate limit, as adjtime() uses. 1 s takes about 33 minutes. */
+#define TIMEKEEPER_SLEW_PPM                      (500U)
+
+/* The RTC is read again once the tick has run this long without it. */
+#define TIMEKEEPER_ANCHOR_MS                     (1000U)
+
+/* Watching for the RTC to turn over starts this long before the expected
+ * turnover, and gives up after TIMEKEEPER_PHASE_WAIT_MS. */
+#define TIMEKEEPER_PHASE_GUARD_MS                (20U)
+#define TIMEKEEPER_PHASE_WAIT_MS                 (1100U)
+
+/* Turnovers this far apart give the tick rate against the crystal. */
+#define TIMEKEEPER_RATE_MIN_SPAN_S               (60U)
+
+/* The RTC is written this long after it turns over, within the slack. After
+ * this many waits for that moment the write is left to the next correction. */
+#define TIMEKEEPER_FOLD_AT_MS                    (20U)
+#define TIMEKEEPER_FOLD_SLACK_MS                 (10U)
+#define TIMEKEEPER_FOLD_TRIES                    (3U)
+
+/* Corrections this far apart give a drift figure. */
+#define TIMEKEEPER_DRIFT_MIN_SPAN_S              (600U)
+
+/* The Date header has whole seconds and left the server some time ago. */
+#define TIMEKEEPER_HTTP_UNCERTAINTY_MS           (1000U)
+
+/* Date headers are ignored this long after an SNTP reading. */
+#define TIMEKEEPER_SNTP_HOLD_S                   (2U * 3600U)
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+typedef enum
+{
+    TIMEKEEPER_SOURCE_NONE,
+    TIMEKEEPER_SOURCE_RTC,          /* kept by the RTC from before a reset */
+    TIMEKEEPER_SOURCE_HTTP,
+    TIMEKEEPER_SOURCE_SNTP,
+    TIMEKEEPER_SOURCE_COUNT
+} timekeeper_source_t;
+
+typedef struct
+{
+    bool valid;                     /* the RTC holds a time */
+    timekeeper_source_t source;     /* last source that set or corrected it */
+    uint32_t corrections[TIMEKEEPER_SOURCE_COUNT];
+    uint32_t steps;
+    uint32_t slews;
+    int32_t last_offset_ms;         /* reference minus clock at the last correction */
+    uint32_t last_correction;       /* UTC seconds of the last correction */
+    int32_t slew_remaining_ms;
+    int32_t tick_rate_ppb;          /* RTC rate against the tick, positive when faster */
+    int32_t drift_ppb;              /* RTC rate error, positive when it runs fast */
+    uint32_t drift_uncertainty_ppb;
+    uint32_t drift_span_s;          /* baseline of the drift figure, 0 until measured */
+} timekeeper_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void timekeeper_init(void);
+void timekeeper_calibrate(void);
+bool timekeeper_valid(void);
+uint32_t timekeeper_now(void);
+uint64_t timekeeper_now_ms(void);
+void timekeeper_correct(timekeeper_source_t source, int64_t offset_ms, uint32_t uncertainty_ms);
+void timekeeper_set_http_date_notify(void (*notify)(void));
+void timekeeper_note_http_date(uint32_t date);
+void timekeeper_apply_http_date(void);
+void timekeeper_get_stats(timekeeper_stats_t *stats);
+void timekeeper_print_stats(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* TIMEKEEPER_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,286 @@
+/******************************************************************************
+*
+* File Name: tls_arena.c
+*
+* Description: This file contains the TLS memory arena: a first-fit
+* allocator over a static buffer with an address-ordered free list, and its
+* usage and high-water counters.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Header file includes */
+#include <string.h>
+#include "cy_pdl.h"
+
+/* FreeRTOS header file */
+#include <FreeRTOS.h>
+#include <semphr.h>
+
+#include "tls_arena.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Every block starts with a header and is a multiple of the alignment. */
+#define TLS_ARENA_ALIGN                          (8U)
+#define TLS_ARENA_HEADER                         (sizeof(tls_arena_block_t))
+#define TLS_ARENA_MIN_BLOCK                      (2U * TLS_ARENA_HEADER)
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+/* Header of a block. next is only meaningful while the block is free. */
+typedef struct tls_arena_block
+{
+    uint32_t size;                      /* whole block, header included */
+    struct tls_arena_block *next;       /* next free block by address */
+} tls_arena_block_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static CY_ALIGN(TLS_ARENA_ALIGN) uint8_t tls_arena[TLS_ARENA_SIZE];
+
+/* Free blocks in address order, so neighbours can be merged on free. */
+static tls_arena_block_t *tls_arena_free_list;
+
+/* mbedTLS allocates from whichever task runs a connection. */
+static SemaphoreHandle_t tls_arena_lock;
+
+static tls_arena_stats_t tls_arena_stats;
+
+/*******************************************************************************
+ * Function Name: tls_arena_init
+ *******************************************************************************
+ * Summary:
+ *  Makes the whole arena one free block. Call before the first allocation.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS, or CY_RSLT_TYPE_ERROR if the lock could not
+ *  be created
+ *
+ *******************************************************************************/
+cy_rslt_t tls_arena_init(void)
+{
+    tls_arena_lock = xSemaphoreCreateMutex();
+    if (NULL == tls_arena_lock)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    tls_arena_free_list = (tls_arena_block_t *)tls_arena;
+    tls_arena_free_list->size = TLS_ARENA_SIZE & ~(TLS_ARENA_ALIGN - 1U);
+    tls_arena_free_list->next = NULL;
+
+    (void)memset(&tls_arena_stats, 0, sizeof(tls_arena_stats));
+    tls_arena_stats.size = tls_arena_free_list->size;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+ * Function Name: tls_arena_calloc
+ *******************************************************************************
+ * Summary:
+ *  mbedTLS calloc: takes the first free block that fits, splitting off the
+ *  rest when it is big enough to be a block of its own.
+ *
+ * Return:
+ *  void *: zeroed memory, or NULL if no free block is big enough
+ *
+ *******************************************************************************/
+void *tls_arena_calloc(size_t count, size_t size)
+{
+    tls_arena_block_t **link;
+    tls_arena_block_t *block = NULL;
+    size_t bytes;
+    uint32_t need;
+
+    if ((0U == count) || (0U == size) || (count > (TLS_ARENA_SIZE / size)))
+    {
+        return NULL;
+    }
+    bytes = count * size;
+    need = (uint32_t)((bytes + TLS_ARENA_HEADER + TLS_ARENA_ALIGN - 1U) & ~(TLS_ARENA_ALIGN - 1U));
+
+    (void)xSemaphoreTake(tls_arena_lock, portMAX_DELAY);
+
+    for (link = &tls_arena_free_list; NULL != *link; link = &(*link)->next)
+    {
+        if ((*link)->size >= need)
+        {
+            block = *link;
+            break;
+        }
+    }
+
+    if (NULL == block)
+    {
+        tls_arena_stats.failures++;
+        (void)xSemaphoreGive(tls_arena_lock);
+        return NULL;
+    }
+
+    if ((block->size - need) >= TLS_ARENA_MIN_BLOCK)
+    {
+        tls_arena_block_t *rest = (tls_arena_block_t *)((uint8_t *)block + need);
+
+        rest->size = block->size - need;
+        rest->next = block->next;
+        block->size = need;
+        *link = rest;
+    }
+    else
+    {
+        *link = block->next;
+    }
+
+    tls_arena_stats.in_use += block->size;
+    tls_arena_stats.blocks++;
+    if (tls_arena_stats.in_use > tls_arena_stats.high_water)
+    {
+        tls_arena_stats.high_water = tls_arena_stats.in_use;
+    }
+    if (tls_arena_stats.in_use > tls_arena_stats.mark_high_water)
+    {
+        tls_arena_stats.mark_high_water = tls_arena_stats.in_use;
+    }
+
+    (void)xSemaphoreGive(tls_arena_lock);
+
+    (void)memset((uint8_t *)block + TLS_ARENA_HEADER, 0, bytes);
+    return (uint8_t *)block + TLS_ARENA_HEADER;
+}
+
+/*******************************************************************************
+ * Function Name: tls_arena_free
+ *******************************************************************************
+ * Summary:
+ *  mbedTLS free: puts the block back on the free list and merges it with
+ *  free neighbours.
+ *
+ *******************************************************************************/
+void tls_arena_free(void *ptr)
+{
+    tls_arena_block_t *block;
+    tls_arena_block_t *prev = NULL;
+    tls_arena_block_t *next;
+
+    if (NULL == ptr)
+    {
+        return;
+    }
+
+    block = (tls_arena_block_t *)((uint8_t *)ptr - TLS_ARENA_HEADER);
+    CY_ASSERT(((uint8_t *)block >= tls_arena) && ((uint8_t *)block < &tls_arena[TLS_ARENA_SIZE]));
+
+    (void)xSemaphoreTake(tls_arena_lock, portMAX_DELAY);
+
+    tls_arena_stats.in_use -= block->size;
+    tls_arena_stats.blocks--;
+
+    next = tls_arena_free_list;
+    while ((NULL != next) && (next < block))
+    {
+        prev = next;
+        next = next->next;
+    }
+
+    if ((NULL != next) && (((uint8_t *)block + block->size) == (uint8_t *)next))
+    {
+        block->size += next->size;
+        next = next->next;
+    }
+    block->next = next;
+
+    if ((NULL != prev) && (((uint8_t *)prev + prev->size) == (uint8_t *)block))
+    {
+        prev->size += block->size;
+        prev->next = block->next;
+    }
+    else if (NULL != prev)
+    {
+        prev->next = block;
+    }
+    else
+    {
+        tls_arena_free_list = block;
+    }
+
+    (void)xSemaphoreGive(tls_arena_lock);
+}
+
+/*******************************************************************************
+ * Function Name: tls_arena_mark
+ *******************************************************************************
+ * Summary:
+ *  Restarts mark_high_water from what is allocated now, to measure one
+ *  handshake. Handshakes running at the same time share it.
+ *
+ *******************************************************************************/
+void tls_arena_mark(void)
+{
+    (void)xSemaphoreTake(tls_arena_lock, portMAX_DELAY);
+    tls_arena_stats.mark_high_water = tls_arena_stats.in_use;
+    (void)xSemaphoreGive(tls_arena_lock);
+}
+
+/*******************************************************************************
+ * Function Name: tls_arena_get_stats
+ *******************************************************************************
+ * Summary:
+ *  Copies out the arena counters, with the largest free block worked out
+ *  from the free list.
+ *
+ *******************************************************************************/
+void tls_arena_get_stats(tls_arena_stats_t *stats)
+{
+    (void)xSemaphoreTake(tls_arena_lock, portMAX_DELAY);
+
+    *stats = tls_arena_stats;
+    stats->largest_free = 0;
+    for (const tls_arena_block_t *block = tls_arena_free_list; NULL != block; block = block->next)
+    {
+        if ((block->size - TLS_ARENA_HEADER) > stats->largest_free)
+        {
+            stats->largest_free = block->size - TLS_ARENA_HEADER;
+        }
+    }
+
+    (void)xSemaphoreGive(tls_arena_lock);
+}
+
+/* [] END OF FILE */
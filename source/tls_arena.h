@@ -0,0 +1,90 @@
+/******************************************************************************
+*
+* File Name: tls_arena.h
+*
+* Description: This file contains the TLS memory arena: a statically
+* placed block of RAM that every mbedTLS allocation comes from, so TLS never
+* draws on or fragments the heap the rest of the application uses.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef TLS_ARENA_H_
+#define TLS_ARENA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "cy_result.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Room for two weather connections handshaking at once, plus the parsed
+ * trust anchor. Most of a connection is its 16 KB receive record buffer.
+ * The size is worked out from the buffer sizes, not measured; tune it from
+ * the high-water mark printed after each handshake. */
+#ifndef TLS_ARENA_SIZE
+#define TLS_ARENA_SIZE                           (80U * 1024U)
+#endif
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+typedef struct
+{
+    uint32_t size;              /* arena size in bytes */
+    uint32_t in_use;            /* bytes allocated, block headers included */
+    uint32_t high_water;        /* most bytes ever allocated at once */
+    uint32_t mark_high_water;   /* most allocated since tls_arena_mark() */
+    uint32_t largest_free;      /* biggest block that could be allocated now */
+    uint32_t blocks;            /* allocations outstanding */
+    uint32_t failures;          /* allocations refused for lack of room */
+} tls_arena_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+cy_rslt_t tls_arena_init(void);
+void *tls_arena_calloc(size_t count, size_t size);
+void tls_arena_free(void *ptr);
+void tls_arena_mark(void);
+void tls_arena_get_stats(tls_arena_stats_t *stats);
+
+#endif /* TLS_ARENA_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,247 @@
+/******************************************************************************
+*
+* File Name: tls_client.c
+*
+* Description: This file contains the TLS setup of the HTTP client: the
+* trust anchor loaded once at boot, the per-host credentials, and the handshake
+* time counters. mbedTLS allocates from the TLS arena (tls_arena.c).
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Header file includes */
+#include <stdio.h>
+#include <string.h>
+
+/* FreeRTOS header file */
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "mbedtls/platform.h"
+#include "cy_tls.h"
+
+#include "tls_client.h"
+#include "tls_arena.h"
+#include "trust_anchor.h"
+#include "secure_http_client.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Updated from every task that runs a TLS connection, in critical sections. */
+static tls_client_stats_t tls_stats;
+
+/*******************************************************************************
+ * Function Name: tls_client_init
+ *******************************************************************************
+ * Summary:
+ *  Makes mbedTLS allocate from the TLS arena instead of the C heap. Must run
+ *  before anything allocates through mbedTLS, as blocks from the C heap
+ *  cannot be freed into the arena.
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS, or CY_RSLT_TYPE_ERROR if the arena could not
+ *  be set up or mbedTLS refused the allocator
+ *
+ *******************************************************************************/
+cy_rslt_t tls_client_init(void)
+{
+    (void)memset(&tls_stats, 0, sizeof(tls_stats));
+
+    if (CY_RSLT_SUCCESS != tls_arena_init())
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    return (0 == mbedtls_platform_set_calloc_free(tls_arena_calloc, tls_arena_free)) ?
+           CY_RSLT_SUCCESS : CY_RSLT_TYPE_ERROR;
+}
+
+/*******************************************************************************
+ * Function Name: tls_client_load_trust_anchor
+ *******************************************************************************
+ * Summary:
+ *  Parses the DER trust anchor into the global root CA chain of the secure
+ *  sockets library, once. Connections made without a root CA of their own
+ *  verify against it, so no certificate is parsed per connection. Call after
+ *  the HTTP client library is initialized.
+ *
+ * Return:
+ *  cy_rslt_t: result of cy_tls_load_global_root_ca_certificates()
+ *
+ *******************************************************************************/
+cy_rslt_t tls_client_load_trust_anchor(void)
+{
+    tls_arena_stats_t arena;
+    cy_rslt_t result;
+
+    result = cy_tls_load_global_root_ca_certificates((const char *)trust_anchor_der, trust_anchor_der_len);
+    if (CY_RSLT_SUCCESS != result)
+    {
+        ERR_INFO(("Failed to parse the trust anchor: 0x%lx\n", (unsigned long)result));
+        return result;
+    }
+
+    tls_arena_get_stats(&arena);
+    printf("Trust anchor parsed: %lu bytes DER, TLS arena %lu of %lu bytes in use\n",
+           (unsigned long)trust_anchor_der_len, (unsigned long)arena.in_use, (unsigned long)arena.size);
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+ * Function Name: tls_client_credentials
+ *******************************************************************************
+ * Summary:
+ *  Fills in the security settings of a connection to host: the server
+ *  certificate is verified against the global trust anchor and host is sent
+ *  as the SNI name. No client certificate is presented.
+ *
+ * Parameters:
+ *  credentials: filled in; must stay valid as long as the client using it
+ *  host: server host name; must stay valid as long as credentials
+ *
+ *******************************************************************************/
+void tls_client_credentials(cy_awsport_ssl_credentials_t *credentials, const char *host)
+{
+    (void)memset(credentials, 0, sizeof(*credentials));
+
+    credentials->sni_host_name = host;
+    credentials->sni_host_name_size = strlen(host) + 1U;
+    credentials->root_ca_verify_mode = CY_AWS_ROOTCA_VERIFY_REQUIRED;
+}
+
+/*******************************************************************************
+ * Function Name: tls_client_handshake_begin
+ *******************************************************************************
+ * Summary:
+ *  Call right before connecting over TLS. Restarts the arena high-water
+ *  mark of the handshake; handshakes running at the same time share it.
+ *
+ * Return:
+ *  uint32_t: start time for tls_client_handshake_end()
+ *
+ *******************************************************************************/
+uint32_t tls_client_handshake_begin(void)
+{
+    tls_arena_mark();
+
+    return (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS);
+}
+
+/*******************************************************************************
+ * Function Name: tls_client_handshake_end
+ *******************************************************************************
+ * Summary:
+ *  Call when the TLS connect has returned. Counts the handshake and prints
+ *  its time and the arena high-water mark while it ran.
+ *
+ * Parameters:
+ *  host: server connected to
+ *  begin: value returned by tls_client_handshake_begin()
+ *  ok: whether the connect succeeded
+ *
+ *******************************************************************************/
+void tls_client_handshake_end(const char *host, uint32_t begin, bool ok)
+{
+    uint32_t elapsed_ms = (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS) - begin;
+    tls_arena_stats_t arena;
+
+    taskENTER_CRITICAL();
+    if (ok)
+    {
+        tls_stats.handshakes++;
+        tls_stats.handshake_ms_total += elapsed_ms;
+        if (elapsed_ms > tls_stats.handshake_ms_max)
+        {
+            tls_stats.handshake_ms_max = elapsed_ms;
+        }
+        tls_stats.last_ms = elapsed_ms;
+    }
+    else
+    {
+        tls_stats.failures++;
+    }
+    taskEXIT_CRITICAL();
+
+    tls_arena_get_stats(&arena);
+    printf("TLS handshake with %s %s after %lu ms; arena peak %lu, now %lu of %lu bytes, "
+           "largest free %lu\n",
+           host, ok ? "done" : "failed", (unsigned long)elapsed_ms,
+           (unsigned long)arena.mark_high_water, (unsigned long)arena.in_use,
+           (unsigned long)arena.size, (unsigned long)arena.largest_free);
+}
+
+/*******************************************************************************
+ * Function Name: tls_client_get_stats
+ *******************************************************************************
+ * Summary:
+ *  Copies out the handshake counters.
+ *
+ *******************************************************************************/
+void tls_client_get_stats(tls_client_stats_t *stats)
+{
+    taskENTER_CRITICAL();
+    *stats = tls_stats;
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+ * Function Name: tls_client_print_stats
+ *******************************************************************************
+ * Summary:
+ *  Prints the number and average time of full handshakes and the arena
+ *  use. Requests on kept connections skip the handshake; the connection pool
+ *  stats show how many did.
+ *
+ *******************************************************************************/
+void tls_client_print_stats(void)
+{
+    tls_client_stats_t s;
+    tls_arena_stats_t arena;
+
+    tls_client_get_stats(&s);
+    tls_arena_get_stats(&arena);
+
+    printf("TLS handshakes %lu avg %lu ms max %lu ms, failed %lu; arena %lu of %lu bytes in %lu blocks, "
+           "high water %lu, largest free %lu, refused %lu\n",
+           (unsigned long)s.handshakes,
+           (unsigned long)((0U != s.handshakes) ? (s.handshake_ms_total / s.handshakes) : 0U),
+           (unsigned long)s.handshake_ms_max, (unsigned long)s.failures,
+           (unsigned long)arena.in_use, (unsigned long)arena.size, (unsigned long)arena.blocks,
+           (unsigned long)arena.high_water, (unsigned long)arena.largest_free,
+           (unsigned long)arena.failures);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,79 @@
+/******************************************************************************
+*
+* File Name: tls_client.h
+*
+* Description: This file contains the TLS setup of the HTTP client: loading
+* the trust anchor, filling in credentials for a host, and counting handshakes.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef TLS_CLIENT_H_
+#define TLS_CLIENT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cy_result.h"
+#include "cy_http_client_api.h"
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+typedef struct
+{
+    uint32_t handshakes;        /* connects that ran a full handshake */
+    uint32_t failures;          /* connects that failed */
+    uint32_t handshake_ms_total;
+    uint32_t handshake_ms_max;
+    uint32_t last_ms;
+} tls_client_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+cy_rslt_t tls_client_init(void);
+cy_rslt_t tls_client_load_trust_anchor(void);
+void tls_client_credentials(cy_awsport_ssl_credentials_t *credentials, const char *host);
+uint32_t tls_client_handshake_begin(void);
+void tls_client_handshake_end(const char *host, uint32_t begin, bool ok);
+void tls_client_get_stats(tls_client_stats_t *stats);
+void tls_client_print_stats(void);
+
+#endif /* TLS_CLIENT_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,181 @@
+/******************************************************************************
+*
+* File Name: tz_rules.c
+*
+* Description: This file contains the time zone lookup. Zone names and
+* offset changes are found by bisection over the generated tables in
+* tz_rules_data.c, and the offset found is cached until the next change.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Header file includes */
+#include <string.h>
+#include "tz_rules.h"
+
+/*******************************************************************************
+ * Function Name: tz_rules_find
+ *******************************************************************************
+ * Summary:
+ *  Looks up a compiled zone by its IANA name, such as "America/New_York".
+ *
+ * Return:
+ *  const tz_zone_t *: the zone, or NULL if it was not compiled in
+ *
+ *******************************************************************************/
+const tz_zone_t *tz_rules_find(const char *name)
+{
+    uint32_t lo = 0;
+    uint32_t hi = tz_rules_zone_count;
+
+    while (lo < hi)
+    {
+        uint32_t mid = (lo + hi) / 2U;
+        int cmp = strcmp(name, tz_rules_zones[mid].name);
+
+        if (0 == cmp)
+        {
+            return &tz_rules_zones[mid];
+        }
+        if (cmp < 0)
+        {
+            hi = mid;
+        }
+        else
+        {
+            lo = mid + 1U;
+        }
+    }
+    return NULL;
+}
+
+/*******************************************************************************
+ * Function Name: tz_rules_select
+ *******************************************************************************
+ * Summary:
+ *  Selects the zone a cache looks offsets up in. A name that was not compiled
+ *  in selects UTC.
+ *
+ * Parameters:
+ *  cache: cache to update
+ *  name: IANA zone name, may be empty
+ *
+ * Return:
+ *  bool: true if the selected zone changed
+ *
+ *******************************************************************************/
+bool tz_rules_select(tz_rules_cache_t *cache, const char *name)
+{
+    const tz_zone_t *zone = tz_rules_find(name);
+
+    if (zone == cache->zone)
+    {
+        return false;
+    }
+
+    cache->zone = zone;
+    cache->valid_from = 0;
+    cache->valid_until = 0;
+    return true;
+}
+
+/*******************************************************************************
+ * Function Name: tz_rules_offset
+ *******************************************************************************
+ * Summary:
+ *  Returns the local offset of the selected zone at a UTC instant. Between
+ *  offset changes this is the cached value; otherwise the change in force is
+ *  found by bisection over the zone's instants.
+ *
+ * Parameters:
+ *  cache: selected zone and last offset
+ *  utc: seconds since 1970
+ *
+ * Return:
+ *  int32_t: seconds east of UTC
+ *
+ *******************************************************************************/
+int32_t tz_rules_offset(tz_rules_cache_t *cache, uint32_t utc)
+{
+    const tz_zone_t *zone = cache->zone;
+    const uint32_t *instants;
+    uint32_t lo = 0;
+    uint32_t hi;
+
+    if ((utc >= cache->valid_from) && (utc < cache->valid_until))
+    {
+        return cache->offset;
+    }
+
+    if (NULL == zone)
+    {
+        cache->offset = 0;
+        cache->valid_from = 0;
+        cache->valid_until = UINT32_MAX;
+        return 0;
+    }
+
+    /* lo becomes the number of changes at or before utc. */
+    instants = &tz_rules_instants[zone->first];
+    hi = zone->count;
+    while (lo < hi)
+    {
+        uint32_t mid = (lo + hi) / 2U;
+
+        if (instants[mid] <= utc)
+        {
+            lo = mid + 1U;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    if (0U == lo)
+    {
+        cache->offset = tz_rules_offsets[zone->initial];
+        cache->valid_from = 0;
+    }
+    else
+    {
+        cache->offset = tz_rules_offsets[tz_rules_kinds[zone->first + lo - 1U]];
+        cache->valid_from = instants[lo - 1U];
+    }
+    cache->valid_until = (lo < zone->count) ? instants[lo] : UINT32_MAX;
+    return cache->offset;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,105 @@
+/******************************************************************************
+*
+* File Name: tz_rules.h
+*
+* Description: This file contains the time zone lookup: the tables
+* compiled from the tz database by scripts/tz_rules_gen.py and the mapping of
+* a zone name and a UTC instant to the local offset.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef TZ_RULES_H_
+#define TZ_RULES_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+/* One compiled zone: its offset changes are instants [first, first + count)
+ * of tz_rules_instants. The tables hold the changes from 1 January 2020
+ * (the generator's first year) to 2106, where 32-bit UTC seconds end. Before
+ * 2020 a zone has its offset at the start of 2020; rule changes published
+ * after the tz database the tables were built from are not included. */
+typedef struct
+{
+    const char *name;
+    uint16_t first;
+    uint16_t count;
+    uint8_t initial;            /* tz_rules_offsets index before the first change */
+} tz_zone_t;
+
+/* Selected zone and the offset last looked up, which holds for UTC instants
+ * in [valid_from, valid_until). Zero-initialised it means UTC. */
+typedef struct
+{
+    const tz_zone_t *zone;
+    int32_t offset;
+    uint32_t valid_from;
+    uint32_t valid_until;
+} tz_rules_cache_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern const int32_t tz_rules_offsets[];
+extern const uint32_t tz_rules_instants[];
+extern const uint8_t tz_rules_kinds[];
+extern const tz_zone_t tz_rules_zones[];
+extern const uint32_t tz_rules_zone_count;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+const tz_zone_t *tz_rules_find(const char *name);
+bool tz_rules_select(tz_rules_cache_t *cache, const char *name);
+int32_t tz_rules_offset(tz_rules_cache_t *cache, uint32_t utc);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* TZ_RULES_H_ */
+
+/* [] END OF FILE */
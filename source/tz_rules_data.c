@@ -0,0 +1,723 @@
+/* Generated by scripts/tz_rules_gen.py from configs/tz_zones.txt. Do not edit. */
+/* tz database 2025b, changes from 2020 on. */
+
+#include "tz_rules.h"
+
+/* Offsets east of UTC, in seconds. */
+const int32_t tz_rules_offsets[30] =
+{
+    -36000, -32400, -28800, -25200, -21600, -18000, -14400, -12600,
+    -10800, -9000, 0, 3600, 7200, 10800, 12600, 14400,
+    16200, 18000, 19800, 20700, 21600, 25200, 28800, 32400,
+    34200, 36000, 37800, 39600, 43200, 46800,
+};
+
+/* UTC instants at which a zone changes offset, one ascending run per zone. */
+const uint32_t tz_rules_instants[2758] =
+{
+    1682632800U, 1698354000U, 1714082400U, 1730408400U, 1745532000U, 1761858000U,
+    1776981600U, 1793307600U, 1809036000U, 1824757200U, 1840485600U, 1856206800U,
+    1871935200U, 1887656400U, 1903384800U, 1919710800U, 1934834400U, 1951160400U,
+    1966888800U, 1982610000U, 1998338400U, 2014059600U, 2029788000U, 2045509200U,
+    2061237600U, 2076958800U, 2092687200U, 2109013200U, 2124136800U, 2140462800U,
+    2156191200U, 2171912400U, 2187640800U, 2203362000U, 2219090400U, 2234811600U,
+    2250540000U, 2266866000U, 2281989600U, 2298315600U, 2313439200U, 2329765200U,
+    2345493600U, 2361214800U, 2376943200U, 2392664400U, 2408392800U, 2424114000U,
+    2439842400U, 2456168400U, 2471292000U, 2487618000U, 2503346400U, 2519067600U,
+    2534796000U, 2550517200U, 2566245600U, 2581966800U, 2597695200U, 2614021200U,
+    2629144800U, 2645470800U, 2660594400U, 2676920400U, 2692648800U, 2708370000U,
+    2724098400U, 2739819600U, 2755548000U, 2771269200U, 2786997600U, 2803323600U,
+    2818447200U, 2834773200U, 2850501600U, 2866222800U, 2881951200U, 2897672400U,
+    2913400800U, 2929122000U, 2944850400U, 2960571600U, 2976300000U, 2992626000U,
+    3007749600U, 3024075600U, 3039804000U, 3055525200U, 3071253600U, 3086974800U,
+    3102703200U, 3118424400U, 3134152800U, 3150478800U, 3165602400U, 3181928400U,
+    3197052000U, 3213378000U, 3229106400U, 3244827600U, 3260556000U, 3276277200U,
+    3292005600U, 3307726800U, 3323455200U, 3339781200U, 3354904800U, 3371230800U,
+    3386959200U, 3402680400U, 3418408800U, 3434130000U, 3449858400U, 3465579600U,
+    3481308000U, 3497634000U, 3512757600U, 3529083600U, 3544207200U, 3560533200U,
+    3576261600U, 3591982800U, 3607711200U, 3623432400U, 3639160800U, 3654882000U,
+    3670610400U, 3686936400U, 3702060000U, 3718386000U, 3734114400U, 3749835600U,
+    3765564000U, 3781285200U, 3797013600U, 3812734800U, 3828463200U, 3844184400U,
+    3859912800U, 3876238800U, 3891362400U, 3907688400U, 3923416800U, 3939138000U,
+    3954866400U, 3970587600U, 3986316000U, 4002037200U, 4017765600U, 4034091600U,
+    4049215200U, 4065541200U, 4080664800U, 4096990800U, 4112719200U, 4128440400U,
+    4144168800U, 4159890000U, 4175618400U, 4191339600U, 4207068000U, 4222789200U,
+    4238517600U, 4254843600U, 4269967200U, 4286293200U, 1583665200U, 1604224800U,
+    1615719600U, 1636279200U, 1647169200U, 1667728800U, 1678618800U, 1699178400U,
+    1710068400U, 1730628000U, 1741518000U, 1762077600U, 1772967600U, 1793527200U,
+    1805022000U, 1825581600U, 1836471600U, 1857031200U, 1867921200U, 1888480800U,
+    1899370800U, 1919930400U, 1930820400U, 1951380000U, 1962874800U, 1983434400U,
+    1994324400U, 2014884000U, 2025774000U, 2046333600U, 2057223600U, 2077783200U,
+    2088673200U, 2109232800U, 2120122800U, 2140682400U, 2152177200U, 2172736800U,
+    2183626800U, 2204186400U, 2215076400U, 2235636000U, 2246526000U, 2267085600U,
+    2277975600U, 2298535200U, 2309425200U, 2329984800U, 2341479600U, 2362039200U,
+    2372929200U, 2393488800U, 2404378800U, 2424938400U, 2435828400U, 2456388000U,
+    2467278000U, 2487837600U, 2499332400U, 2519892000U, 2530782000U, 2551341600U,
+    2562231600U, 2582791200U, 2593681200U, 2614240800U, 2625130800U, 2645690400U,
+    2656580400U, 2677140000U, 2688634800U, 2709194400U, 2720084400U, 2740644000U,
+    2751534000U, 2772093600U, 2782983600U, 2803543200U, 2814433200U, 2834992800U,
+    2846487600U, 2867047200U, 2877937200U, 2898496800U, 2909386800U, 2929946400U,
+    2940836400U, 2961396000U, 2972286000U, 2992845600U, 3003735600U, 3024295200U,
+    3035790000U, 3056349600U, 3067239600U, 3087799200U, 3098689200U, 3119248800U,
+    3130138800U, 3150698400U, 3161588400U, 3182148000U, 3193038000U, 3213597600U,
+    3225092400U, 3245652000U, 3256542000U, 3277101600U, 3287991600U, 3308551200U,
+    3319441200U, 3340000800U, 3350890800U, 3371450400U, 3382945200U, 3403504800U,
+    3414394800U, 3434954400U, 3445844400U, 3466404000U, 3477294000U, 3497853600U,
+    3508743600U, 3529303200U, 3540193200U, 3560752800U, 3572247600U, 3592807200U,
+    3603697200U, 3624256800U, 3635146800U, 3655706400U, 3666596400U, 3687156000U,
+    3698046000U, 3718605600U, 3730100400U, 3750660000U, 3761550000U, 3782109600U,
+    3792999600U, 3813559200U, 3824449200U, 3845008800U, 3855898800U, 3876458400U,
+    3887348400U, 3907908000U, 3919402800U, 3939962400U, 3950852400U, 3971412000U,
+    3982302000U, 4002861600U, 4013751600U, 4034311200U, 4045201200U, 4065760800U,
+    4076650800U, 4097210400U, 4108705200U, 4129264800U, 4140154800U, 4160714400U,
+    4171604400U, 4192164000U, 4203054000U, 4223613600U, 4234503600U, 4255063200U,
+    4265953200U, 4286512800U, 1583654400U, 1604214000U, 1615708800U, 1636268400U,
+    1647158400U, 1667718000U, 1678608000U, 1699167600U, 1710057600U, 1730617200U,
+    1741507200U, 1762066800U, 1772956800U, 1793516400U, 1805011200U, 1825570800U,
+    1836460800U, 1857020400U, 1867910400U, 1888470000U, 1899360000U, 1919919600U,
+    1930809600U, 1951369200U, 1962864000U, 1983423600U, 1994313600U, 2014873200U,
+    2025763200U, 2046322800U, 2057212800U, 2077772400U, 2088662400U, 2109222000U,
+    2120112000U, 2140671600U, 2152166400U, 2172726000U, 2183616000U, 2204175600U,
+    2215065600U, 2235625200U, 2246515200U, 2267074800U, 2277964800U, 2298524400U,
+    2309414400U, 2329974000U, 2341468800U, 2362028400U, 2372918400U, 2393478000U,
+    2404368000U, 2424927600U, 2435817600U, 2456377200U, 2467267200U, 2487826800U,
+    2499321600U, 2519881200U, 2530771200U, 2551330800U, 2562220800U, 2582780400U,
+    2593670400U, 2614230000U, 2625120000U, 2645679600U, 2656569600U, 2677129200U,
+    2688624000U, 2709183600U, 2720073600U, 2740633200U, 2751523200U, 2772082800U,
+    2782972800U, 2803532400U, 2814422400U, 2834982000U, 2846476800U, 2867036400U,
+    2877926400U, 2898486000U, 2909376000U, 2929935600U, 2940825600U, 2961385200U,
+    2972275200U, 2992834800U, 3003724800U, 3024284400U, 3035779200U, 3056338800U,
+    3067228800U, 3087788400U, 3098678400U, 3119238000U, 3130128000U, 3150687600U,
+    3161577600U, 3182137200U, 3193027200U, 3213586800U, 3225081600U, 3245641200U,
+    3256531200U, 3277090800U, 3287980800U, 3308540400U, 3319430400U, 3339990000U,
+    3350880000U, 3371439600U, 3382934400U, 3403494000U, 3414384000U, 3434943600U,
+    3445833600U, 3466393200U, 3477283200U, 3497842800U, 3508732800U, 3529292400U,
+    3540182400U, 3560742000U, 3572236800U, 3592796400U, 3603686400U, 3624246000U,
+    3635136000U, 3655695600U, 3666585600U, 3687145200U, 3698035200U, 3718594800U,
+    3730089600U, 3750649200U, 3761539200U, 3782098800U, 3792988800U, 3813548400U,
+    3824438400U, 3844998000U, 3855888000U, 3876447600U, 3887337600U, 3907897200U,
+    3919392000U, 3939951600U, 3950841600U, 3971401200U, 3982291200U, 4002850800U,
+    4013740800U, 4034300400U, 4045190400U, 4065750000U, 4076640000U, 4097199600U,
+    4108694400U, 4129254000U, 4140144000U, 4160703600U, 4171593600U, 4192153200U,
+    4203043200U, 4223602800U, 4234492800U, 4255052400U, 4265942400U, 4286502000U,
+    1583658000U, 1604217600U, 1615712400U, 1636272000U, 1647162000U, 1667721600U,
+    1678611600U, 1699171200U, 1710061200U, 1730620800U, 1741510800U, 1762070400U,
+    1772960400U, 1793520000U, 1805014800U, 1825574400U, 1836464400U, 1857024000U,
+    1867914000U, 1888473600U, 1899363600U, 1919923200U, 1930813200U, 1951372800U,
+    1962867600U, 1983427200U, 1994317200U, 2014876800U, 2025766800U, 2046326400U,
+    2057216400U, 2077776000U, 2088666000U, 2109225600U, 2120115600U, 2140675200U,
+    2152170000U, 2172729600U, 2183619600U, 2204179200U, 2215069200U, 2235628800U,
+    2246518800U, 2267078400U, 2277968400U, 2298528000U, 2309418000U, 2329977600U,
+    2341472400U, 2362032000U, 2372922000U, 2393481600U, 2404371600U, 2424931200U,
+    2435821200U, 2456380800U, 2467270800U, 2487830400U, 2499325200U, 2519884800U,
+    2530774800U, 2551334400U, 2562224400U, 2582784000U, 2593674000U, 2614233600U,
+    2625123600U, 2645683200U, 2656573200U, 2677132800U, 2688627600U, 2709187200U,
+    2720077200U, 2740636800U, 2751526800U, 2772086400U, 2782976400U, 2803536000U,
+    2814426000U, 2834985600U, 2846480400U, 2867040000U, 2877930000U, 2898489600U,
+    2909379600U, 2929939200U, 2940829200U, 2961388800U, 2972278800U, 2992838400U,
+    3003728400U, 3024288000U, 3035782800U, 3056342400U, 3067232400U, 3087792000U,
+    3098682000U, 3119241600U, 3130131600U, 3150691200U, 3161581200U, 3182140800U,
+    3193030800U, 3213590400U, 3225085200U, 3245644800U, 3256534800U, 3277094400U,
+    3287984400U, 3308544000U, 3319434000U, 3339993600U, 3350883600U, 3371443200U,
+    3382938000U, 3403497600U, 3414387600U, 3434947200U, 3445837200U, 3466396800U,
+    3477286800U, 3497846400U, 3508736400U, 3529296000U, 3540186000U, 3560745600U,
+    3572240400U, 3592800000U, 3603690000U, 3624249600U, 3635139600U, 3655699200U,
+    3666589200U, 3687148800U, 3698038800U, 3718598400U, 3730093200U, 3750652800U,
+    3761542800U, 3782102400U, 3792992400U, 3813552000U, 3824442000U, 3845001600U,
+    3855891600U, 3876451200U, 3887341200U, 3907900800U, 3919395600U, 3939955200U,
+    3950845200U, 3971404800U, 3982294800U, 4002854400U, 4013744400U, 4034304000U,
+    4045194000U, 4065753600U, 4076643600U, 4097203200U, 4108698000U, 4129257600U,
+    4140147600U, 4160707200U, 4171597200U, 4192156800U, 4203046800U, 4223606400U,
+    4234496400U, 4255056000U, 4265946000U, 4286505600U, 1583647200U, 1604206800U,
+    1615701600U, 1636261200U, 1647151200U, 1667710800U, 1678600800U, 1699160400U,
+    1710050400U, 1730610000U, 1741500000U, 1762059600U, 1772949600U, 1793509200U,
+    1805004000U, 1825563600U, 1836453600U, 1857013200U, 1867903200U, 1888462800U,
+    1899352800U, 1919912400U, 1930802400U, 1951362000U, 1962856800U, 1983416400U,
+    1994306400U, 2014866000U, 2025756000U, 2046315600U, 2057205600U, 2077765200U,
+    2088655200U, 2109214800U, 2120104800U, 2140664400U, 2152159200U, 2172718800U,
+    2183608800U, 2204168400U, 2215058400U, 2235618000U, 2246508000U, 2267067600U,
+    2277957600U, 2298517200U, 2309407200U, 2329966800U, 2341461600U, 2362021200U,
+    2372911200U, 2393470800U, 2404360800U, 2424920400U, 2435810400U, 2456370000U,
+    2467260000U, 2487819600U, 2499314400U, 2519874000U, 2530764000U, 2551323600U,
+    2562213600U, 2582773200U, 2593663200U, 2614222800U, 2625112800U, 2645672400U,
+    2656562400U, 2677122000U, 2688616800U, 2709176400U, 2720066400U, 2740626000U,
+    2751516000U, 2772075600U, 2782965600U, 2803525200U, 2814415200U, 2834974800U,
+    2846469600U, 2867029200U, 2877919200U, 2898478800U, 2909368800U, 2929928400U,
+    2940818400U, 2961378000U, 2972268000U, 2992827600U, 3003717600U, 3024277200U,
+    3035772000U, 3056331600U, 3067221600U, 3087781200U, 3098671200U, 3119230800U,
+    3130120800U, 3150680400U, 3161570400U, 3182130000U, 3193020000U, 3213579600U,
+    3225074400U, 3245634000U, 3256524000U, 3277083600U, 3287973600U, 3308533200U,
+    3319423200U, 3339982800U, 3350872800U, 3371432400U, 3382927200U, 3403486800U,
+    3414376800U, 3434936400U, 3445826400U, 3466386000U, 3477276000U, 3497835600U,
+    3508725600U, 3529285200U, 3540175200U, 3560734800U, 3572229600U, 3592789200U,
+    3603679200U, 3624238800U, 3635128800U, 3655688400U, 3666578400U, 3687138000U,
+    3698028000U, 3718587600U, 3730082400U, 3750642000U, 3761532000U, 3782091600U,
+    3792981600U, 3813541200U, 3824431200U, 3844990800U, 3855880800U, 3876440400U,
+    3887330400U, 3907890000U, 3919384800U, 3939944400U, 3950834400U, 3971394000U,
+    3982284000U, 4002843600U, 4013733600U, 4034293200U, 4045183200U, 4065742800U,
+    4076632800U, 4097192400U, 4108687200U, 4129246800U, 4140136800U, 4160696400U,
+    4171586400U, 4192146000U, 4203036000U, 4223595600U, 4234485600U, 4255045200U,
+    4265935200U, 4286494800U, 1583661600U, 1604221200U, 1615716000U, 1636275600U,
+    1647165600U, 1667725200U, 1678615200U, 1699174800U, 1710064800U, 1730624400U,
+    1741514400U, 1762074000U, 1772964000U, 1793523600U, 1805018400U, 1825578000U,
+    1836468000U, 1857027600U, 1867917600U, 1888477200U, 1899367200U, 1919926800U,
+    1930816800U, 1951376400U, 1962871200U, 1983430800U, 1994320800U, 2014880400U,
+    2025770400U, 2046330000U, 2057220000U, 2077779600U, 2088669600U, 2109229200U,
+    2120119200U, 2140678800U, 2152173600U, 2172733200U, 2183623200U, 2204182800U,
+    2215072800U, 2235632400U, 2246522400U, 2267082000U, 2277972000U, 2298531600U,
+    2309421600U, 2329981200U, 2341476000U, 2362035600U, 2372925600U, 2393485200U,
+    2404375200U, 2424934800U, 2435824800U, 2456384400U, 2467274400U, 2487834000U,
+    2499328800U, 2519888400U, 2530778400U, 2551338000U, 2562228000U, 2582787600U,
+    2593677600U, 2614237200U, 2625127200U, 2645686800U, 2656576800U, 2677136400U,
+    2688631200U, 2709190800U, 2720080800U, 2740640400U, 2751530400U, 2772090000U,
+    2782980000U, 2803539600U, 2814429600U, 2834989200U, 2846484000U, 2867043600U,
+    2877933600U, 2898493200U, 2909383200U, 2929942800U, 2940832800U, 2961392400U,
+    2972282400U, 2992842000U, 3003732000U, 3024291600U, 3035786400U, 3056346000U,
+    3067236000U, 3087795600U, 3098685600U, 3119245200U, 3130135200U, 3150694800U,
+    3161584800U, 3182144400U, 3193034400U, 3213594000U, 3225088800U, 3245648400U,
+    3256538400U, 3277098000U, 3287988000U, 3308547600U, 3319437600U, 3339997200U,
+    3350887200U, 3371446800U, 3382941600U, 3403501200U, 3414391200U, 3434950800U,
+    3445840800U, 3466400400U, 3477290400U, 3497850000U, 3508740000U, 3529299600U,
+    3540189600U, 3560749200U, 3572244000U, 3592803600U, 3603693600U, 3624253200U,
+    3635143200U, 3655702800U, 3666592800U, 3687152400U, 3698042400U, 3718602000U,
+    3730096800U, 3750656400U, 3761546400U, 3782106000U, 3792996000U, 3813555600U,
+    3824445600U, 3845005200U, 3855895200U, 3876454800U, 3887344800U, 3907904400U,
+    3919399200U, 3939958800U, 3950848800U, 3971408400U, 3982298400U, 4002858000U,
+    4013748000U, 4034307600U, 4045197600U, 4065757200U, 4076647200U, 4097206800U,
+    4108701600U, 4129261200U, 4140151200U, 4160710800U, 4171600800U, 4192160400U,
+    4203050400U, 4223610000U, 4234500000U, 4255059600U, 4265949600U, 4286509200U,
+    1586073600U, 1603609200U, 1617523200U, 1635663600U, 1648972800U, 1667113200U,
+    1583650800U, 1604210400U, 1615705200U, 1636264800U, 1647154800U, 1667714400U,
+    1678604400U, 1699164000U, 1710054000U, 1730613600U, 1741503600U, 1762063200U,
+    1772953200U, 1793512800U, 1805007600U, 1825567200U, 1836457200U, 1857016800U,
+    1867906800U, 1888466400U, 1899356400U, 1919916000U, 1930806000U, 1951365600U,
+    1962860400U, 1983420000U, 1994310000U, 2014869600U, 2025759600U, 2046319200U,
+    2057209200U, 2077768800U, 2088658800U, 2109218400U, 2120108400U, 2140668000U,
+    2152162800U, 2172722400U, 2183612400U, 2204172000U, 2215062000U, 2235621600U,
+    2246511600U, 2267071200U, 2277961200U, 2298520800U, 2309410800U, 2329970400U,
+    2341465200U, 2362024800U, 2372914800U, 2393474400U, 2404364400U, 2424924000U,
+    2435814000U, 2456373600U, 2467263600U, 2487823200U, 2499318000U, 2519877600U,
+    2530767600U, 2551327200U, 2562217200U, 2582776800U, 2593666800U, 2614226400U,
+    2625116400U, 2645676000U, 2656566000U, 2677125600U, 2688620400U, 2709180000U,
+    2720070000U, 2740629600U, 2751519600U, 2772079200U, 2782969200U, 2803528800U,
+    2814418800U, 2834978400U, 2846473200U, 2867032800U, 2877922800U, 2898482400U,
+    2909372400U, 2929932000U, 2940822000U, 2961381600U, 2972271600U, 2992831200U,
+    3003721200U, 3024280800U, 3035775600U, 3056335200U, 3067225200U, 3087784800U,
+    3098674800U, 3119234400U, 3130124400U, 3150684000U, 3161574000U, 3182133600U,
+    3193023600U, 3213583200U, 3225078000U, 3245637600U, 3256527600U, 3277087200U,
+    3287977200U, 3308536800U, 3319426800U, 3339986400U, 3350876400U, 3371436000U,
+    3382930800U, 3403490400U, 3414380400U, 3434940000U, 3445830000U, 3466389600U,
+    3477279600U, 3497839200U, 3508729200U, 3529288800U, 3540178800U, 3560738400U,
+    3572233200U, 3592792800U, 3603682800U, 3624242400U, 3635132400U, 3655692000U,
+    3666582000U, 3687141600U, 3698031600U, 3718591200U, 3730086000U, 3750645600U,
+    3761535600U, 3782095200U, 3792985200U, 3813544800U, 3824434800U, 3844994400U,
+    3855884400U, 3876444000U, 3887334000U, 3907893600U, 3919388400U, 3939948000U,
+    3950838000U, 3971397600U, 3982287600U, 4002847200U, 4013737200U, 4034296800U,
+    4045186800U, 4065746400U, 4076636400U, 4097196000U, 4108690800U, 4129250400U,
+    4140140400U, 4160700000U, 4171590000U, 4192149600U, 4203039600U, 4223599200U,
+    4234489200U, 4255048800U, 4265938800U, 4286498400U, 1586055600U, 1599364800U,
+    1617505200U, 1630814400U, 1648954800U, 1662868800U, 1680404400U, 1693713600U,
+    1712458800U, 1725768000U, 1743908400U, 1757217600U, 1775358000U, 1788667200U,
+    1806807600U, 1820116800U, 1838257200U, 1851566400U, 1870311600U, 1883016000U,
+    1901761200U, 1915070400U, 1933210800U, 1946520000U, 1964660400U, 1977969600U,
+    1996110000U, 2009419200U, 2027559600U, 2040868800U, 2059614000U, 2072318400U,
+    2091063600U, 2104372800U, 2122513200U, 2135822400U, 2153962800U, 2167272000U,
+    2185412400U, 2198721600U, 2217466800U, 2230171200U, 2248916400U, 2262225600U,
+    2280366000U, 2293675200U, 2311815600U, 2325124800U, 2343265200U, 2356574400U,
+    2374714800U, 2388024000U, 2406769200U, 2419473600U, 2438218800U, 2451528000U,
+    2469668400U, 2482977600U, 2501118000U, 2514427200U, 2532567600U, 2545876800U,
+    2564017200U, 2577326400U, 2596071600U, 2609380800U, 2627521200U, 2640830400U,
+    2658970800U, 2672280000U, 2690420400U, 2703729600U, 2721870000U, 2735179200U,
+    2753924400U, 2766628800U, 2785374000U, 2798683200U, 2816823600U, 2830132800U,
+    2848273200U, 2861582400U, 2879722800U, 2893032000U, 2911172400U, 2924481600U,
+    2943226800U, 2955931200U, 2974676400U, 2987985600U, 3006126000U, 3019435200U,
+    3037575600U, 3050884800U, 3069025200U, 3082334400U, 3101079600U, 3113784000U,
+    3132529200U, 3145838400U, 3163978800U, 3177288000U, 3195428400U, 3208737600U,
+    3226878000U, 3240187200U, 3258327600U, 3271636800U, 3290382000U, 3303086400U,
+    3321831600U, 3335140800U, 3353281200U, 3366590400U, 3384730800U, 3398040000U,
+    3416180400U, 3429489600U, 3447630000U, 3460939200U, 3479684400U, 3492993600U,
+    3511134000U, 3524443200U, 3542583600U, 3555892800U, 3574033200U, 3587342400U,
+    3605482800U, 3618792000U, 3637537200U, 3650241600U, 3668986800U, 3682296000U,
+    3700436400U, 3713745600U, 3731886000U, 3745195200U, 3763335600U, 3776644800U,
+    3794785200U, 3808094400U, 3826839600U, 3839544000U, 3858289200U, 3871598400U,
+    3889738800U, 3903048000U, 3921188400U, 3934497600U, 3952638000U, 3965947200U,
+    3984692400U, 3997396800U, 4016142000U, 4029451200U, 4047591600U, 4060900800U,
+    4079041200U, 4092350400U, 4110490800U, 4123800000U, 4141940400U, 4155249600U,
+    4173390000U, 4186699200U, 4205444400U, 4218148800U, 4236894000U, 4250203200U,
+    4268343600U, 4281652800U, 1583645400U, 1604205000U, 1615699800U, 1636259400U,
+    1647149400U, 1667709000U, 1678599000U, 1699158600U, 1710048600U, 1730608200U,
+    1741498200U, 1762057800U, 1772947800U, 1793507400U, 1805002200U, 1825561800U,
+    1836451800U, 1857011400U, 1867901400U, 1888461000U, 1899351000U, 1919910600U,
+    1930800600U, 1951360200U, 1962855000U, 1983414600U, 1994304600U, 2014864200U,
+    2025754200U, 2046313800U, 2057203800U, 2077763400U, 2088653400U, 2109213000U,
+    2120103000U, 2140662600U, 2152157400U, 2172717000U, 2183607000U, 2204166600U,
+    2215056600U, 2235616200U, 2246506200U, 2267065800U, 2277955800U, 2298515400U,
+    2309405400U, 2329965000U, 2341459800U, 2362019400U, 2372909400U, 2393469000U,
+    2404359000U, 2424918600U, 2435808600U, 2456368200U, 2467258200U, 2487817800U,
+    2499312600U, 2519872200U, 2530762200U, 2551321800U, 2562211800U, 2582771400U,
+    2593661400U, 2614221000U, 2625111000U, 2645670600U, 2656560600U, 2677120200U,
+    2688615000U, 2709174600U, 2720064600U, 2740624200U, 2751514200U, 2772073800U,
+    2782963800U, 2803523400U, 2814413400U, 2834973000U, 2846467800U, 2867027400U,
+    2877917400U, 2898477000U, 2909367000U, 2929926600U, 2940816600U, 2961376200U,
+    2972266200U, 2992825800U, 3003715800U, 3024275400U, 3035770200U, 3056329800U,
+    3067219800U, 3087779400U, 3098669400U, 3119229000U, 3130119000U, 3150678600U,
+    3161568600U, 3182128200U, 3193018200U, 3213577800U, 3225072600U, 3245632200U,
+    3256522200U, 3277081800U, 3287971800U, 3308531400U, 3319421400U, 3339981000U,
+    3350871000U, 3371430600U, 3382925400U, 3403485000U, 3414375000U, 3434934600U,
+    3445824600U, 3466384200U, 3477274200U, 3497833800U, 3508723800U, 3529283400U,
+    3540173400U, 3560733000U, 3572227800U, 3592787400U, 3603677400U, 3624237000U,
+    3635127000U, 3655686600U, 3666576600U, 3687136200U, 3698026200U, 3718585800U,
+    3730080600U, 3750640200U, 3761530200U, 3782089800U, 3792979800U, 3813539400U,
+    3824429400U, 3844989000U, 3855879000U, 3876438600U, 3887328600U, 3907888200U,
+    3919383000U, 3939942600U, 3950832600U, 3971392200U, 3982282200U, 4002841800U,
+    4013731800U, 4034291400U, 4045181400U, 4065741000U, 4076631000U, 4097190600U,
+    4108685400U, 4129245000U, 4140135000U, 4160694600U, 4171584600U, 4192144200U,
+    4203034200U, 4223593800U, 4234483800U, 4255043400U, 4265933400U, 4286493000U,
+    1585267200U, 1603580400U, 1616716800U, 1635634800U, 1648166400U, 1667084400U,
+    1679616000U, 1698534000U, 1711670400U, 1729983600U, 1743120000U, 1761433200U,
+    1774569600U, 1792882800U, 1806019200U, 1824937200U, 1837468800U, 1856386800U,
+    1868918400U, 1887836400U, 1900972800U, 1919286000U, 1932422400U, 1950735600U,
+    1963872000U, 1982790000U, 1995321600U, 2014239600U, 2026771200U, 2045689200U,
+    2058220800U, 2077138800U, 2090275200U, 2108588400U, 2121724800U, 2140038000U,
+    2153174400U, 2172092400U, 2184624000U, 2203542000U, 2216073600U, 2234991600U,
+    2248128000U, 2266441200U, 2279577600U, 2297890800U, 2311027200U, 2329340400U,
+    2342476800U, 2361394800U, 2373926400U, 2392844400U, 2405376000U, 2424294000U,
+    2437430400U, 2455743600U, 2468880000U, 2487193200U, 2500329600U, 2519247600U,
+    2531779200U, 2550697200U, 2563228800U, 2582146800U, 2595283200U, 2613596400U,
+    2626732800U, 2645046000U, 2658182400U, 2676495600U, 2689632000U, 2708550000U,
+    2721081600U, 2739999600U, 2752531200U, 2771449200U, 2784585600U, 2802898800U,
+    2816035200U, 2834348400U, 2847484800U, 2866402800U, 2878934400U, 2897852400U,
+    2910384000U, 2929302000U, 2941833600U, 2960751600U, 2973888000U, 2992201200U,
+    3005337600U, 3023650800U, 3036787200U, 3055705200U, 3068236800U, 3087154800U,
+    3099686400U, 3118604400U, 3131740800U, 3150054000U, 3163190400U, 3181503600U,
+    3194640000U, 3212953200U, 3226089600U, 3245007600U, 3257539200U, 3276457200U,
+    3288988800U, 3307906800U, 3321043200U, 3339356400U, 3352492800U, 3370806000U,
+    3383942400U, 3402860400U, 3415392000U, 3434310000U, 3446841600U, 3465759600U,
+    3478896000U, 3497209200U, 3510345600U, 3528658800U, 3541795200U, 3560108400U,
+    3573244800U, 3592162800U, 3604694400U, 3623612400U, 3636144000U, 3655062000U,
+    3668198400U, 3686511600U, 3699648000U, 3717961200U, 3731097600U, 3750015600U,
+    3762547200U, 3781465200U, 3793996800U, 3812914800U, 3825446400U, 3844364400U,
+    3857500800U, 3875814000U, 3888950400U, 3907263600U, 3920400000U, 3939318000U,
+    3951849600U, 3970767600U, 3983299200U, 4002217200U, 4015353600U, 4033666800U,
+    4046803200U, 4065116400U, 4078252800U, 4096566000U, 4109702400U, 4128620400U,
+    4141152000U, 4160070000U, 4172601600U, 4191519600U, 4204051200U, 4222969200U,
+    4236105600U, 4254418800U, 4267555200U, 4285868400U, 1584736200U, 1600630200U,
+    1616358600U, 1632252600U, 1647894600U, 1663788600U, 1586017800U, 1601742600U,
+    1617467400U, 1633192200U, 1648917000U, 1664641800U, 1680366600U, 1696091400U,
+    1712421000U, 1728145800U, 1743870600U, 1759595400U, 1775320200U, 1791045000U,
+    1806769800U, 1822494600U, 1838219400U, 1853944200U, 1869669000U, 1885998600U,
+    1901723400U, 1917448200U, 1933173000U, 1948897800U, 1964622600U, 1980347400U,
+    1996072200U, 2011797000U, 2027521800U, 2043246600U, 2058971400U, 2075301000U,
+    2091025800U, 2106750600U, 2122475400U, 2138200200U, 2153925000U, 2169649800U,
+    2185374600U, 2201099400U, 2216824200U, 2233153800U, 2248878600U, 2264603400U,
+    2280328200U, 2296053000U, 2311777800U, 2327502600U, 2343227400U, 2358952200U,
+    2374677000U, 2390401800U, 2406126600U, 2422456200U, 2438181000U, 2453905800U,
+    2469630600U, 2485355400U, 2501080200U, 2516805000U, 2532529800U, 2548254600U,
+    2563979400U, 2579704200U, 2596033800U, 2611758600U, 2627483400U, 2643208200U,
+    2658933000U, 2674657800U, 2690382600U, 2706107400U, 2721832200U, 2737557000U,
+    2753281800U, 2769611400U, 2785336200U, 2801061000U, 2816785800U, 2832510600U,
+    2848235400U, 2863960200U, 2879685000U, 2895409800U, 2911134600U, 2926859400U,
+    2942584200U, 2958913800U, 2974638600U, 2990363400U, 3006088200U, 3021813000U,
+    3037537800U, 3053262600U, 3068987400U, 3084712200U, 3100437000U, 3116766600U,
+    3132491400U, 3148216200U, 3163941000U, 3179665800U, 3195390600U, 3211115400U,
+    3226840200U, 3242565000U, 3258289800U, 3274014600U, 3289739400U, 3306069000U,
+    3321793800U, 3337518600U, 3353243400U, 3368968200U, 3384693000U, 3400417800U,
+    3416142600U, 3431867400U, 3447592200U, 3463317000U, 3479646600U, 3495371400U,
+    3511096200U, 3526821000U, 3542545800U, 3558270600U, 3573995400U, 3589720200U,
+    3605445000U, 3621169800U, 3636894600U, 3653224200U, 3668949000U, 3684673800U,
+    3700398600U, 3716123400U, 3731848200U, 3747573000U, 3763297800U, 3779022600U,
+    3794747400U, 3810472200U, 3826197000U, 3842526600U, 3858251400U, 3873976200U,
+    3889701000U, 3905425800U, 3921150600U, 3936875400U, 3952600200U, 3968325000U,
+    3984049800U, 4000379400U, 4016104200U, 4031829000U, 4047553800U, 4063278600U,
+    4079003400U, 4094728200U, 4110453000U, 4126177800U, 4141902600U, 4157627400U,
+    4173352200U, 4189077000U, 4204801800U, 4221131400U, 4236856200U, 4252581000U,
+    4268305800U, 4284030600U, 1586016000U, 1601740800U, 1617465600U, 1633190400U,
+    1648915200U, 1664640000U, 1680364800U, 1696089600U, 1712419200U, 1728144000U,
+    1743868800U, 1759593600U, 1775318400U, 1791043200U, 1806768000U, 1822492800U,
+    1838217600U, 1853942400U, 1869667200U, 1885996800U, 1901721600U, 1917446400U,
+    1933171200U, 1948896000U, 1964620800U, 1980345600U, 1996070400U, 2011795200U,
+    2027520000U, 2043244800U, 2058969600U, 2075299200U, 2091024000U, 2106748800U,
+    2122473600U, 2138198400U, 2153923200U, 2169648000U, 2185372800U, 2201097600U,
+    2216822400U, 2233152000U, 2248876800U, 2264601600U, 2280326400U, 2296051200U,
+    2311776000U, 2327500800U, 2343225600U, 2358950400U, 2374675200U, 2390400000U,
+    2406124800U, 2422454400U, 2438179200U, 2453904000U, 2469628800U, 2485353600U,
+    2501078400U, 2516803200U, 2532528000U, 2548252800U, 2563977600U, 2579702400U,
+    2596032000U, 2611756800U, 2627481600U, 2643206400U, 2658931200U, 2674656000U,
+    2690380800U, 2706105600U, 2721830400U, 2737555200U, 2753280000U, 2769609600U,
+    2785334400U, 2801059200U, 2816784000U, 2832508800U, 2848233600U, 2863958400U,
+    2879683200U, 2895408000U, 2911132800U, 2926857600U, 2942582400U, 2958912000U,
+    2974636800U, 2990361600U, 3006086400U, 3021811200U, 3037536000U, 3053260800U,
+    3068985600U, 3084710400U, 3100435200U, 3116764800U, 3132489600U, 3148214400U,
+    3163939200U, 3179664000U, 3195388800U, 3211113600U, 3226838400U, 3242563200U,
+    3258288000U, 3274012800U, 3289737600U, 3306067200U, 3321792000U, 3337516800U,
+    3353241600U, 3368966400U, 3384691200U, 3400416000U, 3416140800U, 3431865600U,
+    3447590400U, 3463315200U, 3479644800U, 3495369600U, 3511094400U, 3526819200U,
+    3542544000U, 3558268800U, 3573993600U, 3589718400U, 3605443200U, 3621168000U,
+    3636892800U, 3653222400U, 3668947200U, 3684672000U, 3700396800U, 3716121600U,
+    3731846400U, 3747571200U, 3763296000U, 3779020800U, 3794745600U, 3810470400U,
+    3826195200U, 3842524800U, 3858249600U, 3873974400U, 3889699200U, 3905424000U,
+    3921148800U, 3936873600U, 3952598400U, 3968323200U, 3984048000U, 4000377600U,
+    4016102400U, 4031827200U, 4047552000U, 4063276800U, 4079001600U, 4094726400U,
+    4110451200U, 4126176000U, 4141900800U, 4157625600U, 4173350400U, 4189075200U,
+    4204800000U, 4221129600U, 4236854400U, 4252579200U, 4268304000U, 4284028800U,
+    1585443600U, 1603587600U, 1616893200U, 1635642000U, 1648342800U, 1667091600U,
+    1679792400U, 1698541200U, 1711846800U, 1729990800U, 1743296400U, 1761440400U,
+    1774746000U, 1792890000U, 1806195600U, 1824944400U, 1837645200U, 1856394000U,
+    1869094800U, 1887843600U, 1901149200U, 1919293200U, 1932598800U, 1950742800U,
+    1964048400U, 1982797200U, 1995498000U, 2014246800U, 2026947600U, 2045696400U,
+    2058397200U, 2077146000U, 2090451600U, 2108595600U, 2121901200U, 2140045200U,
+    2153350800U, 2172099600U, 2184800400U, 2203549200U, 2216250000U, 2234998800U,
+    2248304400U, 2266448400U, 2279754000U, 2297898000U, 2311203600U, 2329347600U,
+    2342653200U, 2361402000U, 2374102800U, 2392851600U, 2405552400U, 2424301200U,
+    2437606800U, 2455750800U, 2469056400U, 2487200400U, 2500506000U, 2519254800U,
+    2531955600U, 2550704400U, 2563405200U, 2582154000U, 2595459600U, 2613603600U,
+    2626909200U, 2645053200U, 2658358800U, 2676502800U, 2689808400U, 2708557200U,
+    2721258000U, 2740006800U, 2752707600U, 2771456400U, 2784762000U, 2802906000U,
+    2816211600U, 2834355600U, 2847661200U, 2866410000U, 2879110800U, 2897859600U,
+    2910560400U, 2929309200U, 2942010000U, 2960758800U, 2974064400U, 2992208400U,
+    3005514000U, 3023658000U, 3036963600U, 3055712400U, 3068413200U, 3087162000U,
+    3099862800U, 3118611600U, 3131917200U, 3150061200U, 3163366800U, 3181510800U,
+    3194816400U, 3212960400U, 3226266000U, 3245014800U, 3257715600U, 3276464400U,
+    3289165200U, 3307914000U, 3321219600U, 3339363600U, 3352669200U, 3370813200U,
+    3384118800U, 3402867600U, 3415568400U, 3434317200U, 3447018000U, 3465766800U,
+    3479072400U, 3497216400U, 3510522000U, 3528666000U, 3541971600U, 3560115600U,
+    3573421200U, 3592170000U, 3604870800U, 3623619600U, 3636320400U, 3655069200U,
+    3668374800U, 3686518800U, 3699824400U, 3717968400U, 3731274000U, 3750022800U,
+    3762723600U, 3781472400U, 3794173200U, 3812922000U, 3825622800U, 3844371600U,
+    3857677200U, 3875821200U, 3889126800U, 3907270800U, 3920576400U, 3939325200U,
+    3952026000U, 3970774800U, 3983475600U, 4002224400U, 4015530000U, 4033674000U,
+    4046979600U, 4065123600U, 4078429200U, 4096573200U, 4109878800U, 4128627600U,
+    4141328400U, 4160077200U, 4172778000U, 4191526800U, 4204227600U, 4222976400U,
+    4236282000U, 4254426000U, 4267731600U, 4285875600U, 1585443600U, 1603587600U,
+    1616893200U, 1635642000U, 1648342800U, 1667091600U, 1679792400U, 1698541200U,
+    1711846800U, 1729990800U, 1743296400U, 1761440400U, 1774746000U, 1792890000U,
+    1806195600U, 1824944400U, 1837645200U, 1856394000U, 1869094800U, 1887843600U,
+    1901149200U, 1919293200U, 1932598800U, 1950742800U, 1964048400U, 1982797200U,
+    1995498000U, 2014246800U, 2026947600U, 2045696400U, 2058397200U, 2077146000U,
+    2090451600U, 2108595600U, 2121901200U, 2140045200U, 2153350800U, 2172099600U,
+    2184800400U, 2203549200U, 2216250000U, 2234998800U, 2248304400U, 2266448400U,
+    2279754000U, 2297898000U, 2311203600U, 2329347600U, 2342653200U, 2361402000U,
+    2374102800U, 2392851600U, 2405552400U, 2424301200U, 2437606800U, 2455750800U,
+    2469056400U, 2487200400U, 2500506000U, 2519254800U, 2531955600U, 2550704400U,
+    2563405200U, 2582154000U, 2595459600U, 2613603600U, 2626909200U, 2645053200U,
+    2658358800U, 2676502800U, 2689808400U, 2708557200U, 2721258000U, 2740006800U,
+    2752707600U, 2771456400U, 2784762000U, 2802906000U, 2816211600U, 2834355600U,
+    2847661200U, 2866410000U, 2879110800U, 2897859600U, 2910560400U, 2929309200U,
+    2942010000U, 2960758800U, 2974064400U, 2992208400U, 3005514000U, 3023658000U,
+    3036963600U, 3055712400U, 3068413200U, 3087162000U, 3099862800U, 3118611600U,
+    3131917200U, 3150061200U, 3163366800U, 3181510800U, 3194816400U, 3212960400U,
+    3226266000U, 3245014800U, 3257715600U, 3276464400U, 3289165200U, 3307914000U,
+    3321219600U, 3339363600U, 3352669200U, 3370813200U, 3384118800U, 3402867600U,
+    3415568400U, 3434317200U, 3447018000U, 3465766800U, 3479072400U, 3497216400U,
+    3510522000U, 3528666000U, 3541971600U, 3560115600U, 3573421200U, 3592170000U,
+    3604870800U, 3623619600U, 3636320400U, 3655069200U, 3668374800U, 3686518800U,
+    3699824400U, 3717968400U, 3731274000U, 3750022800U, 3762723600U, 3781472400U,
+    3794173200U, 3812922000U, 3825622800U, 3844371600U, 3857677200U, 3875821200U,
+    3889126800U, 3907270800U, 3920576400U, 3939325200U, 3952026000U, 3970774800U,
+    3983475600U, 4002224400U, 4015530000U, 4033674000U, 4046979600U, 4065123600U,
+    4078429200U, 4096573200U, 4109878800U, 4128627600U, 4141328400U, 4160077200U,
+    4172778000U, 4191526800U, 4204227600U, 4222976400U, 4236282000U, 4254426000U,
+    4267731600U, 4285875600U, 1585443600U, 1603587600U, 1616893200U, 1635642000U,
+    1648342800U, 1667091600U, 1679792400U, 1698541200U, 1711846800U, 1729990800U,
+    1743296400U, 1761440400U, 1774746000U, 1792890000U, 1806195600U, 1824944400U,
+    1837645200U, 1856394000U, 1869094800U, 1887843600U, 1901149200U, 1919293200U,
+    1932598800U, 1950742800U, 1964048400U, 1982797200U, 1995498000U, 2014246800U,
+    2026947600U, 2045696400U, 2058397200U, 2077146000U, 2090451600U, 2108595600U,
+    2121901200U, 2140045200U, 2153350800U, 2172099600U, 2184800400U, 2203549200U,
+    2216250000U, 2234998800U, 2248304400U, 2266448400U, 2279754000U, 2297898000U,
+    2311203600U, 2329347600U, 2342653200U, 2361402000U, 2374102800U, 2392851600U,
+    2405552400U, 2424301200U, 2437606800U, 2455750800U, 2469056400U, 2487200400U,
+    2500506000U, 2519254800U, 2531955600U, 2550704400U, 2563405200U, 2582154000U,
+    2595459600U, 2613603600U, 2626909200U, 2645053200U, 2658358800U, 2676502800U,
+    2689808400U, 2708557200U, 2721258000U, 2740006800U, 2752707600U, 2771456400U,
+    2784762000U, 2802906000U, 2816211600U, 2834355600U, 2847661200U, 2866410000U,
+    2879110800U, 2897859600U, 2910560400U, 2929309200U, 2942010000U, 2960758800U,
+    2974064400U, 2992208400U, 3005514000U, 3023658000U, 3036963600U, 3055712400U,
+    3068413200U, 3087162000U, 3099862800U, 3118611600U, 3131917200U, 3150061200U,
+    3163366800U, 3181510800U, 3194816400U, 3212960400U, 3226266000U, 3245014800U,
+    3257715600U, 3276464400U, 3289165200U, 3307914000U, 3321219600U, 3339363600U,
+    3352669200U, 3370813200U, 3384118800U, 3402867600U, 3415568400U, 3434317200U,
+    3447018000U, 3465766800U, 3479072400U, 3497216400U, 3510522000U, 3528666000U,
+    3541971600U, 3560115600U, 3573421200U, 3592170000U, 3604870800U, 3623619600U,
+    3636320400U, 3655069200U, 3668374800U, 3686518800U, 3699824400U, 3717968400U,
+    3731274000U, 3750022800U, 3762723600U, 3781472400U, 3794173200U, 3812922000U,
+    3825622800U, 3844371600U, 3857677200U, 3875821200U, 3889126800U, 3907270800U,
+    3920576400U, 3939325200U, 3952026000U, 3970774800U, 3983475600U, 4002224400U,
+    4015530000U, 4033674000U, 4046979600U, 4065123600U, 4078429200U, 4096573200U,
+    4109878800U, 4128627600U, 4141328400U, 4160077200U, 4172778000U, 4191526800U,
+    4204227600U, 4222976400U, 4236282000U, 4254426000U, 4267731600U, 4285875600U,
+    1586008800U, 1601128800U, 1617458400U, 1632578400U, 1648908000U, 1664028000U,
+    1680357600U, 1695477600U, 1712412000U, 1727532000U, 1743861600U, 1758981600U,
+    1775311200U, 1790431200U, 1806760800U, 1821880800U, 1838210400U, 1853330400U,
+    1869660000U, 1885384800U, 1901714400U, 1916834400U, 1933164000U, 1948284000U,
+    1964613600U, 1979733600U, 1996063200U, 2011183200U, 2027512800U, 2042632800U,
+    2058962400U, 2074687200U, 2091016800U, 2106136800U, 2122466400U, 2137586400U,
+    2153916000U, 2169036000U, 2185365600U, 2200485600U, 2216815200U, 2232540000U,
+    2248869600U, 2263989600U, 2280319200U, 2295439200U, 2311768800U, 2326888800U,
+    2343218400U, 2358338400U, 2374668000U, 2389788000U, 2406117600U, 2421842400U,
+    2438172000U, 2453292000U, 2469621600U, 2484741600U, 2501071200U, 2516191200U,
+    2532520800U, 2547640800U, 2563970400U, 2579090400U, 2596024800U, 2611144800U,
+    2627474400U, 2642594400U, 2658924000U, 2674044000U, 2690373600U, 2705493600U,
+    2721823200U, 2736943200U, 2753272800U, 2768997600U, 2785327200U, 2800447200U,
+    2816776800U, 2831896800U, 2848226400U, 2863346400U, 2879676000U, 2894796000U,
+    2911125600U, 2926245600U, 2942575200U, 2958300000U, 2974629600U, 2989749600U,
+    3006079200U, 3021199200U, 3037528800U, 3052648800U, 3068978400U, 3084098400U,
+    3100428000U, 3116152800U, 3132482400U, 3147602400U, 3163932000U, 3179052000U,
+    3195381600U, 3210501600U, 3226831200U, 3241951200U, 3258280800U, 3273400800U,
+    3289730400U, 3305455200U, 3321784800U, 3336904800U, 3353234400U, 3368354400U,
+    3384684000U, 3399804000U, 3416133600U, 3431253600U, 3447583200U, 3462703200U,
+    3479637600U, 3494757600U, 3511087200U, 3526207200U, 3542536800U, 3557656800U,
+    3573986400U, 3589106400U, 3605436000U, 3620556000U, 3636885600U, 3652610400U,
+    3668940000U, 3684060000U, 3700389600U, 3715509600U, 3731839200U, 3746959200U,
+    3763288800U, 3778408800U, 3794738400U, 3809858400U, 3826188000U, 3841912800U,
+    3858242400U, 3873362400U, 3889692000U, 3904812000U, 3921141600U, 3936261600U,
+    3952591200U, 3967711200U, 3984040800U, 3999765600U, 4016095200U, 4031215200U,
+    4047544800U, 4062664800U, 4078994400U, 4094114400U, 4110444000U, 4125564000U,
+    4141893600U, 4157013600U, 4173343200U, 4188463200U, 4204792800U, 4220517600U,
+    4236847200U, 4251967200U, 4268296800U, 4283416800U,
+};
+
+/* Index into tz_rules_offsets of the offset in force from each instant. */
+const uint8_t tz_rules_kinds[2758] =
+{
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4,
+    5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4,
+    5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4,
+    5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4,
+    5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4,
+    5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4,
+    5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4,
+    5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4,
+    5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4,
+    5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4,
+    5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 8, 6, 8, 6, 8, 6,
+    8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6,
+    8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6,
+    8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6,
+    8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6,
+    8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6,
+    8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6,
+    8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6,
+    8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6,
+    8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6,
+    8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6,
+    8, 6, 8, 6, 8, 6, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2,
+    3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2,
+    3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2,
+    3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2,
+    3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2,
+    3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2,
+    3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2,
+    3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2,
+    3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2,
+    3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2,
+    3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2,
+    3, 2, 5, 4, 5, 4, 5, 4, 6, 5, 6, 5, 6, 5, 6, 5,
+    6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+    6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+    6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+    6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+    6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+    6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+    6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+    6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+    6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+    6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+    6, 5, 6, 5, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8,
+    6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8,
+    6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8,
+    6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8,
+    6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8,
+    6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8,
+    6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8,
+    6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8,
+    6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8,
+    6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8,
+    6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8, 6, 8,
+    9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7,
+    9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7,
+    9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7,
+    9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7,
+    9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7,
+    9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7,
+    9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7,
+    9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7,
+    9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7,
+    9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7,
+    9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 9, 7, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 16, 14, 16, 14, 16, 14, 24, 26,
+    24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26,
+    24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26,
+    24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26,
+    24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26,
+    24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26,
+    24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26,
+    24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26,
+    24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26,
+    24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26,
+    24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 24, 26,
+    24, 26, 24, 26, 24, 26, 24, 26, 24, 26, 25, 27, 25, 27, 25, 27,
+    25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27,
+    25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27,
+    25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27,
+    25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27,
+    25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27,
+    25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27,
+    25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27,
+    25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27,
+    25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27,
+    25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27, 25, 27,
+    25, 27, 25, 27, 25, 27, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11,
+    12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11,
+    12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11,
+    12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11,
+    12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11,
+    12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11,
+    12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11,
+    12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11,
+    12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11,
+    12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11,
+    12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11, 12, 11,
+    12, 11, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 11, 10,
+    11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10,
+    11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10,
+    11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10,
+    11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10,
+    11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10,
+    11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10,
+    11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10,
+    11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10,
+    11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10,
+    11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10,
+    11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 28, 29, 28, 29, 28, 29,
+    28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29,
+    28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29,
+    28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29,
+    28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29,
+    28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29,
+    28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29,
+    28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29,
+    28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29,
+    28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29,
+    28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29, 28, 29,
+    28, 29, 28, 29, 28, 29,
+};
+
+/* Sorted by name for bisection: name, first instant, instant count,
+ * offset before the first instant. */
+const tz_zone_t tz_rules_zones[59] =
+{
+    { "Africa/Cairo", 0, 166, 12 },
+    { "Africa/Johannesburg", 166, 0, 12 },
+    { "Africa/Lagos", 166, 0, 11 },
+    { "Africa/Nairobi", 166, 0, 13 },
+    { "America/Anchorage", 166, 172, 1 },
+    { "America/Argentina/Buenos_Aires", 166, 0, 8 },
+    { "America/Bogota", 166, 0, 5 },
+    { "America/Chicago", 338, 172, 4 },
+    { "America/Denver", 510, 172, 3 },
+    { "America/Halifax", 682, 172, 6 },
+    { "America/Los_Angeles", 854, 172, 2 },
+    { "America/Mexico_City", 1026, 6, 4 },
+    { "America/New_York", 1032, 172, 5 },
+    { "America/Phoenix", 166, 0, 3 },
+    { "America/Santiago", 1204, 172, 8 },
+    { "America/Sao_Paulo", 166, 0, 8 },
+    { "America/St_Johns", 1376, 172, 7 },
+    { "America/Toronto", 1032, 172, 5 },
+    { "America/Vancouver", 854, 172, 2 },
+    { "Asia/Bangkok", 166, 0, 21 },
+    { "Asia/Dhaka", 166, 0, 20 },
+    { "Asia/Dubai", 166, 0, 15 },
+    { "Asia/Hong_Kong", 166, 0, 22 },
+    { "Asia/Jakarta", 166, 0, 21 },
+    { "Asia/Jerusalem", 1548, 172, 12 },
+    { "Asia/Karachi", 166, 0, 17 },
+    { "Asia/Kathmandu", 166, 0, 19 },
+    { "Asia/Kolkata", 166, 0, 18 },
+    { "Asia/Manila", 166, 0, 22 },
+    { "Asia/Seoul", 166, 0, 23 },
+    { "Asia/Shanghai", 166, 0, 22 },
+    { "Asia/Singapore", 166, 0, 22 },
+    { "Asia/Taipei", 166, 0, 22 },
+    { "Asia/Tehran", 1720, 6, 14 },
+    { "Asia/Tokyo", 166, 0, 23 },
+    { "Australia/Adelaide", 1726, 172, 26 },
+    { "Australia/Brisbane", 166, 0, 25 },
+    { "Australia/Melbourne", 1898, 172, 27 },
+    { "Australia/Perth", 166, 0, 22 },
+    { "Australia/Sydney", 1898, 172, 27 },
+    { "Europe/Amsterdam", 2070, 172, 11 },
+    { "Europe/Athens", 2242, 172, 12 },
+    { "Europe/Berlin", 2070, 172, 11 },
+    { "Europe/Dublin", 2414, 172, 10 },
+    { "Europe/Helsinki", 2242, 172, 12 },
+    { "Europe/Istanbul", 166, 0, 13 },
+    { "Europe/Kyiv", 2242, 172, 12 },
+    { "Europe/Lisbon", 2414, 172, 10 },
+    { "Europe/London", 2414, 172, 10 },
+    { "Europe/Madrid", 2070, 172, 11 },
+    { "Europe/Moscow", 166, 0, 13 },
+    { "Europe/Paris", 2070, 172, 11 },
+    { "Europe/Rome", 2070, 172, 11 },
+    { "Europe/Stockholm", 2070, 172, 11 },
+    { "Europe/Warsaw", 2070, 172, 11 },
+    { "Europe/Zurich", 2070, 172, 11 },
+    { "Pacific/Auckland", 2586, 172, 29 },
+    { "Pacific/Honolulu", 166, 0, 0 },
+    { "UTC", 166, 0, 10 },
+};
+
+const uint32_t tz_rules_zone_count = 59U;
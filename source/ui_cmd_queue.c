@@ -0,0 +1,271 @@
+/******************************************************************************
+*
+* File Name: ui_cmd_queue.c
+*
+* Description: This file contains the bounded command queue through which other
+* tasks and interrupts hand UI updates to the TFT task, which is the
+* only task allowed to touch LVGL objects.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <string.h>
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "ui_cmd_queue.h"
+#include "ui_sync.h"
+#include "tft_task.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static StaticQueue_t ui_cmd_queue_ctrl;
+static uint8_t ui_cmd_queue_storage[UI_CMD_QUEUE_LENGTH * sizeof(ui_cmd_t)];
+static QueueHandle_t ui_cmd_queue;
+
+static ui_cmd_stats_t ui_cmd_stats;
+
+/*******************************************************************************
+* Function Name: void ui_cmd_queue_init(void)
+********************************************************************************
+*
+* Summary: Creates the command queue in static storage. Must be called before
+*          the tasks that post to it are started.
+*
+*******************************************************************************/
+void ui_cmd_queue_init(void)
+{
+    ui_cmd_queue = xQueueCreateStatic(UI_CMD_QUEUE_LENGTH, sizeof(ui_cmd_t),
+                                      ui_cmd_queue_storage, &ui_cmd_queue_ctrl);
+    configASSERT(NULL != ui_cmd_queue);
+}
+
+/*******************************************************************************
+* Function Name: bool ui_cmd_post(const ui_cmd_t *cmd)
+********************************************************************************
+*
+* Summary: Copies a command into the queue and wakes the TFT task. Never
+*          blocks: when the queue is full the command is dropped and counted.
+*
+* Parameters:
+*  cmd: command to post
+*
+* Return:
+*  true if the command was queued
+*
+*******************************************************************************/
+bool ui_cmd_post(const ui_cmd_t *cmd)
+{
+    bool queued = (pdPASS == xQueueSendToBack(ui_cmd_queue, cmd, 0));
+
+    taskENTER_CRITICAL();
+    if (queued)
+    {
+        ui_cmd_stats.posted++;
+    }
+    else
+    {
+        ui_cmd_stats.dropped++;
+    }
+    taskEXIT_CRITICAL();
+
+    if (queued)
+    {
+        tft_task_notify();
+    }
+
+    return queued;
+}
+
+/*******************************************************************************
+* Function Name: bool ui_cmd_post_from_isr(const ui_cmd_t *cmd, BaseType_t *woken)
+********************************************************************************
+*
+* Summary: Interrupt-safe variant of ui_cmd_post().
+*
+* Parameters:
+*  cmd: command to post
+*  woken: set to pdTRUE if a context switch should be requested on exit
+*
+* Return:
+*  true if the command was queued
+*
+*******************************************************************************/
+bool ui_cmd_post_from_isr(const ui_cmd_t *cmd, BaseType_t *woken)
+{
+    bool queued = (pdPASS == xQueueSendToBackFromISR(ui_cmd_queue, cmd, woken));
+    UBaseType_t saved = taskENTER_CRITICAL_FROM_ISR();
+
+    if (queued)
+    {
+        ui_cmd_stats.posted++;
+    }
+    else
+    {
+        ui_cmd_stats.dropped++;
+    }
+    taskEXIT_CRITICAL_FROM_ISR(saved);
+
+    if (queued)
+    {
+        tft_task_notify_from_isr(woken);
+    }
+
+    return queued;
+}
+
+/*******************************************************************************
+* Function Name: bool ui_cmd_post_wifi(bool connected)
+********************************************************************************
+*
+* Summary: Posts the Wi-Fi connection state for the top bar icon.
+*
+*******************************************************************************/
+bool ui_cmd_post_wifi(bool connected)
+{
+    ui_cmd_t cmd;
+
+    cmd.type = UI_CMD_WIFI_STATE;
+    cmd.data.wifi_connected = connected;
+
+    return ui_cmd_post(&cmd);
+}
+
+/*******************************************************************************
+* Function Name: bool ui_cmd_post_field(ui_field_t field, const char *text, size_t len)
+********************************************************************************
+*
+* Summary: Posts new text for a dashboard field. Text longer than the field
+*          holds is truncated, the same as ui_sync_set_field() does.
+*
+*******************************************************************************/
+bool ui_cmd_post_field(ui_field_t field, const char *text, size_t len)
+{
+    ui_cmd_t cmd;
+
+    if (len > (UI_FIELD_TEXT_LEN - 1u))
+    {
+        len = UI_FIELD_TEXT_LEN - 1u;
+    }
+
+    cmd.type = UI_CMD_SET_FIELD;
+    cmd.data.field.field = field;
+    cmd.data.field.len = (uint8_t)len;
+    memcpy(cmd.data.field.text, text, len);
+
+    return ui_cmd_post(&cmd);
+}
+
+/*******************************************************************************
+* Function Name: bool ui_cmd_pending(void)
+********************************************************************************
+*
+* Summary: Tells whether commands are waiting to be drained.
+*
+*******************************************************************************/
+bool ui_cmd_pending(void)
+{
+    return (0u != uxQueueMessagesWaiting(ui_cmd_queue));
+}
+
+/*******************************************************************************
+* Function Name: uint32_t ui_cmd_drain(void)
+********************************************************************************
+*
+* Summary: Applies up to UI_CMD_BATCH_MAX queued commands to the bindings and
+*          pushes the result into LVGL. Only the TFT task may call this.
+*
+* Return:
+*  number of commands applied
+*
+*******************************************************************************/
+uint32_t ui_cmd_drain(void)
+{
+    ui_cmd_t cmd;
+    uint32_t count = 0;
+
+    while ((count < UI_CMD_BATCH_MAX) && (pdPASS == xQueueReceive(ui_cmd_queue, &cmd, 0)))
+    {
+        switch (cmd.type)
+        {
+            case UI_CMD_WIFI_STATE:
+                ui_sync_set_wifi(cmd.data.wifi_connected);
+                break;
+
+            case UI_CMD_SET_FIELD:
+                ui_sync_set_field(cmd.data.field.field, cmd.data.field.text, cmd.data.field.len);
+                break;
+
+            case UI_CMD_WEATHER_CODE:
+                ui_sync_set_weather_code((int)cmd.data.weather_code);
+                break;
+
+            default:
+                break;
+        }
+        count++;
+    }
+
+    if (0u != count)
+    {
+        ui_sync_apply();
+
+        taskENTER_CRITICAL();
+        ui_cmd_stats.applied += count;
+        ui_cmd_stats.batches++;
+        taskEXIT_CRITICAL();
+    }
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: void ui_cmd_get_stats(ui_cmd_stats_t *stats)
+********************************************************************************
+*
+* Summary: Copies out the queue counters.
+*
+*******************************************************************************/
+void ui_cmd_get_stats(ui_cmd_stats_t *stats)
+{
+    taskENTER_CRITICAL();
+    *stats = ui_cmd_stats;
+    taskEXIT_CRITICAL();
+}
+
+/* [] END OF FILE */
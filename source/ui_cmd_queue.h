@@ -0,0 +1,126 @@
+/******************************************************************************
+*
+* File Name: ui_cmd_queue.h
+*
+* Description: This file is the public interface of ui_cmd_queue.c source file
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include guard
+ ******************************************************************************/
+#ifndef UI_CMD_QUEUE_H_
+#define UI_CMD_QUEUE_H_
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "FreeRTOS.h"
+#include "ui_sync.h"
+
+/*******************************************************************************
+* Global constants
+*******************************************************************************/
+/* Number of commands the queue holds before posts start being dropped. */
+#define UI_CMD_QUEUE_LENGTH     (16u)
+
+/* Most commands applied by one ui_cmd_drain() call. */
+#define UI_CMD_BATCH_MAX        (8u)
+
+/*******************************************************************************
+ * Data structure and enumeration
+ ******************************************************************************/
+typedef enum
+{
+    UI_CMD_WIFI_STATE,      /* show or hide the Wi-Fi icon */
+    UI_CMD_SET_FIELD,       /* set the text of a dashboard field */
+    UI_CMD_WEATHER_CODE     /* set the rain field from a WMO weather code */
+} ui_cmd_type_t;
+
+/* Commands are copied into the queue by value, so the poster's buffers can be
+ * reused as soon as the post returns. */
+typedef struct
+{
+    ui_cmd_type_t type;
+    union
+    {
+        bool wifi_connected;
+        int32_t weather_code;
+        struct
+        {
+            ui_field_t field;
+            uint8_t len;
+            char text[UI_FIELD_TEXT_LEN];
+        } field;
+    } data;
+} ui_cmd_t;
+
+typedef struct
+{
+    uint32_t posted;        /* commands accepted into the queue */
+    uint32_t dropped;       /* posts rejected because the queue was full */
+    uint32_t applied;       /* commands taken out and applied by the TFT task */
+    uint32_t batches;       /* ui_cmd_drain() calls that applied something */
+} ui_cmd_stats_t;
+
+/*******************************************************************************
+ * Function prototype
+ ******************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void ui_cmd_queue_init(void);
+
+bool ui_cmd_post(const ui_cmd_t *cmd);
+bool ui_cmd_post_from_isr(const ui_cmd_t *cmd, BaseType_t *woken);
+bool ui_cmd_post_wifi(bool connected);
+bool ui_cmd_post_field(ui_field_t field, const char *text, size_t len);
+
+bool ui_cmd_pending(void);
+uint32_t ui_cmd_drain(void);
+void ui_cmd_get_stats(ui_cmd_stats_t *stats);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UI_CMD_QUEUE_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,462 @@
+/******************************************************************************
+*
+* File Name: ui_sync.c
+*
+* Description: This file contains the data-to-UI sync path of the dashboard: the
+* binding layer that pushes fetched weather and location data into the labels
+* only when a value changes, and the LVGL timer callback that keeps the clock
+* running, once a minute. It only depends on LVGL and the generated UI, so it
+* builds both for the target and for the desktop simulator.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ui.h"
+#include "ui_sync.h"
+#include "civil_time.h"
+#include "tz_rules.h"
+#include "timekeeper.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Label each field is bound to, the current text, and the generation last
+ * pushed into the label. */
+typedef struct
+{
+    lv_obj_t **label;
+    char text[UI_FIELD_TEXT_LEN];
+    uint32_t generation;
+    uint32_t applied_generation;
+} ui_binding_t;
+
+static ui_binding_t ui_bindings[UI_FIELD_COUNT] =
+{
+    [UI_FIELD_TEMPERATURE] = { .label = &ui_Temperature },
+    [UI_FIELD_HUMIDITY]    = { .label = &ui_Humidity },
+    [UI_FIELD_WINDSPEED]   = { .label = &ui_WindSpeed },
+    [UI_FIELD_RAIN]        = { .label = &ui_Rain },
+    [UI_FIELD_LOCATION]    = { .label = &ui_Location },
+};
+
+static ui_sync_stats_t ui_sync_stats;
+static uint32_t ui_run_us;          // run time below a millisecond, not yet in run_ms
+static uint32_t ui_run_start;       // lv_tick_get() when the clock started
+
+/* Wi-Fi icon visibility, bound the same way as the label fields. */
+static bool wifi_connected = true;   /* the icon is created visible */
+static uint32_t wifi_generation;
+static uint32_t wifi_applied_generation;
+
+civil_time_t current_time;  // Local time shown by the clock
+
+static tz_rules_cache_t clock_tz;   // zone of the geo response, offset cache
+static char clock_tz_name[WEATHER_TIMEZONE_LEN]; // zone name clock_tz was selected for
+static uint32_t clock_local;        // local seconds in current_time, 0 to rebuild it
+static uint32_t clock_day = UINT32_MAX; // local day the date labels show
+static uint8_t clock_hour = UINT8_MAX;  // hour and minute the labels show
+static uint8_t clock_minute = UINT8_MAX;
+static lv_timer_t *clock_timer;
+
+// Label texts for hours, minutes and days, set without copying.
+static const char clock_digits[60][3] =
+{
+    "00", "01", "02", "03", "04", "05", "06", "07", "08", "09",
+    "10", "11", "12", "13", "14", "15", "16", "17", "18", "19",
+    "20", "21", "22", "23", "24", "25", "26", "27", "28", "29",
+    "30", "31", "32", "33", "34", "35", "36", "37", "38", "39",
+    "40", "41", "42", "43", "44", "45", "46", "47", "48", "49",
+    "50", "51", "52", "53", "54", "55", "56", "57", "58", "59",
+};
+
+/*******************************************************************************
+* Function Name: void clock_tick_cb(lv_timer_t *timer)
+********************************************************************************
+*
+* Summary: Shows the local time and re-arms the timer for the next minute
+*          boundary, so it runs once a minute instead of polling. Only the
+*          labels whose digits changed are set, which leaves the hour label
+*          alone for 59 minutes out of 60.
+*
+*******************************************************************************/
+static void clock_tick_cb(lv_timer_t *timer)
+{
+    ui_sync_stats.clock_ticks++;
+
+    if (!timekeeper_valid())
+    {
+        lv_timer_set_period(timer, CLOCK_RETRY_MS);
+        return;
+    }
+
+    // The offset comes from the cache until the next DST change.
+    uint64_t utc_ms = timekeeper_now_ms();
+    uint32_t utc = (uint32_t)(utc_ms / 1000u);
+    uint32_t local = utc + (uint32_t)tz_rules_offset(&clock_tz, utc);
+
+    if ((0u != clock_local) && (local >= clock_local))
+    {
+        // Carry the elapsed seconds through the fields.
+        civil_time_advance(&current_time, local - clock_local);
+    }
+    else
+    {
+        civil_time_from_epoch(local, &current_time);
+    }
+    clock_local = local;
+
+    const civil_time_t *t = &current_time;
+
+    // Detect date rollover (day change)
+    if ((local / CIVIL_SECONDS_PER_DAY) != clock_day) 
+    {
+        clock_day = local / CIVIL_SECONDS_PER_DAY;
+
+        // Update date UI locally
+        lv_label_set_text_static(ui_Date, clock_digits[t->day]);
+        lv_label_set_text_static(ui_Month, civil_month_str(t->month));
+        lv_label_set_text_static(ui_Vaar, civil_weekday_str(t->weekday));
+        ui_sync_stats.clock_labels += 3u;
+    }
+
+    // Update clock display
+    if (t->hour != clock_hour)
+    {
+        clock_hour = t->hour;
+        lv_label_set_text_static(ui_HHH, clock_digits[t->hour]);
+        ui_sync_stats.clock_labels++;
+    }
+    if (t->minute != clock_minute)
+    {
+        clock_minute = t->minute;
+        lv_label_set_text_static(ui_MMM, clock_digits[t->minute]);
+        ui_sync_stats.clock_labels++;
+    }
+
+    // Zone offsets are whole minutes, so UTC and local minutes turn over
+    // together. A timer that fires a little early just runs again.
+    uint32_t into_minute_ms = (uint32_t)(utc_ms % (60u * 1000u));
+    lv_timer_set_period(timer, (60u * 1000u) - into_minute_ms);
+}
+
+/*******************************************************************************
+* Function Name: void ui_sync_clock_start(void)
+********************************************************************************
+*
+* Summary: Creates the clock timer and runs it on the next timer pass. Call
+*          once from the task that owns LVGL, after the UI is created.
+*
+*******************************************************************************/
+void ui_sync_clock_start(void)
+{
+    clock_timer = lv_timer_create(clock_tick_cb, CLOCK_RETRY_MS, NULL);
+    lv_timer_ready(clock_timer);
+    ui_run_start = lv_tick_get();
+}
+
+/*******************************************************************************
+ * Data binding
+ ********************************************************************************/
+/*******************************************************************************
+* Function Name: bool ui_sync_set_field(ui_field_t field, const char *text, size_t len)
+********************************************************************************
+*
+* Summary: Stores a new value for a dashboard field. The field's generation is
+*          only bumped when the text actually differs from what it holds, so
+*          an unchanged value never reaches LVGL.
+*
+* Parameters:
+*  field: field to update
+*  text:  new text, need not be NUL-terminated
+*  len:   length of text; truncated to UI_FIELD_TEXT_LEN - 1
+*
+* Return:
+*  true if the value changed
+*
+*******************************************************************************/
+bool ui_sync_set_field(ui_field_t field, const char *text, size_t len)
+{
+    ui_binding_t *b = &ui_bindings[field];
+
+    if(len > (UI_FIELD_TEXT_LEN - 1u))
+    {
+        len = UI_FIELD_TEXT_LEN - 1u;
+    }
+
+    if((strncmp(b->text, text, len) == 0) && (b->text[len] == '\0'))
+    {
+        ui_sync_stats.suppressed++;
+        return false;
+    }
+
+    memcpy(b->text, text, len);
+    b->text[len] = '\0';
+    b->generation++;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: bool ui_sync_set_weather_code(int code)
+********************************************************************************
+*
+* Summary: Maps a WMO weather code to the rain indicator. Codes that map to
+*          the same indicator are suppressed like any other unchanged value.
+*
+*******************************************************************************/
+bool ui_sync_set_weather_code(int code)
+{
+    // Codes that indicate precipitation
+    bool is_rain = (
+                    code == 51 || code == 53 || code == 55 ||   // Drizzle
+                    code == 56 || code == 57 ||                 // Freezing drizzle
+                    code == 61 || code == 63 || code == 65 ||   // Rain
+                    code == 66 || code == 67 ||                 // Freezing rain
+                    code == 80 || code == 81 || code == 82 ||   // Rain showers
+                    code == 95 || code == 96 || code == 99      // Thunderstorm / hail
+                    );
+
+    return ui_sync_set_field(UI_FIELD_RAIN, is_rain ? "Y" : "N", 1u);
+}
+
+/*******************************************************************************
+* Function Name: bool ui_sync_set_wifi(bool connected)
+********************************************************************************
+*
+* Summary: Sets the Wi-Fi state shown by the top bar icon.
+*
+*******************************************************************************/
+bool ui_sync_set_wifi(bool connected)
+{
+    if(connected == wifi_connected)
+    {
+        ui_sync_stats.suppressed++;
+        return false;
+    }
+
+    wifi_connected = connected;
+    wifi_generation++;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: bool ui_sync_set_timezone(const char *timezone)
+********************************************************************************
+*
+* Summary: Sets the IANA zone the clock shows local time for. The next clock
+*          tick redraws the time and date when the zone changes. The zone is
+*          logged once per change of name, including a name that was not
+*          compiled in and shows UTC.
+*
+*******************************************************************************/
+bool ui_sync_set_timezone(const char *timezone)
+{
+    if(0 == strncmp(clock_tz_name, timezone, sizeof(clock_tz_name) - 1u))
+    {
+        return false;
+    }
+    strncpy(clock_tz_name, timezone, sizeof(clock_tz_name) - 1u);
+
+    bool changed = tz_rules_select(&clock_tz, timezone);
+
+    if((NULL == clock_tz.zone) && ('\0' != timezone[0]))
+    {
+        printf("Timezone %s not compiled in, showing UTC\n", timezone);
+    }
+    if(!changed)
+    {
+        return false;
+    }
+
+    int32_t offset = tz_rules_offset(&clock_tz, timekeeper_now());
+    int32_t minutes = (offset < 0) ? (-offset / 60) : (offset / 60);
+    printf("Timezone %s: UTC%c%02ld:%02ld\n", timezone, (offset < 0) ? '-' : '+',
+           (long)(minutes / 60), (long)(minutes % 60));
+
+    clock_local = 0u;
+    clock_day = UINT32_MAX;
+    if(NULL != clock_timer)
+    {
+        lv_timer_ready(clock_timer);
+    }
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: uint32_t ui_sync_apply(void)
+********************************************************************************
+*
+* Summary: Pushes every field whose generation moved since the last call into
+*          its label, and the Wi-Fi state into the icon. Must run in the task
+*          that owns LVGL.
+*
+* Return:
+*  number of objects updated
+*
+*******************************************************************************/
+uint32_t ui_sync_apply(void)
+{
+    uint32_t updated = 0;
+
+    for(uint32_t i = 0; i < UI_FIELD_COUNT; i++)
+    {
+        ui_binding_t *b = &ui_bindings[i];
+
+        if(b->generation != b->applied_generation)
+        {
+            lv_label_set_text(*b->label, b->text);
+            b->applied_generation = b->generation;
+            updated++;
+        }
+    }
+
+    if(wifi_generation != wifi_applied_generation)
+    {
+        if(wifi_connected)
+        {
+            lv_obj_clear_flag(ui_WiFiIcon, LV_OBJ_FLAG_HIDDEN);
+        }
+        else
+        {
+            lv_obj_add_flag(ui_WiFiIcon, LV_OBJ_FLAG_HIDDEN);
+        }
+        wifi_applied_generation = wifi_generation;
+        updated++;
+    }
+
+    ui_sync_stats.applied += updated;
+    return updated;
+}
+
+/*******************************************************************************
+* Function Name: void ui_sync_add_run_time(uint32_t us)
+********************************************************************************
+*
+* Summary: Adds time the TFT task spent syncing data and running the LVGL
+*          handler to the run time counter. Call it from the task that owns
+*          LVGL, after each pass.
+*
+* Parameters:
+*  us: microseconds spent in the pass
+*
+*******************************************************************************/
+void ui_sync_add_run_time(uint32_t us)
+{
+    ui_run_us += us;
+    ui_sync_stats.run_ms += ui_run_us / 1000u;
+    ui_run_us %= 1000u;
+}
+
+/*******************************************************************************
+* Function Name: void ui_sync_get_stats(ui_sync_stats_t *stats)
+********************************************************************************
+*
+* Summary: Copies the label update, clock and run time counters, and sets
+*          uptime_ms to the time since ui_sync_clock_start(). Both millisecond
+*          counters wrap after 49 days.
+*
+* Parameters:
+*  stats: filled with the counters
+*
+*******************************************************************************/
+void ui_sync_get_stats(ui_sync_stats_t *stats)
+{
+    *stats = ui_sync_stats;
+    stats->uptime_ms = lv_tick_get() - ui_run_start;
+}
+
+/*******************************************************************************
+* Function Name: void ui_sync_print_stats(void)
+********************************************************************************
+*
+* Summary: Prints the label update and clock counters, and the TFT task run
+*          time scaled to one hour. Only the TFT task writes them, a word at a
+*          time, so any task may print them.
+*
+*******************************************************************************/
+void ui_sync_print_stats(void)
+{
+    ui_sync_stats_t s;
+
+    ui_sync_get_stats(&s);
+    printf("UI label updates: applied %lu, suppressed %lu; clock labels %lu in %lu ticks\n",
+           (unsigned long)s.applied, (unsigned long)s.suppressed,
+           (unsigned long)s.clock_labels, (unsigned long)s.clock_ticks);
+
+    if(0u != s.uptime_ms)
+    {
+        uint64_t per_hour = ((uint64_t)s.run_ms * 3600000u) / s.uptime_ms;
+
+        printf("UI run time: %lu ms in %lu s, %lu ms per hour\n",
+               (unsigned long)s.run_ms, (unsigned long)(s.uptime_ms / 1000u),
+               (unsigned long)per_hour);
+    }
+}
+
+/*******************************************************************************
+* Function Name: void sync_all_data(void)
+********************************************************************************
+*
+* Summary: Called by the TFT task every time it wakes. Takes the latest
+*          snapshot published by the HTTPS task, if there is a new one, feeds
+*          it into the bindings and the clock, and pushes changed fields into
+*          their labels.
+*
+*******************************************************************************/
+void sync_all_data(void)
+{
+    const weather_state_t *state;
+
+    if(weather_state_acquire(&state))
+    {
+        ui_sync_set_field(UI_FIELD_TEMPERATURE, state->temperature, strlen(state->temperature));
+        ui_sync_set_field(UI_FIELD_HUMIDITY, state->humidity, strlen(state->humidity));
+        ui_sync_set_field(UI_FIELD_WINDSPEED, state->windspeed, strlen(state->windspeed));
+        ui_sync_set_field(UI_FIELD_LOCATION, state->city, strlen(state->city));
+        ui_sync_set_weather_code(state->weather_code);
+        ui_sync_set_timezone(state->timezone);
+
+        ui_sync_apply();
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,122 @@
+/******************************************************************************
+*
+* File Name: ui_sync.h
+*
+* Description: This file is the public interface of ui_sync.c source file
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include guard
+ ******************************************************************************/
+#ifndef UI_SYNC_H_
+#define UI_SYNC_H_
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "lvgl.h"
+#include "weather_state.h"
+#include "civil_time.h"
+
+/*******************************************************************************
+* Global constants
+*******************************************************************************/
+/* Fits every weather_state_t text field; the longest is the city. */
+#define UI_FIELD_TEXT_LEN       (WEATHER_CITY_LEN)
+
+/* Clock timer period while the timekeeper has no time yet. */
+#define CLOCK_RETRY_MS          (1000u)
+
+/*******************************************************************************
+ * Data structure and enumeration
+ ******************************************************************************/
+/* Dashboard fields fed from the geo and weather responses. */
+typedef enum
+{
+    UI_FIELD_TEMPERATURE,
+    UI_FIELD_HUMIDITY,
+    UI_FIELD_WINDSPEED,
+    UI_FIELD_RAIN,
+    UI_FIELD_LOCATION,
+    UI_FIELD_COUNT
+} ui_field_t;
+
+typedef struct
+{
+    uint32_t applied;       /* label updates pushed into LVGL */
+    uint32_t suppressed;    /* writes dropped because the value was unchanged */
+    uint32_t clock_ticks;   /* clock timer runs */
+    uint32_t clock_labels;  /* clock and date labels set, each one invalidated */
+    uint32_t run_ms;        /* TFT task time in the sync and LVGL handlers */
+    uint32_t uptime_ms;     /* time run_ms was collected over */
+} ui_sync_stats_t;
+
+/*******************************************************************************
+ * Global variable
+ ******************************************************************************/
+extern civil_time_t current_time;
+
+/*******************************************************************************
+ * Function prototype
+ ******************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void ui_sync_clock_start(void);
+
+bool ui_sync_set_field(ui_field_t field, const char *text, size_t len);
+bool ui_sync_set_weather_code(int code);
+bool ui_sync_set_wifi(bool connected);
+bool ui_sync_set_timezone(const char *timezone);
+uint32_t ui_sync_apply(void);
+void ui_sync_add_run_time(uint32_t us);
+void ui_sync_get_stats(ui_sync_stats_t *stats);
+void ui_sync_print_stats(void);
+
+void sync_all_data(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* UI_SYNC_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,502 @@
+/******************************************************************************
+*
+* File Name: weather_hedge.c
+*
+* Description: This file contains the hedged weather request. Requests run
+* in lane tasks so that a slow one can be overtaken: the preferred
+* provider starts, the next one is added once the first is late or
+* has failed, and the first good answer wins. The loser finishes in
+* the background and its result is dropped.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Header file includes */
+#include <stdio.h>
+#include <string.h>
+
+/* FreeRTOS header file */
+#include <FreeRTOS.h>
+#include <task.h>
+#include <event_groups.h>
+
+#include "weather_hedge.h"
+#include "secure_http_client.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Lanes run at the priority of the HTTPS client task. */
+#define WEATHER_HEDGE_LANE_STACK_SIZE            (8U * 1024U)
+#define WEATHER_HEDGE_LANE_PRIORITY              (configMAX_PRIORITIES - 3)
+
+#define WEATHER_HEDGE_MAX_MS                     (TRANSPORT_SEND_RECV_TIMEOUT_MS)
+
+/* Longest wait for any lane to answer; the lanes time out on their own. */
+#define WEATHER_HEDGE_WAIT_MS                    (4U * TRANSPORT_SEND_RECV_TIMEOUT_MS)
+
+/* Event bits of lane n. */
+#define WEATHER_HEDGE_FIRST_BYTE(n)              ((EventBits_t)1U << (2U * (n)))
+#define WEATHER_HEDGE_DONE(n)                    ((EventBits_t)2U << (2U * (n)))
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+typedef struct
+{
+    TaskHandle_t task;
+    bool busy;                          /* set by the run, cleared by the lane,
+                                         * in critical sections */
+    weather_provider_id_t provider;
+    TickType_t start;
+    volatile uint32_t first_byte_ms;    /* 0 until the response starts */
+    fetch_outcome_t outcome;
+} weather_hedge_lane_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const weather_hedge_ops_t *weather_hedge_ops;
+static EventGroupHandle_t weather_hedge_events;
+static weather_hedge_lane_t weather_hedge_lanes[WEATHER_HEDGE_LANES];
+static weather_hedge_stats_t weather_hedge_stats[WEATHER_PROVIDER_COUNT];
+
+/* Provider asked first: the one that last answered. */
+static weather_provider_id_t weather_hedge_preferred;
+
+/*******************************************************************************
+ * Function Name: weather_hedge_count
+ *******************************************************************************
+ * Summary:
+ *  Adds one to a provider counter. The lanes and the HTTPS task both count,
+ *  and the console reads the counters, so this is done in a critical section.
+ *
+ *******************************************************************************/
+static void weather_hedge_count(uint32_t *counter)
+{
+    taskENTER_CRITICAL();
+    (*counter)++;
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+ * Function Name: weather_hedge_record
+ *******************************************************************************
+ * Summary:
+ *  Adds a first-byte time to the provider's ring of samples.
+ *
+ *******************************************************************************/
+static void weather_hedge_record(weather_provider_id_t provider, uint32_t ms)
+{
+    weather_hedge_stats_t *stats = &weather_hedge_stats[provider];
+
+    taskENTER_CRITICAL();
+    stats->first_byte_ms[stats->next] = (uint16_t)((ms > UINT16_MAX) ? UINT16_MAX : ms);
+    stats->next = (uint8_t)((stats->next + 1U) % WEATHER_HEDGE_SAMPLES);
+    if (stats->samples < WEATHER_HEDGE_SAMPLES)
+    {
+        stats->samples++;
+    }
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+ * Function Name: weather_hedge_lane_task
+ *******************************************************************************
+ * Summary:
+ *  Runs one request each time weather_hedge_launch() wakes it, records how
+ *  long the provider took to start answering and signals the result.
+ *
+ *******************************************************************************/
+static void weather_hedge_lane_task(void *arg)
+{
+    weather_hedge_lane_t *lane = (weather_hedge_lane_t *)arg;
+    uint32_t id = (uint32_t)(lane - weather_hedge_lanes);
+    uint32_t elapsed_ms;
+
+    while (true)
+    {
+        (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        lane->outcome = weather_hedge_ops->fetch(id, lane->provider);
+        elapsed_ms = (uint32_t)((xTaskGetTickCount() - lane->start) * portTICK_PERIOD_MS);
+
+        if (FETCH_OK == lane->outcome)
+        {
+            /* A response without a body starts and ends at once. */
+            weather_hedge_record(lane->provider, (0U != lane->first_byte_ms) ? lane->first_byte_ms : elapsed_ms);
+        }
+        else
+        {
+            weather_hedge_count(&weather_hedge_stats[lane->provider].failures);
+        }
+
+        /* The outcome is written before the lane is seen free. */
+        taskENTER_CRITICAL();
+        lane->busy = false;
+        taskEXIT_CRITICAL();
+        (void)xEventGroupSetBits(weather_hedge_events,
+                                 WEATHER_HEDGE_FIRST_BYTE(id) | WEATHER_HEDGE_DONE(id));
+    }
+}
+
+/*******************************************************************************
+ * Function Name: weather_hedge_launch
+ *******************************************************************************
+ * Summary:
+ *  Starts a request to a provider on a free lane. A provider still being
+ *  asked by a lane, such as the loser of an earlier call, is not asked again
+ *  until that lane is done.
+ *
+ * Return:
+ *  int32_t: the lane, or -1 if every lane is still busy with an earlier
+ *  request or one of them is asking the provider
+ *
+ *******************************************************************************/
+static int32_t weather_hedge_launch(weather_provider_id_t provider)
+{
+    weather_hedge_lane_t *lane = NULL;
+    uint32_t i;
+
+    taskENTER_CRITICAL();
+    for (uint32_t n = 0; n < WEATHER_HEDGE_LANES; n++)
+    {
+        if (!weather_hedge_lanes[n].busy)
+        {
+            if (NULL == lane)
+            {
+                lane = &weather_hedge_lanes[n];
+            }
+        }
+        else if (weather_hedge_lanes[n].provider == provider)
+        {
+            lane = NULL;
+            break;
+        }
+    }
+    if (NULL != lane)
+    {
+        lane->busy = true;
+        lane->provider = provider;
+    }
+    taskEXIT_CRITICAL();
+
+    if (NULL == lane)
+    {
+        return -1;
+    }
+    i = (uint32_t)(lane - weather_hedge_lanes);
+
+    weather_hedge_ops->prepare(i, provider);
+
+    (void)xEventGroupClearBits(weather_hedge_events,
+                               WEATHER_HEDGE_FIRST_BYTE(i) | WEATHER_HEDGE_DONE(i));
+    lane->first_byte_ms = 0;
+    lane->start = xTaskGetTickCount();
+    weather_hedge_count(&weather_hedge_stats[provider].requests);
+    (void)xTaskNotifyGive(lane->task);
+
+    return (int32_t)i;
+}
+
+/*******************************************************************************
+ * Function Name: weather_hedge_init
+ *******************************************************************************
+ * Summary:
+ *  Creates the lane tasks. Call once, from the task that calls
+ *  weather_hedge_run().
+ *
+ * Parameters:
+ *  ops: how to prepare and run a request; must stay valid
+ *
+ * Return:
+ *  cy_rslt_t: CY_RSLT_SUCCESS, or CY_RSLT_TYPE_ERROR if out of memory
+ *
+ *******************************************************************************/
+cy_rslt_t weather_hedge_init(const weather_hedge_ops_t *ops)
+{
+    weather_hedge_ops = ops;
+    weather_hedge_preferred = (weather_provider_id_t)0;
+    (void)memset(weather_hedge_lanes, 0, sizeof(weather_hedge_lanes));
+    (void)memset(weather_hedge_stats, 0, sizeof(weather_hedge_stats));
+
+    weather_hedge_events = xEventGroupCreate();
+    if (NULL == weather_hedge_events)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+
+    for (uint32_t i = 0; i < WEATHER_HEDGE_LANES; i++)
+    {
+        if (pdPASS != xTaskCreate(weather_hedge_lane_task, "Weather lane", WEATHER_HEDGE_LANE_STACK_SIZE,
+                                  &weather_hedge_lanes[i], WEATHER_HEDGE_LANE_PRIORITY,
+                                  &weather_hedge_lanes[i].task))
+        {
+            return CY_RSLT_TYPE_ERROR;
+        }
+    }
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+ * Function Name: weather_hedge_delay_ms
+ *******************************************************************************
+ * Summary:
+ *  How long a request to the provider may go without a first byte before a
+ *  second provider is asked: the 95th percentile of its recent first-byte
+ *  times, within WEATHER_HEDGE_MIN_MS and the transport timeout.
+ *
+ *******************************************************************************/
+uint32_t weather_hedge_delay_ms(weather_provider_id_t provider)
+{
+    const weather_hedge_stats_t *stats = &weather_hedge_stats[provider];
+    uint16_t sorted[WEATHER_HEDGE_SAMPLES];
+    uint32_t count;
+    uint32_t p95;
+
+    taskENTER_CRITICAL();
+    count = stats->samples;
+    (void)memcpy(sorted, stats->first_byte_ms, sizeof(sorted));
+    taskEXIT_CRITICAL();
+
+    if (count < WEATHER_HEDGE_MIN_SAMPLES)
+    {
+        return WEATHER_HEDGE_DEFAULT_MS;
+    }
+
+    /* Insertion sort of at most WEATHER_HEDGE_SAMPLES values. */
+    for (uint32_t i = 1; i < count; i++)
+    {
+        uint16_t v = sorted[i];
+        uint32_t j = i;
+
+        for (; (j > 0U) && (sorted[j - 1U] > v); j--)
+        {
+            sorted[j] = sorted[j - 1U];
+        }
+        sorted[j] = v;
+    }
+
+    /* Nearest-rank percentile. */
+    p95 = sorted[((count * 95U) + 99U) / 100U - 1U];
+
+    if (p95 < WEATHER_HEDGE_MIN_MS)
+    {
+        return WEATHER_HEDGE_MIN_MS;
+    }
+    return (p95 > WEATHER_HEDGE_MAX_MS) ? WEATHER_HEDGE_MAX_MS : p95;
+}
+
+/*******************************************************************************
+ * Function Name: weather_hedge_run
+ *******************************************************************************
+ * Summary:
+ *  Fetches the weather from the preferred provider, adding the next provider
+ *  when the first is slower than its hedge delay or fails, and returns the
+ *  first good answer. The winning lane keeps its response untouched until the
+ *  next call; a losing lane may still be running then, in which case that
+ *  call makes do with the lanes that are free and leaves the loser's provider
+ *  alone, starting with the next provider if it was the preferred one.
+ *
+ * Parameters:
+ *  lane: set to the lane holding the answer
+ *  provider: set to the provider that gave it
+ *
+ * Return:
+ *  fetch_outcome_t: FETCH_OK with lane and provider set; otherwise
+ *  FETCH_RETRY if any attempt was worth retrying, FETCH_FATAL if none was
+ *
+ *******************************************************************************/
+fetch_outcome_t weather_hedge_run(uint32_t *lane, weather_provider_id_t *provider)
+{
+    weather_provider_id_t first = weather_hedge_preferred;
+    weather_provider_id_t next = first;
+    fetch_outcome_t result = FETCH_FATAL;
+    TickType_t deadline = xTaskGetTickCount() + pdMS_TO_TICKS(WEATHER_HEDGE_WAIT_MS);
+    EventBits_t pending = 0;    /* DONE bits of the lanes this call started */
+    EventBits_t bits;
+    uint32_t delay_ms;
+    uint32_t tried = 0;
+    int32_t id;
+
+    /* A provider still held by a lane of an earlier call counts as tried. */
+    do
+    {
+        first = next;
+        id = weather_hedge_launch(next);
+        next = (weather_provider_id_t)((next + 1U) % WEATHER_PROVIDER_COUNT);
+        tried++;
+    } while ((id < 0) && (tried < WEATHER_PROVIDER_COUNT));
+    if (id < 0)
+    {
+        ERR_INFO(("No weather lane free\n"));
+        return FETCH_RETRY;
+    }
+    pending |= WEATHER_HEDGE_DONE(id);
+    delay_ms = weather_hedge_delay_ms(first);
+
+    /* The lane also sets FIRST_BYTE when it ends, so a quick failure does not
+     * sit out the delay. */
+    bits = xEventGroupWaitBits(weather_hedge_events, WEATHER_HEDGE_FIRST_BYTE(id), pdFALSE, pdFALSE,
+                               pdMS_TO_TICKS(delay_ms));
+    if ((0U == (bits & WEATHER_HEDGE_FIRST_BYTE(id))) && (tried < WEATHER_PROVIDER_COUNT))
+    {
+        id = weather_hedge_launch(next);
+        if (id >= 0)
+        {
+            printf("%s silent for %lu ms, asking %s as well\n", weather_providers[first].name,
+                   (unsigned long)delay_ms, weather_providers[next].name);
+            weather_hedge_count(&weather_hedge_stats[next].hedges);
+            pending |= WEATHER_HEDGE_DONE(id);
+            next = (weather_provider_id_t)((next + 1U) % WEATHER_PROVIDER_COUNT);
+            tried++;
+        }
+    }
+
+    while (0U != pending)
+    {
+        TickType_t now = xTaskGetTickCount();
+
+        bits = 0;
+        if ((int32_t)(deadline - now) > 0)
+        {
+            bits = xEventGroupWaitBits(weather_hedge_events, pending, pdTRUE, pdFALSE, deadline - now);
+            bits &= pending;
+        }
+        if (0U == bits)
+        {
+            ERR_INFO(("No weather provider answered in %u ms\n", (unsigned int)WEATHER_HEDGE_WAIT_MS));
+            return FETCH_RETRY;
+        }
+
+        for (uint32_t i = 0; i < WEATHER_HEDGE_LANES; i++)
+        {
+            weather_provider_id_t asked = weather_hedge_lanes[i].provider;
+            fetch_outcome_t outcome = weather_hedge_lanes[i].outcome;
+
+            if (0U == (bits & WEATHER_HEDGE_DONE(i)))
+            {
+                continue;
+            }
+            pending &= ~WEATHER_HEDGE_DONE(i);
+
+            if (FETCH_OK == outcome)
+            {
+                weather_hedge_count(&weather_hedge_stats[asked].wins);
+                weather_hedge_preferred = asked;
+                *lane = i;
+                *provider = asked;
+                return FETCH_OK;
+            }
+
+            if (FETCH_RETRY == outcome)
+            {
+                result = FETCH_RETRY;
+            }
+
+            /* Fail over to a provider not asked yet. The lane just freed may
+             * be the one that takes it. */
+            if (tried < WEATHER_PROVIDER_COUNT)
+            {
+                id = weather_hedge_launch(next);
+                if (id >= 0)
+                {
+                    printf("%s failed, asking %s\n", weather_providers[asked].name,
+                           weather_providers[next].name);
+                    weather_hedge_count(&weather_hedge_stats[next].failovers);
+                    pending |= WEATHER_HEDGE_DONE(id);
+                    next = (weather_provider_id_t)((next + 1U) % WEATHER_PROVIDER_COUNT);
+                    tried++;
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+ * Function Name: weather_hedge_first_byte
+ *******************************************************************************
+ * Summary:
+ *  Marks the start of the response of the request running in the calling
+ *  lane. Does nothing when called from any other task.
+ *
+ *******************************************************************************/
+void weather_hedge_first_byte(void)
+{
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+
+    for (uint32_t i = 0; i < WEATHER_HEDGE_LANES; i++)
+    {
+        weather_hedge_lane_t *lane = &weather_hedge_lanes[i];
+
+        if ((self == lane->task) && (0U == lane->first_byte_ms))
+        {
+            uint32_t elapsed_ms = (uint32_t)((xTaskGetTickCount() - lane->start) * portTICK_PERIOD_MS);
+
+            lane->first_byte_ms = (0U != elapsed_ms) ? elapsed_ms : 1U;
+            (void)xEventGroupSetBits(weather_hedge_events, WEATHER_HEDGE_FIRST_BYTE(i));
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function Name: weather_hedge_print_stats
+ *******************************************************************************
+ * Summary:
+ *  Prints per provider how often it was asked and used, why it was asked and
+ *  its current hedge delay.
+ *
+ *******************************************************************************/
+void weather_hedge_print_stats(void)
+{
+    for (uint32_t i = 0; i < WEATHER_PROVIDER_COUNT; i++)
+    {
+        weather_hedge_stats_t s;
+
+        taskENTER_CRITICAL();
+        s = weather_hedge_stats[i];
+        taskEXIT_CRITICAL();
+
+        printf("%s: %lu requests, %lu used, %lu hedged, %lu failover, %lu failed, hedge after %lu ms\n",
+               weather_providers[i].name, (unsigned long)s.requests, (unsigned long)s.wins,
+               (unsigned long)s.hedges, (unsigned long)s.failovers, (unsigned long)s.failures,
+               (unsigned long)weather_hedge_delay_ms((weather_provider_id_t)i));
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,120 @@
+/******************************************************************************
+*
+* File Name: weather_hedge.h
+*
+* Description: This file contains the hedged weather request. The
+* preferred provider is asked first; if it has not sent the first
+* byte of its answer within the 95th percentile of its recent
+* first-byte times, or fails, the next provider is asked as well, on
+* a second lane, and whichever answers first is used.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef WEATHER_HEDGE_H_
+#define WEATHER_HEDGE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "cy_result.h"
+#include "fetch_cycle.h"
+#include "weather_provider.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Requests that can be in flight at once, each in its own task. */
+#define WEATHER_HEDGE_LANES                      (2U)
+
+/* First-byte times kept per provider for the percentile. */
+#define WEATHER_HEDGE_SAMPLES                    (16U)
+
+/* Until a provider has this many samples, WEATHER_HEDGE_DEFAULT_MS is used. */
+#define WEATHER_HEDGE_MIN_SAMPLES                (4U)
+#define WEATHER_HEDGE_DEFAULT_MS                 (1500U)
+
+/* Shortest hedge delay; the longest is the transport timeout. */
+#define WEATHER_HEDGE_MIN_MS                     (200U)
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+/* The caller's side of a hedged request. */
+typedef struct
+{
+    /* Runs in the task of weather_hedge_run() before a lane starts on a
+     * provider; anything shared with that task is read here. */
+    void (*prepare)(uint32_t lane, weather_provider_id_t provider);
+
+    /* Runs in the lane's task: sends the request and takes in the answer.
+     * Calls weather_hedge_first_byte() when the response starts. */
+    fetch_outcome_t (*fetch)(uint32_t lane, weather_provider_id_t provider);
+} weather_hedge_ops_t;
+
+typedef struct
+{
+    uint32_t requests;          /* lanes started on the provider */
+    uint32_t wins;              /* answers that were used */
+    uint32_t hedges;            /* started because another was slow */
+    uint32_t failovers;         /* started because another failed */
+    uint32_t failures;
+    uint16_t first_byte_ms[WEATHER_HEDGE_SAMPLES];  /* ring of recent samples */
+    uint8_t samples;
+    uint8_t next;
+} weather_hedge_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+cy_rslt_t weather_hedge_init(const weather_hedge_ops_t *ops);
+fetch_outcome_t weather_hedge_run(uint32_t *lane, weather_provider_id_t *provider);
+void weather_hedge_first_byte(void);
+uint32_t weather_hedge_delay_ms(weather_provider_id_t provider);
+void weather_hedge_print_stats(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* WEATHER_HEDGE_H_ */
+
+/* [] END OF FILE */
@@ -0,0 +1,175 @@
+/******************************************************************************
+*
+* File Name: weather_provider.c
+*
+* Description: This file contains the weather data providers: Open-Meteo,
+* which the dashboard was built around, and wttr.in as a second
+* source whose answers are mapped onto the Open-Meteo fields.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* Header file includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include "weather_provider.h"
+#include "secure_http_client.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Fields taken from the "current" object of the Open-Meteo response.
+ * "current_units" has the same keys and is skipped. */
+static const json_field_t open_meteo_schema[JSON_KEY_COUNT] =
+{
+    [JSON_KEY_TEMPERATURE_2M]       = { JSON_FIELD_TEXT, JSON_KEY_CURRENT, offsetof(weather_state_t, temperature),
+                                        WEATHER_TEXT_LEN, 0 },
+    [JSON_KEY_RELATIVE_HUMIDITY_2M] = { JSON_FIELD_TEXT, JSON_KEY_CURRENT, offsetof(weather_state_t, humidity),
+                                        WEATHER_TEXT_LEN, 0 },
+    [JSON_KEY_WIND_SPEED_10M]       = { JSON_FIELD_TEXT, JSON_KEY_CURRENT, offsetof(weather_state_t, windspeed),
+                                        WEATHER_TEXT_LEN, 0 },
+    [JSON_KEY_WEATHER_CODE]         = { JSON_FIELD_INT32, JSON_KEY_CURRENT, offsetof(weather_state_t, weather_code),
+                                        sizeof(int32_t), 0 },
+    [JSON_KEY_TIME]                 = { JSON_FIELD_TEXT, JSON_KEY_CURRENT, offsetof(weather_state_t, observed),
+                                        WEATHER_TIME_LEN, 0 },
+    [JSON_KEY_INTERVAL]             = { JSON_FIELD_INT32, JSON_KEY_CURRENT, offsetof(weather_state_t, interval),
+                                        sizeof(int32_t), 0 },
+};
+
+/* Fields taken from the one element of "current_condition" in the wttr.in
+ * j1 response. The hourly forecasts use other keys or sit under "hourly".
+ * Its observation time is local, not UTC, so observed stays empty and the
+ * poll scheduler falls back to the cache headers. */
+static const json_field_t wttr_schema[JSON_KEY_COUNT] =
+{
+    [JSON_KEY_TEMP_C]          = { JSON_FIELD_TEXT, JSON_KEY_CURRENT_CONDITION, offsetof(weather_state_t, temperature),
+                                   WEATHER_TEXT_LEN, 0 },
+    [JSON_KEY_HUMIDITY]        = { JSON_FIELD_TEXT, JSON_KEY_CURRENT_CONDITION, offsetof(weather_state_t, humidity),
+                                   WEATHER_TEXT_LEN, 0 },
+    [JSON_KEY_WINDSPEED_KMPH]  = { JSON_FIELD_TEXT, JSON_KEY_CURRENT_CONDITION, offsetof(weather_state_t, windspeed),
+                                   WEATHER_TEXT_LEN, 0 },
+    [JSON_KEY_WEATHERCODE]     = { JSON_FIELD_INT32, JSON_KEY_CURRENT_CONDITION, offsetof(weather_state_t, weather_code),
+                                   sizeof(int32_t), 0 },
+};
+
+/* wttr.in (WorldWeatherOnline) condition codes and the nearest WMO code. */
+static const uint16_t wttr_wmo_codes[][2] =
+{
+    { 113,  0 }, { 116,  2 }, { 119,  3 }, { 122,  3 }, { 143, 45 }, { 176, 80 },
+    { 179, 85 }, { 182, 66 }, { 185, 56 }, { 200, 95 }, { 227, 75 }, { 230, 75 },
+    { 248, 45 }, { 260, 48 }, { 263, 51 }, { 266, 53 }, { 281, 56 }, { 284, 57 },
+    { 293, 61 }, { 296, 61 }, { 299, 63 }, { 302, 63 }, { 305, 65 }, { 308, 65 },
+    { 311, 66 }, { 314, 67 }, { 317, 66 }, { 320, 67 }, { 323, 71 }, { 326, 71 },
+    { 329, 73 }, { 332, 73 }, { 335, 75 }, { 338, 75 }, { 350, 77 }, { 353, 80 },
+    { 356, 81 }, { 359, 82 }, { 362, 80 }, { 365, 81 }, { 368, 85 }, { 371, 86 },
+    { 374, 77 }, { 377, 77 }, { 386, 95 }, { 389, 95 }, { 392, 95 }, { 395, 95 },
+};
+
+/*******************************************************************************
+ * Function Name: open_meteo_build_path
+ *******************************************************************************
+ * Summary:
+ *  Current temperature, humidity, wind speed and weather code for the
+ *  location.
+ *
+ *******************************************************************************/
+static void open_meteo_build_path(char *path, size_t size, const geo_cache_entry_t *location)
+{
+    snprintf(path, size,
+             "/v1/forecast?latitude=%s&longitude=%s&models=ukmo_seamless&current=temperature_2m,relative_humidity_2m,wind_speed_10m,weather_code",
+             location->latitude, location->longitude);
+}
+
+/*******************************************************************************
+ * Function Name: wttr_build_path
+ *******************************************************************************
+ * Summary:
+ *  Conditions and forecast for the location in the j1 JSON format, which
+ *  carries metric and imperial values side by side.
+ *
+ *******************************************************************************/
+static void wttr_build_path(char *path, size_t size, const geo_cache_entry_t *location)
+{
+    snprintf(path, size, "/%s,%s?format=j1", location->latitude, location->longitude);
+}
+
+/*******************************************************************************
+ * Function Name: wttr_map
+ *******************************************************************************
+ * Summary:
+ *  Replaces the wttr.in condition code with its WMO equivalent. A code not in
+ *  the table becomes 0, clear sky.
+ *
+ *******************************************************************************/
+static void wttr_map(weather_state_t *state)
+{
+    int32_t code = state->weather_code;
+
+    state->weather_code = 0;
+    for (uint32_t i = 0; i < (sizeof(wttr_wmo_codes) / sizeof(wttr_wmo_codes[0])); i++)
+    {
+        if (code == (int32_t)wttr_wmo_codes[i][0])
+        {
+            state->weather_code = (int32_t)wttr_wmo_codes[i][1];
+            break;
+        }
+    }
+}
+
+/* Indexed by weather_provider_id_t. Open-Meteo is asked first until another
+ * provider answers sooner. */
+const weather_provider_t weather_providers[WEATHER_PROVIDER_COUNT] =
+{
+    [WEATHER_PROVIDER_OPEN_METEO] =
+    {
+        .name = "Open-Meteo",
+        .host = WEATHER_SERVER_HOST,
+        .port = WEATHER_PORT,
+        .build_path = open_meteo_build_path,
+        .schema = open_meteo_schema,
+        .map = NULL,
+    },
+    [WEATHER_PROVIDER_WTTR] =
+    {
+        .name = "wttr.in",
+        .host = WEATHER_ALT_SERVER_HOST,
+        .port = WEATHER_ALT_PORT,
+        .build_path = wttr_build_path,
+        .schema = wttr_schema,
+        .map = wttr_map,
+    },
+};
+
+/* [] END OF FILE */
@@ -0,0 +1,96 @@
+/******************************************************************************
+*
+* File Name: weather_provider.h
+*
+* Description: This file contains the weather data providers. Each one
+* describes the server to ask, how to build the request path for a
+* location, which fields of its response body to extract and how to
+* bring them to the units and codes the dashboard expects.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Include guard
+*******************************************************************************/
+#ifndef WEATHER_PROVIDER_H_
+#define WEATHER_PROVIDER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "geo_cache.h"
+#include "json_extract.h"
+#include "weather_state.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define WEATHER_PROVIDER_PATH_LEN                (256U)
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+typedef enum
+{
+    WEATHER_PROVIDER_OPEN_METEO,
+    WEATHER_PROVIDER_WTTR,
+    WEATHER_PROVIDER_COUNT
+} weather_provider_id_t;
+
+typedef struct
+{
+    const char *name;
+    const char *host;
+    uint16_t port;
+
+    /* Writes the resource path, query included, for a location. */
+    void (*build_path)(char *path, size_t size, const geo_cache_entry_t *location);
+
+    /* Fields of the response body, written into a weather_state_t. */
+    const json_field_t *schema;
+
+    /* Rewrites the extracted fields in the Open-Meteo conventions: degrees
+     * Celsius, percent, km/h and WMO weather codes. NULL if they already are. */
+    void (*map)(weather_state_t *state);
+} weather_provider_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern const weather_provider_t weather_providers[WEATHER_PROVIDER_COUNT];
+
+#endif /* WEATHER_PROVIDER_H_ */
+
+/* [] END OF FILE */
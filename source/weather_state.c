@@ -0,0 +1,124 @@
+/******************************************************************************
+*
+* File Name: weather_state.c
+*
+* Description: This file contains the exchange of weather and time snapshots
+* between the HTTPS task (single producer) and the TFT task (single consumer).
+* It is a triple buffer: the producer fills a private slot and swaps it with
+* the shared middle slot in one atomic exchange, and the consumer swaps the
+* middle slot with its own when a newer one is there. Neither side ever waits
+* for the other, whatever their priorities, and the consumer always sees a
+* complete snapshot.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdatomic.h>
+#include <string.h>
+#include "weather_state.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SLOT_COUNT              (3u)
+#define SLOT_INDEX_MASK         (0x3u)
+
+/* Set in the middle slot index when it holds a snapshot the consumer has
+ * not taken yet. */
+#define SLOT_FRESH              (0x4u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static weather_state_t slots[SLOT_COUNT];
+
+static atomic_uint middle = 2u;
+static uint32_t back = 1u;      /* owned by the producer */
+static uint32_t front = 0u;     /* owned by the consumer */
+
+static uint32_t sequence;       /* producer side */
+
+/*******************************************************************************
+* Function Name: void weather_state_publish(const weather_state_t *state)
+********************************************************************************
+*
+* Summary: Publishes a complete snapshot. Only the HTTPS task may call this.
+*          state->sequence is ignored and replaced by the publish count.
+*
+*******************************************************************************/
+void weather_state_publish(const weather_state_t *state)
+{
+    memcpy(&slots[back], state, sizeof(slots[back]));
+    slots[back].sequence = ++sequence;
+
+    /* memory_order_acq_rel: the slot contents are visible before the index,
+     * and the slot we get back is no longer read by the consumer. */
+    back = atomic_exchange_explicit(&middle, back | SLOT_FRESH,
+                                    memory_order_acq_rel) & SLOT_INDEX_MASK;
+}
+
+/*******************************************************************************
+* Function Name: bool weather_state_acquire(const weather_state_t **state)
+********************************************************************************
+*
+* Summary: Returns the most recent snapshot. Only the TFT task may call this.
+*          The pointer stays valid until the next call.
+*
+* Parameters:
+*  state: receives the snapshot; all-zero until the first publish
+*
+* Return:
+*  true if the snapshot is newer than the one returned by the previous call
+*
+*******************************************************************************/
+bool weather_state_acquire(const weather_state_t **state)
+{
+    bool fresh = false;
+
+    if(0u != (atomic_load_explicit(&middle, memory_order_relaxed) & SLOT_FRESH))
+    {
+        front = atomic_exchange_explicit(&middle, front,
+                                         memory_order_acq_rel) & SLOT_INDEX_MASK;
+        fresh = true;
+    }
+
+    *state = &slots[front];
+    return fresh;
+}
+
+/* [] END OF FILE */
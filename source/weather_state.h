@@ -0,0 +1,101 @@
+/******************************************************************************
+*
+* File Name: weather_state.h
+*
+* Description: This file is the public interface of weather_state.c source file
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Include guard
+ ******************************************************************************/
+#ifndef WEATHER_STATE_H_
+#define WEATHER_STATE_H_
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+
+/*******************************************************************************
+* Global constants
+*******************************************************************************/
+#define WEATHER_TEXT_LEN            (16u)
+#define WEATHER_CITY_LEN            (64u)   /* UTF-8, room for long city names */
+#define WEATHER_TIMEZONE_LEN        (32u)
+#define WEATHER_DATE_LEN            (32u)
+#define WEATHER_TIME_LEN            (20u)
+
+/*******************************************************************************
+ * Data structure and enumeration
+ ******************************************************************************/
+/* Everything one fetch cycle produces for the display. Text fields hold the
+ * values as they appear in the JSON; empty means not known yet. */
+typedef struct
+{
+    uint32_t sequence;                      /* bumped on every publish */
+
+    char city[WEATHER_CITY_LEN];
+    char timezone[WEATHER_TIMEZONE_LEN];
+
+    char temperature[WEATHER_TEXT_LEN];
+    char humidity[WEATHER_TEXT_LEN];
+    char windspeed[WEATHER_TEXT_LEN];
+    int32_t weather_code;
+    char observed[WEATHER_TIME_LEN];        /* "current" time, ISO 8601 (GMT) */
+    int32_t interval;                       /* seconds between "current" updates */
+
+    char date[WEATHER_DATE_LEN];            /* HTTP Date header value (GMT) */
+} weather_state_t;
+
+/*******************************************************************************
+ * Function prototype
+ ******************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void weather_state_publish(const weather_state_t *state);
+bool weather_state_acquire(const weather_state_t **state);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* WEATHER_STATE_H_ */
+
+/* [] END OF FILE */
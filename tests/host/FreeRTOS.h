@@ -0,0 +1,27 @@
+/* Host stand-in for the FreeRTOS types and macros the tested modules use.
+ * One tick is one millisecond, as in FreeRTOSConfig.h on the board. */
+#ifndef HOST_FREERTOS_H_
+#define HOST_FREERTOS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void *TaskHandle_t;
+typedef void *SemaphoreHandle_t;
+
+#define pdPASS                  (1)
+#define pdFAIL                  (0)
+#define pdTRUE                  (1)
+#define pdFALSE                 (0)
+#define portMAX_DELAY           ((TickType_t)0xFFFFFFFFUL)
+#define portTICK_PERIOD_MS      (1U)
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(ms))
+#define configMAX_PRIORITIES    (7)
+#define configTICK_RATE_HZ      (1000U)
+
+#define CY_UNUSED_PARAMETER(x)  ((void)(x))
+
+#endif /* HOST_FREERTOS_H_ */
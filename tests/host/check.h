@@ -0,0 +1,34 @@
+/* Assertion macro shared by the host tests. Each test that includes it gets
+ * its own failure and check counters. */
+#ifndef HOST_CHECK_H_
+#define HOST_CHECK_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+/* Failures printed before the rest are only counted, so a broken walk over
+ * millions of values does not flood the log. */
+#define CHECK_PRINT_MAX         (20u)
+
+static uint32_t failures;       /* CHECK()s that failed */
+static uint32_t checks;         /* CHECK()s evaluated */
+
+/* Counts cond; when it is false, counts a failure and prints the printf-style
+ * message after the file and line. */
+#define CHECK(cond, ...)                                                    \
+    do                                                                      \
+    {                                                                       \
+        checks++;                                                           \
+        if (!(cond))                                                        \
+        {                                                                   \
+            if (failures < CHECK_PRINT_MAX)                                 \
+            {                                                               \
+                printf("FAIL %s:%d: ", __FILE__, __LINE__);                 \
+                printf(__VA_ARGS__);                                        \
+                printf("\n");                                               \
+            }                                                               \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+#endif /* HOST_CHECK_H_ */
@@ -0,0 +1,48 @@
+/* Host stand-in for the HTTP client types; the tests provide
+ * http_conn_pool_send() in place of the client itself. */
+#ifndef HOST_CY_HTTP_CLIENT_API_H_
+#define HOST_CY_HTTP_CLIENT_API_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "cy_result.h"
+
+typedef enum
+{
+    CY_HTTP_CLIENT_METHOD_GET,
+    CY_HTTP_CLIENT_METHOD_HEAD
+} cy_http_client_method_t;
+
+typedef struct
+{
+    uint8_t *buffer;
+    size_t buffer_len;
+    size_t headers_len;
+    cy_http_client_method_t method;
+    int32_t range_start;
+    int32_t range_end;
+    const char *resource_path;
+} cy_http_client_request_header_t;
+
+typedef struct
+{
+    char *field;
+    size_t field_len;
+    char *value;
+    size_t value_len;
+} cy_http_client_header_t;
+
+typedef struct
+{
+    uint16_t status_code;
+    uint8_t *header;
+    size_t headers_len;
+    uint8_t *buffer;
+    size_t buffer_len;
+    uint32_t header_count;
+    uint8_t *body;
+    size_t body_len;
+    size_t content_len;
+} cy_http_client_response_t;
+
+#endif /* HOST_CY_HTTP_CLIENT_API_H_ */
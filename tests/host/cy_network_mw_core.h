@@ -0,0 +1,6 @@
+/* Host stand-in: included by secure_http_client.h for the board build;
+ * the tested modules use nothing from it. */
+#ifndef HOST_CY_NETWORK_MW_CORE_H_
+#define HOST_CY_NETWORK_MW_CORE_H_
+
+#endif /* HOST_CY_NETWORK_MW_CORE_H_ */
@@ -0,0 +1,12 @@
+/* Host stand-in for the ModusToolbox result type. */
+#ifndef HOST_CY_RESULT_H_
+#define HOST_CY_RESULT_H_
+
+#include <stdint.h>
+
+typedef uint32_t cy_rslt_t;
+
+#define CY_RSLT_SUCCESS         ((cy_rslt_t)0x00000000U)
+#define CY_RSLT_TYPE_ERROR      (0x2U)
+
+#endif /* HOST_CY_RESULT_H_ */
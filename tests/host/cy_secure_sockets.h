@@ -0,0 +1,53 @@
+/* Host stand-in for the UDP part of the secure sockets API, on BSD sockets;
+ * see host_port.c. */
+#ifndef HOST_CY_SECURE_SOCKETS_H_
+#define HOST_CY_SECURE_SOCKETS_H_
+
+#include <stdint.h>
+#include "cy_result.h"
+
+typedef void *cy_socket_t;
+
+typedef enum
+{
+    CY_SOCKET_IP_VER_V4 = 4,
+    CY_SOCKET_IP_VER_V6 = 6
+} cy_socket_ip_version_t;
+
+typedef struct
+{
+    cy_socket_ip_version_t version;
+    union
+    {
+        uint32_t v4;
+        uint32_t v6[4];
+    } ip;
+} cy_socket_ip_address_t;
+
+typedef struct
+{
+    uint16_t port;
+    cy_socket_ip_address_t ip_address;
+} cy_socket_sockaddr_t;
+
+#define CY_SOCKET_DOMAIN_AF_INET    (2)
+#define CY_SOCKET_TYPE_DGRAM        (2)
+#define CY_SOCKET_IPPROTO_UDP       (17)
+#define CY_SOCKET_SOL_SOCKET        (1)
+#define CY_SOCKET_SO_RCVTIMEO       (0)
+#define CY_SOCKET_FLAGS_NONE        (0)
+
+cy_rslt_t cy_socket_gethostbyname(const char *hostname, cy_socket_ip_version_t ip_ver,
+                                  cy_socket_ip_address_t *addr);
+cy_rslt_t cy_socket_create(int domain, int type, int protocol, cy_socket_t *handle);
+cy_rslt_t cy_socket_setsockopt(cy_socket_t handle, int level, int optname, const void *optval,
+                               uint32_t optlen);
+cy_rslt_t cy_socket_sendto(cy_socket_t handle, const void *buffer, uint32_t length, int flags,
+                           const cy_socket_sockaddr_t *dest_addr, uint32_t address_length,
+                           uint32_t *bytes_sent);
+cy_rslt_t cy_socket_recvfrom(cy_socket_t handle, void *buffer, uint32_t length, int flags,
+                             cy_socket_sockaddr_t *src_addr, uint32_t *src_addr_length,
+                             uint32_t *bytes_received);
+cy_rslt_t cy_socket_delete(cy_socket_t handle);
+
+#endif /* HOST_CY_SECURE_SOCKETS_H_ */
@@ -0,0 +1,6 @@
+/* Host stand-in: included by secure_http_client.h for the board build;
+ * the tested modules use nothing from it. */
+#ifndef HOST_CYBSP_H_
+#define HOST_CYBSP_H_
+
+#endif /* HOST_CYBSP_H_ */
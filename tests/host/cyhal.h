@@ -0,0 +1,20 @@
+/* Host stand-in for the HAL RTC API. The test that links a module using it
+ * provides the functions, usually as a simulated RTC. */
+#ifndef HOST_CYHAL_H_
+#define HOST_CYHAL_H_
+
+#include <stdbool.h>
+#include <time.h>
+#include "cy_result.h"
+
+typedef struct
+{
+    int unused;
+} cyhal_rtc_t;
+
+cy_rslt_t cyhal_rtc_init(cyhal_rtc_t *obj);
+bool cyhal_rtc_is_enabled(cyhal_rtc_t *obj);
+cy_rslt_t cyhal_rtc_read(cyhal_rtc_t *obj, struct tm *date_time);
+cy_rslt_t cyhal_rtc_write(cyhal_rtc_t *obj, const struct tm *date_time);
+
+#endif /* HOST_CYHAL_H_ */
@@ -0,0 +1,16 @@
+/* Host stand-in for the FreeRTOS event group API; see host_port.c. */
+#ifndef HOST_EVENT_GROUPS_H_
+#define HOST_EVENT_GROUPS_H_
+
+#include "FreeRTOS.h"
+
+typedef uint32_t EventBits_t;
+typedef void *EventGroupHandle_t;
+
+EventGroupHandle_t xEventGroupCreate(void);
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits);
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits);
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clear,
+                                BaseType_t all, TickType_t wait);
+
+#endif /* HOST_EVENT_GROUPS_H_ */
@@ -0,0 +1,570 @@
+/******************************************************************************
+*
+* File Name: host_port.c
+*
+* Description: Host port of the FreeRTOS and secure sockets calls used by the
+* modules under test: the tick and delays run on CLOCK_MONOTONIC, optionally
+* off by a set rate, tasks are pthreads, semaphores and task notifications
+* are counting semaphores on a pthread condition variable, event groups are
+* bits on one, and UDP sockets are BSD sockets.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "event_groups.h"
+#include "cy_secure_sockets.h"
+#include "host_port.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+double host_tick_error;
+
+static pthread_mutex_t host_critical = PTHREAD_MUTEX_INITIALIZER;
+
+/*******************************************************************************
+ * Data structure and enumeration
+ ******************************************************************************/
+/* Counting semaphore. Mutexes and task notifications are built on it. */
+typedef struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint32_t count;
+    uint32_t max;
+} host_sem_t;
+
+typedef struct
+{
+    TaskFunction_t code;
+    void *arg;
+    host_sem_t notify;
+} host_task_t;
+
+typedef struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    EventBits_t bits;
+} host_event_group_t;
+
+/* Task the calling thread runs, for its notification value. */
+static __thread host_task_t *host_current_task;
+
+/*******************************************************************************
+* Function Name: host_monotonic_ms
+*******************************************************************************/
+double host_monotonic_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1000.0) + ((double)ts.tv_nsec / 1e6);
+}
+
+/*******************************************************************************
+* Function Name: xTaskGetTickCount
+*******************************************************************************/
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)(uint64_t)(host_monotonic_ms() * (1.0 + host_tick_error));
+}
+
+/*******************************************************************************
+* Function Name: vTaskDelay
+*******************************************************************************/
+void vTaskDelay(TickType_t ticks)
+{
+    double ms = (double)ticks / (1.0 + host_tick_error);
+    struct timespec ts = { (time_t)(ms / 1000.0), (long)(((uint64_t)(ms * 1e6)) % 1000000000ULL) };
+
+    while ((0 != nanosleep(&ts, &ts)) && (EINTR == errno))
+    {
+    }
+}
+
+/*******************************************************************************
+* Function Name: vTaskEnterCritical / vTaskExitCritical
+*******************************************************************************/
+void vTaskEnterCritical(void)
+{
+    pthread_mutex_lock(&host_critical);
+}
+
+void vTaskExitCritical(void)
+{
+    pthread_mutex_unlock(&host_critical);
+}
+
+/*******************************************************************************
+* Function Name: host_sem_init
+*******************************************************************************/
+static void host_sem_init(host_sem_t *sem, uint32_t count, uint32_t max)
+{
+    pthread_mutex_init(&sem->lock, NULL);
+    pthread_cond_init(&sem->cond, NULL);
+    sem->count = count;
+    sem->max = max;
+}
+
+/*******************************************************************************
+* Function Name: host_sem_create
+*******************************************************************************/
+static host_sem_t *host_sem_create(uint32_t count, uint32_t max)
+{
+    host_sem_t *sem = malloc(sizeof(*sem));
+
+    if (NULL != sem)
+    {
+        host_sem_init(sem, count, max);
+    }
+    return sem;
+}
+
+/*******************************************************************************
+* Function Name: host_sem_take
+*******************************************************************************
+* Summary:
+*  Waits up to wait ticks for the count to be non-zero, then takes one, or
+*  all of it if clear is set.
+*
+* Return:
+*  uint32_t: the count before it was taken; 0 on timeout
+*
+*******************************************************************************/
+static uint32_t host_sem_take(host_sem_t *sem, TickType_t wait, bool clear)
+{
+    struct timespec deadline;
+    uint32_t count;
+
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += (time_t)(wait / 1000U);
+    deadline.tv_nsec += (long)(wait % 1000U) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    pthread_mutex_lock(&sem->lock);
+    while (0U == sem->count)
+    {
+        if (portMAX_DELAY == wait)
+        {
+            pthread_cond_wait(&sem->cond, &sem->lock);
+        }
+        else if (ETIMEDOUT == pthread_cond_timedwait(&sem->cond, &sem->lock, &deadline))
+        {
+            break;
+        }
+    }
+    count = sem->count;
+    if (0U != count)
+    {
+        sem->count = clear ? 0U : (count - 1U);
+    }
+    pthread_mutex_unlock(&sem->lock);
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: host_sem_give
+*******************************************************************************/
+static bool host_sem_give(host_sem_t *sem)
+{
+    bool given;
+
+    pthread_mutex_lock(&sem->lock);
+    given = (sem->count < sem->max);
+    if (given)
+    {
+        sem->count++;
+        pthread_cond_signal(&sem->cond);
+    }
+    pthread_mutex_unlock(&sem->lock);
+
+    return given;
+}
+
+/*******************************************************************************
+* Function Name: host_task_entry
+*******************************************************************************/
+static void *host_task_entry(void *arg)
+{
+    host_current_task = (host_task_t *)arg;
+    host_current_task->code(host_current_task->arg);
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: xTaskCreate
+*******************************************************************************/
+BaseType_t xTaskCreate(TaskFunction_t code, const char *name, uint32_t stack_depth, void *arg,
+                       UBaseType_t priority, TaskHandle_t *handle)
+{
+    pthread_t thread;
+    host_task_t *task = malloc(sizeof(*task));
+
+    (void)name;
+    (void)stack_depth;
+    (void)priority;
+    if (NULL == task)
+    {
+        return pdFAIL;
+    }
+    task->code = code;
+    task->arg = arg;
+    host_sem_init(&task->notify, 0U, UINT32_MAX);
+    if (0 != pthread_create(&thread, NULL, host_task_entry, task))
+    {
+        free(task);
+        return pdFAIL;
+    }
+    pthread_detach(thread);
+    if (NULL != handle)
+    {
+        *handle = task;
+    }
+    return pdPASS;
+}
+
+/*******************************************************************************
+* Function Name: xTaskGetCurrentTaskHandle
+*******************************************************************************
+* Summary:
+*  NULL on the main thread, which was not started with xTaskCreate().
+*
+*******************************************************************************/
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return host_current_task;
+}
+
+/*******************************************************************************
+* Function Name: xTaskNotifyGive
+*******************************************************************************/
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    (void)host_sem_give(&((host_task_t *)task)->notify);
+    return pdPASS;
+}
+
+/*******************************************************************************
+* Function Name: ulTaskNotifyTake
+*******************************************************************************
+* Summary:
+*  Only for tasks started with xTaskCreate(); the main thread has no
+*  notification value.
+*
+*******************************************************************************/
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait)
+{
+    return host_sem_take(&host_current_task->notify, wait, pdFALSE != clear);
+}
+
+/*******************************************************************************
+* Function Name: xSemaphoreCreateMutex
+*******************************************************************************/
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return host_sem_create(1U, 1U);
+}
+
+/*******************************************************************************
+* Function Name: xSemaphoreTake
+*******************************************************************************/
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t wait)
+{
+    return (0U != host_sem_take((host_sem_t *)sem, wait, false)) ? pdTRUE : pdFALSE;
+}
+
+/*******************************************************************************
+* Function Name: xSemaphoreGive
+*******************************************************************************/
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    return host_sem_give((host_sem_t *)sem) ? pdTRUE : pdFALSE;
+}
+
+/*******************************************************************************
+* Function Name: xEventGroupCreate
+*******************************************************************************/
+EventGroupHandle_t xEventGroupCreate(void)
+{
+    host_event_group_t *group = malloc(sizeof(*group));
+
+    if (NULL != group)
+    {
+        pthread_mutex_init(&group->lock, NULL);
+        pthread_cond_init(&group->cond, NULL);
+        group->bits = 0U;
+    }
+    return group;
+}
+
+/*******************************************************************************
+* Function Name: xEventGroupSetBits
+*******************************************************************************/
+EventBits_t xEventGroupSetBits(EventGroupHandle_t handle, EventBits_t bits)
+{
+    host_event_group_t *group = (host_event_group_t *)handle;
+    EventBits_t value;
+
+    pthread_mutex_lock(&group->lock);
+    group->bits |= bits;
+    value = group->bits;
+    pthread_cond_broadcast(&group->cond);
+    pthread_mutex_unlock(&group->lock);
+
+    return value;
+}
+
+/*******************************************************************************
+* Function Name: xEventGroupClearBits
+*******************************************************************************/
+EventBits_t xEventGroupClearBits(EventGroupHandle_t handle, EventBits_t bits)
+{
+    host_event_group_t *group = (host_event_group_t *)handle;
+    EventBits_t value;
+
+    pthread_mutex_lock(&group->lock);
+    value = group->bits;
+    group->bits &= ~bits;
+    pthread_mutex_unlock(&group->lock);
+
+    return value;
+}
+
+/*******************************************************************************
+* Function Name: xEventGroupWaitBits
+*******************************************************************************
+* Summary:
+*  Waits up to wait ticks for any, or all, of bits to be set.
+*
+* Return:
+*  EventBits_t: the bits when the wait ended, before any were cleared
+*
+*******************************************************************************/
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t handle, EventBits_t bits, BaseType_t clear,
+                                BaseType_t all, TickType_t wait)
+{
+    host_event_group_t *group = (host_event_group_t *)handle;
+    struct timespec deadline;
+    EventBits_t value;
+    bool met;
+
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += (time_t)(wait / 1000U);
+    deadline.tv_nsec += (long)(wait % 1000U) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    pthread_mutex_lock(&group->lock);
+    for (;;)
+    {
+        met = (pdFALSE != all) ? ((group->bits & bits) == bits) : (0U != (group->bits & bits));
+        if (met)
+        {
+            break;
+        }
+        if (portMAX_DELAY == wait)
+        {
+            pthread_cond_wait(&group->cond, &group->lock);
+        }
+        else if (ETIMEDOUT == pthread_cond_timedwait(&group->cond, &group->lock, &deadline))
+        {
+            break;
+        }
+    }
+    value = group->bits;
+    if (met && (pdFALSE != clear))
+    {
+        group->bits &= ~bits;
+    }
+    pthread_mutex_unlock(&group->lock);
+
+    return value;
+}
+
+/*******************************************************************************
+* Function Name: cy_socket_gethostbyname
+*******************************************************************************/
+cy_rslt_t cy_socket_gethostbyname(const char *hostname, cy_socket_ip_version_t ip_ver,
+                                  cy_socket_ip_address_t *addr)
+{
+    struct addrinfo hints;
+    struct addrinfo *res;
+
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    if ((CY_SOCKET_IP_VER_V4 != ip_ver) || (0 != getaddrinfo(hostname, NULL, &hints, &res)))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+    addr->version = CY_SOCKET_IP_VER_V4;
+    addr->ip.v4 = ((struct sockaddr_in *)res->ai_addr)->sin_addr.s_addr;
+    freeaddrinfo(res);
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_socket_create
+*******************************************************************************/
+cy_rslt_t cy_socket_create(int domain, int type, int protocol, cy_socket_t *handle)
+{
+    int fd;
+
+    if ((CY_SOCKET_DOMAIN_AF_INET != domain) || (CY_SOCKET_TYPE_DGRAM != type) ||
+        (CY_SOCKET_IPPROTO_UDP != protocol))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+    fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (fd < 0)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+    *handle = (cy_socket_t)(intptr_t)fd;
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_socket_setsockopt
+*******************************************************************************/
+cy_rslt_t cy_socket_setsockopt(cy_socket_t handle, int level, int optname, const void *optval,
+                               uint32_t optlen)
+{
+    uint32_t ms;
+    struct timeval tv;
+
+    if ((CY_SOCKET_SOL_SOCKET != level) || (CY_SOCKET_SO_RCVTIMEO != optname) || (sizeof(ms) != optlen))
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+    memcpy(&ms, optval, sizeof(ms));
+    tv.tv_sec = (time_t)(ms / 1000U);
+    tv.tv_usec = (suseconds_t)((ms % 1000U) * 1000U);
+    return (0 == setsockopt((int)(intptr_t)handle, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv))) ?
+           CY_RSLT_SUCCESS : CY_RSLT_TYPE_ERROR;
+}
+
+/*******************************************************************************
+* Function Name: cy_socket_sendto
+*******************************************************************************/
+cy_rslt_t cy_socket_sendto(cy_socket_t handle, const void *buffer, uint32_t length, int flags,
+                           const cy_socket_sockaddr_t *dest_addr, uint32_t address_length,
+                           uint32_t *bytes_sent)
+{
+    struct sockaddr_in to;
+    ssize_t n;
+
+    (void)flags;
+    (void)address_length;
+    memset(&to, 0, sizeof(to));
+    to.sin_family = AF_INET;
+    to.sin_port = htons(dest_addr->port);
+    to.sin_addr.s_addr = dest_addr->ip_address.ip.v4;
+
+    n = sendto((int)(intptr_t)handle, buffer, length, 0, (struct sockaddr *)&to, sizeof(to));
+    if (n < 0)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+    *bytes_sent = (uint32_t)n;
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_socket_recvfrom
+*******************************************************************************/
+cy_rslt_t cy_socket_recvfrom(cy_socket_t handle, void *buffer, uint32_t length, int flags,
+                             cy_socket_sockaddr_t *src_addr, uint32_t *src_addr_length,
+                             uint32_t *bytes_received)
+{
+    struct sockaddr_in from;
+    socklen_t from_len = sizeof(from);
+    ssize_t n;
+
+    (void)flags;
+    n = recvfrom((int)(intptr_t)handle, buffer, length, 0, (struct sockaddr *)&from, &from_len);
+    if (n < 0)
+    {
+        return CY_RSLT_TYPE_ERROR;
+    }
+    if (NULL != src_addr)
+    {
+        src_addr->port = ntohs(from.sin_port);
+        src_addr->ip_address.version = CY_SOCKET_IP_VER_V4;
+        src_addr->ip_address.ip.v4 = from.sin_addr.s_addr;
+    }
+    if (NULL != src_addr_length)
+    {
+        *src_addr_length = sizeof(*src_addr);
+    }
+    *bytes_received = (uint32_t)n;
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_socket_delete
+*******************************************************************************/
+cy_rslt_t cy_socket_delete(cy_socket_t handle)
+{
+    close((int)(intptr_t)handle);
+    return CY_RSLT_SUCCESS;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,12 @@
+/* Host port of the RTOS and socket calls the tested modules make. */
+#ifndef HOST_PORT_H_
+#define HOST_PORT_H_
+
+/* Relative error of the tick against real time, e.g. 0.02 for a tick
+ * that runs 2% fast. Zero unless a test sets it. */
+extern double host_tick_error;
+
+/* Monotonic real time in ms, unaffected by host_tick_error. */
+double host_monotonic_ms(void);
+
+#endif /* HOST_PORT_H_ */
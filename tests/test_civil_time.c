@@ -0,0 +1,211 @@
+/******************************************************************************
+*
+* File Name: test_civil_time.c
+*
+* Description: Host test of the civil time conversions against libc. Every
+* day from 1970 to 2100 goes through days_from_civil, civil_from_days, the
+* weekday and the month lengths, and is formatted and parsed back as an HTTP
+* date and an ISO time; the epoch conversions and civil_time_advance() are
+* checked every 997 s across the whole range, which visits every second of
+* the day.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "civil_time.h"
+#include "check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Last second checked: 2100-12-31 23:59:59 UTC. */
+#define TEST_LAST_EPOCH         (4133980799UL)
+
+/* Prime, so the epoch walk lands on every second of the day. */
+#define TEST_EPOCH_STEP         (997UL)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Steps civil_time_advance() is tried with from each point of the walk. */
+static const uint32_t advance_steps[] =
+{
+    0u, 1u, 59u, 60u, 61u, 3599u, 3600u, 86399u, 86400u, 86401u,
+    31u * 86400u, (365u * 86400u) + 1u, (366u * 86400u) + 7u
+};
+
+/*******************************************************************************
+* Function Name: same
+********************************************************************************
+*
+* Summary: Compares a civil time with the struct tm libc gives.
+*
+*******************************************************************************/
+static bool same(const civil_time_t *c, const struct tm *g)
+{
+    return (c->year == (g->tm_year + 1900)) && (c->month == (g->tm_mon + 1)) &&
+           (c->day == g->tm_mday) && (c->hour == g->tm_hour) && (c->minute == g->tm_min) &&
+           (c->second == g->tm_sec) && (c->weekday == g->tm_wday);
+}
+
+/*******************************************************************************
+* Function Name: test_days
+********************************************************************************
+*
+* Summary: Every day of 1970..2100: day number both ways, weekday, month
+*          length, and the text formats parsed back.
+*
+*******************************************************************************/
+static void test_days(void)
+{
+    uint32_t last_day = (uint32_t)(TEST_LAST_EPOCH / CIVIL_SECONDS_PER_DAY);
+
+    for (uint32_t days = 0u; days <= last_day; days++)
+    {
+        time_t tt = (time_t)days * (time_t)CIVIL_SECONDS_PER_DAY;
+        struct tm g;
+        civil_time_t c;
+        char text[40];
+        uint32_t epoch;
+
+        gmtime_r(&tt, &g);
+        memset(&c, 0, sizeof(c));
+        civil_from_days(days, &c);
+
+        CHECK((c.year == (g.tm_year + 1900)) && (c.month == (g.tm_mon + 1)) && (c.day == g.tm_mday),
+              "civil_from_days(%u) = %04u-%02u-%02u", days, c.year, c.month, c.day);
+        CHECK(days == civil_days_from_civil((uint32_t)g.tm_year + 1900u, (uint32_t)g.tm_mon + 1u,
+                                            (uint32_t)g.tm_mday),
+              "civil_days_from_civil for day %u", days);
+        CHECK((uint32_t)g.tm_wday == civil_weekday(days), "civil_weekday(%u)", days);
+
+        /* On the 1st, the month ends where libc says the next one starts. */
+        if (1 == g.tm_mday)
+        {
+            struct tm next = g;
+            time_t end;
+
+            next.tm_mon++;
+            end = timegm(&next);
+            CHECK((uint32_t)((end - tt) / (time_t)CIVIL_SECONDS_PER_DAY) ==
+                  civil_days_in_month((uint32_t)g.tm_year + 1900u, (uint32_t)g.tm_mon + 1u),
+                  "civil_days_in_month(%d, %d)", g.tm_year + 1900, g.tm_mon + 1);
+        }
+
+        /* A different time of day each day, so the parsers see all of them
+         * over the run. */
+        tt += (time_t)(((uint64_t)days * 7919u) % CIVIL_SECONDS_PER_DAY);
+        gmtime_r(&tt, &g);
+
+        strftime(text, sizeof(text), "%a, %d %b %Y %H:%M:%S GMT", &g);
+        CHECK(civil_time_parse_http_date(text, &epoch) && (epoch == (uint32_t)tt),
+              "civil_time_parse_http_date(\"%s\")", text);
+
+        strftime(text, sizeof(text), "%Y-%m-%dT%H:%M:%S", &g);
+        CHECK(civil_time_parse_iso(text, &epoch) && (epoch == (uint32_t)tt),
+              "civil_time_parse_iso(\"%s\")", text);
+
+        strftime(text, sizeof(text), "%Y-%m-%dT%H:%M", &g);
+        CHECK(civil_time_parse_iso(text, &epoch) && (epoch == (uint32_t)(tt - g.tm_sec)),
+              "civil_time_parse_iso(\"%s\")", text);
+    }
+}
+
+/*******************************************************************************
+* Function Name: test_epochs
+********************************************************************************
+*
+* Summary: Epoch to civil time and back every TEST_EPOCH_STEP seconds, and
+*          civil_time_advance() from each of those points.
+*
+*******************************************************************************/
+static void test_epochs(void)
+{
+    for (uint64_t e = 0u; e <= TEST_LAST_EPOCH; e += TEST_EPOCH_STEP)
+    {
+        time_t tt = (time_t)e;
+        struct tm g;
+        civil_time_t c;
+
+        gmtime_r(&tt, &g);
+        civil_time_from_epoch((uint32_t)e, &c);
+
+        CHECK(same(&c, &g), "civil_time_from_epoch(%lu)", (unsigned long)e);
+        CHECK((uint32_t)e == civil_time_to_epoch(&c), "civil_time_to_epoch at %lu", (unsigned long)e);
+
+        for (uint32_t i = 0u; i < (sizeof(advance_steps) / sizeof(advance_steps[0])); i++)
+        {
+            civil_time_t a = c;
+            time_t later = tt + (time_t)advance_steps[i];
+
+            if ((uint64_t)later > TEST_LAST_EPOCH)
+            {
+                break;
+            }
+            civil_time_advance(&a, advance_steps[i]);
+            gmtime_r(&later, &g);
+            CHECK(same(&a, &g), "civil_time_advance(%lu, %u)", (unsigned long)e, advance_steps[i]);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: main
+*******************************************************************************/
+int main(void)
+{
+    uint32_t epoch;
+
+    test_days();
+    test_epochs();
+
+    /* Malformed values are refused. */
+    CHECK(!civil_time_parse_http_date("Mon, 30 Feb 2024 10:15:00 GMT", &epoch), "30 Feb accepted");
+    CHECK(!civil_time_parse_http_date("Mon, 22 Jxn 2024 10:15:00 GMT", &epoch), "Jxn accepted");
+    CHECK(!civil_time_parse_http_date("Mon, 22 Jan 2024 10:15:00", &epoch), "no GMT accepted");
+    CHECK(!civil_time_parse_iso("2024-13-22T10:15", &epoch), "month 13 accepted");
+    CHECK(!civil_time_parse_iso("2024-01-22T24:00", &epoch), "hour 24 accepted");
+
+    printf("1970-2100 checked against libc, %lu failures\n", (unsigned long)failures);
+    return (0u == failures) ? 0 : 1;
+}
+
+/* [] END OF FILE */
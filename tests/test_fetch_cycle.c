@@ -0,0 +1,285 @@
+/******************************************************************************
+*
+* File Name: test_fetch_cycle.c
+*
+* Description: Host test of the fetch cycle state machine. It runs cycles the
+* way fetch_https_client_method() does, on a simulated clock, and injects
+* transient and fatal failures into each step for every number of attempts up
+* to past its retry budget. It checks the retry waits, the outcome, the
+* counters, that the next cycle resumes at the failed step and that no wait
+* runs past the cycle deadline.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "fetch_cycle.h"
+#include "check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Simulated time one attempt takes, unless a test says otherwise. */
+#define ATTEMPT_MS              (300u)
+
+/*******************************************************************************
+ * Data structure and enumeration
+ ******************************************************************************/
+/* Faults to inject: the first `count` attempts at `step` give `outcome`. */
+typedef struct
+{
+    fetch_step_t step;
+    uint32_t count;
+    fetch_outcome_t outcome;
+} fault_t;
+
+/* What one cycle did. */
+typedef struct
+{
+    fetch_action_t action;
+    uint32_t runs[FETCH_STEP_COUNT];
+    uint32_t waits[8];
+    uint32_t wait_count;
+    uint32_t started_ms;
+    uint32_t ended_ms;
+} cycle_log_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const uint32_t budget[FETCH_STEP_COUNT] =
+{
+    [FETCH_STEP_GEO]     = FETCH_GEO_RETRIES,
+    [FETCH_STEP_WEATHER] = FETCH_WEATHER_RETRIES
+};
+
+/*******************************************************************************
+* Function Name: run_cycle
+********************************************************************************
+*
+* Summary: Runs one cycle as the HTTPS task does, with the faults injected
+*          at their step, and advances the simulated clock.
+*
+*******************************************************************************/
+static void run_cycle(fetch_cycle_t *cycle, uint32_t *now_ms, const fault_t *fault,
+                      uint32_t attempt_ms, cycle_log_t *log)
+{
+    fetch_action_t action = FETCH_ACTION_RUN;
+    uint32_t injected = 0u;
+
+    memset(log, 0, sizeof(*log));
+    log->started_ms = *now_ms;
+    fetch_cycle_begin(cycle, *now_ms);
+
+    while ((FETCH_ACTION_RUN == action) || (FETCH_ACTION_WAIT == action))
+    {
+        fetch_outcome_t outcome = FETCH_OK;
+
+        if (FETCH_ACTION_WAIT == action)
+        {
+            if (log->wait_count < (sizeof(log->waits) / sizeof(log->waits[0])))
+            {
+                log->waits[log->wait_count] = cycle->wait_ms;
+            }
+            log->wait_count++;
+            *now_ms += cycle->wait_ms;
+        }
+
+        log->runs[cycle->step]++;
+        *now_ms += attempt_ms;
+        if ((NULL != fault) && (fault->step == cycle->step) && (injected < fault->count))
+        {
+            injected++;
+            outcome = fault->outcome;
+        }
+
+        action = fetch_cycle_report(cycle, outcome, *now_ms);
+    }
+
+    log->action = action;
+    log->ended_ms = *now_ms;
+}
+
+/*******************************************************************************
+* Function Name: test_transient
+********************************************************************************
+*
+* Summary: Fails one step transiently k times, for every k up to one past
+*          its budget, then runs a clean cycle after it.
+*
+*******************************************************************************/
+static void test_transient(fetch_step_t step, uint32_t k)
+{
+    fetch_cycle_t cycle;
+    fault_t fault = { step, k, FETCH_RETRY };
+    cycle_log_t log;
+    uint32_t now = 1000u;
+    const char *name = fetch_cycle_step_str(step);
+
+    fetch_cycle_init(&cycle);
+    run_cycle(&cycle, &now, &fault, ATTEMPT_MS, &log);
+
+    if (k <= budget[step])
+    {
+        CHECK(FETCH_ACTION_DONE == log.action, "%s x%u: cycle did not complete", name, k);
+        CHECK((k + 1u) == log.runs[step], "%s x%u: %u attempts", name, k, log.runs[step]);
+        CHECK(k == cycle.retries[step], "%s x%u: %u retries counted", name, k, cycle.retries[step]);
+        CHECK(0u == cycle.failures[step], "%s x%u: failure counted", name, k);
+    }
+    else
+    {
+        CHECK(FETCH_ACTION_FAILED == log.action, "%s x%u: cycle did not fail", name, k);
+        CHECK((budget[step] + 1u) == log.runs[step], "%s x%u: %u attempts", name, k, log.runs[step]);
+        CHECK(1u == cycle.failures[step], "%s x%u: %u failures counted", name, k, cycle.failures[step]);
+        CHECK(step == cycle.resume, "%s x%u: resumes at %s", name, k, fetch_cycle_step_str(cycle.resume));
+    }
+
+    /* Steps before the failing one ran once, steps after it only if it
+     * got through. */
+    for (uint32_t s = 0u; s < FETCH_STEP_COUNT; s++)
+    {
+        uint32_t expect = (s < (uint32_t)step) ? 1u :
+                          ((s > (uint32_t)step) ? ((k <= budget[step]) ? 1u : 0u) : log.runs[s]);
+
+        CHECK(expect == log.runs[s], "%s x%u: %s ran %u times", name, k,
+              fetch_cycle_step_str((fetch_step_t)s), log.runs[s]);
+    }
+
+    /* Backoff doubles from the base, capped. */
+    for (uint32_t i = 0u; i < log.wait_count; i++)
+    {
+        uint32_t expect = FETCH_BACKOFF_BASE_MS << i;
+
+        expect = (expect > FETCH_BACKOFF_MAX_MS) ? FETCH_BACKOFF_MAX_MS : expect;
+        CHECK(expect == log.waits[i], "%s x%u: wait %u is %u ms", name, k, i, log.waits[i]);
+    }
+
+    /* The next cycle starts where this one stopped and, without faults,
+     * does not run the steps before it again. */
+    run_cycle(&cycle, &now, NULL, ATTEMPT_MS, &log);
+    CHECK(FETCH_ACTION_DONE == log.action, "%s x%u: next cycle did not complete", name, k);
+    for (uint32_t s = 0u; s < FETCH_STEP_COUNT; s++)
+    {
+        uint32_t expect = ((k > budget[step]) && (s < (uint32_t)step)) ? 0u : 1u;
+
+        CHECK(expect == log.runs[s], "%s x%u: next cycle ran %s %u times", name, k,
+              fetch_cycle_step_str((fetch_step_t)s), log.runs[s]);
+    }
+    CHECK(FETCH_STEP_GEO == cycle.resume, "%s x%u: completed cycle resumes at %s", name, k,
+          fetch_cycle_step_str(cycle.resume));
+}
+
+/*******************************************************************************
+* Function Name: test_fatal
+********************************************************************************
+*
+* Summary: A fatal outcome ends the cycle at once, without retries.
+*
+*******************************************************************************/
+static void test_fatal(fetch_step_t step)
+{
+    fetch_cycle_t cycle;
+    fault_t fault = { step, 1u, FETCH_FATAL };
+    cycle_log_t log;
+    uint32_t now = 0u;
+    const char *name = fetch_cycle_step_str(step);
+
+    fetch_cycle_init(&cycle);
+    run_cycle(&cycle, &now, &fault, ATTEMPT_MS, &log);
+
+    CHECK(FETCH_ACTION_FAILED == log.action, "%s fatal: cycle did not fail", name);
+    CHECK(1u == log.runs[step], "%s fatal: %u attempts", name, log.runs[step]);
+    CHECK(0u == log.wait_count, "%s fatal: %u waits", name, log.wait_count);
+    CHECK(step == cycle.resume, "%s fatal: resumes at %s", name, fetch_cycle_step_str(cycle.resume));
+}
+
+/*******************************************************************************
+* Function Name: test_deadline
+********************************************************************************
+*
+* Summary: With slow attempts the cycle gives up rather than schedule a
+*          retry that would end past its deadline.
+*
+*******************************************************************************/
+static void test_deadline(fetch_step_t step, uint32_t attempt_ms)
+{
+    fetch_cycle_t cycle;
+    fault_t fault = { step, 100u, FETCH_RETRY };
+    cycle_log_t log;
+    uint32_t now = 0xFFFFF000u;     /* across the wrap of the ms counter */
+    const char *name = fetch_cycle_step_str(step);
+
+    fetch_cycle_init(&cycle);
+    run_cycle(&cycle, &now, &fault, attempt_ms, &log);
+
+    CHECK(FETCH_ACTION_FAILED == log.action, "%s %u ms: cycle did not fail", name, attempt_ms);
+    CHECK((log.ended_ms - log.started_ms) <= (FETCH_CYCLE_DEADLINE_MS + attempt_ms),
+          "%s %u ms: cycle took %u ms", name, attempt_ms, log.ended_ms - log.started_ms);
+    CHECK(log.runs[step] <= (budget[step] + 1u), "%s %u ms: %u attempts", name, attempt_ms,
+          log.runs[step]);
+}
+
+/*******************************************************************************
+* Function Name: main
+*******************************************************************************/
+int main(void)
+{
+    uint32_t cases = 0u;
+
+    for (uint32_t step = 0u; step < FETCH_STEP_COUNT; step++)
+    {
+        for (uint32_t k = 0u; k <= (budget[step] + 1u); k++)
+        {
+            test_transient((fetch_step_t)step, k);
+            cases++;
+        }
+        test_fatal((fetch_step_t)step);
+        cases++;
+        for (uint32_t ms = 1000u; ms <= FETCH_CYCLE_DEADLINE_MS; ms += 1000u)
+        {
+            test_deadline((fetch_step_t)step, ms);
+            cases++;
+        }
+    }
+
+    printf("%u cases, %u failures\n", cases, failures);
+    return (0u == failures) ? 0 : 1;
+}
+
+/* [] END OF FILE */
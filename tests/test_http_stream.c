@@ -0,0 +1,460 @@
+/******************************************************************************
+*
+* File Name: test_http_stream.c
+*
+* Description: Host test of the piecewise body receive in http_stream.c. A
+* 200 KB Open-Meteo forecast is fetched through an 8 KB receive buffer and
+* parsed as it arrives; bodies that cannot be sent with If-Range are refused
+* rather than split, and a body that changes between pieces fails instead of
+* being spliced.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "http_stream.h"
+#include "http_conn_pool.h"
+#include "json_extract.h"
+#include "weather_state.h"
+#include "check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* As HTTP_GET_BUFFER_LENGTH in secure_http_client.h. */
+#define RECEIVE_BUFFER_LEN          (8192U)
+
+#define FORECAST_MIN_LEN            (200U * 1024U)
+#define FORECAST_MAX_LEN            (FORECAST_MIN_LEN + 8192U)
+
+#define HTTP_STATUS_OK              (200U)
+
+/*******************************************************************************
+ * Data structure and enumeration
+ ******************************************************************************/
+/* One version of the resource the mock server holds. */
+typedef struct
+{
+    const char *body;
+    size_t len;
+    const char *etag;               /* NULL: not sent */
+    const char *last_modified;      /* NULL: not sent */
+} mock_version_t;
+
+typedef struct
+{
+    mock_version_t version[2];
+    uint32_t change_after;          /* requests served from version[0]; 0: never changes */
+    bool ranges;                    /* honours Range */
+    bool if_range;                  /* honours If-Range */
+    uint32_t requests;
+    uint32_t if_range_requests;     /* requests that carried If-Range */
+} mock_server_t;
+
+/* What the sink was given. */
+typedef struct
+{
+    json_extract_t parser;
+    const mock_version_t *expect;   /* body the pieces must come from */
+    size_t received;
+    bool spliced;
+} sink_ctx_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static mock_server_t server;
+
+static char forecast[2][FORECAST_MAX_LEN];
+
+static const json_field_t forecast_schema[JSON_KEY_COUNT] =
+{
+    [JSON_KEY_TEMPERATURE_2M]       = { JSON_FIELD_TEXT, JSON_KEY_CURRENT, offsetof(weather_state_t, temperature),
+                                        WEATHER_TEXT_LEN, 0 },
+    [JSON_KEY_RELATIVE_HUMIDITY_2M] = { JSON_FIELD_TEXT, JSON_KEY_CURRENT, offsetof(weather_state_t, humidity),
+                                        WEATHER_TEXT_LEN, 0 },
+    [JSON_KEY_WIND_SPEED_10M]       = { JSON_FIELD_TEXT, JSON_KEY_CURRENT, offsetof(weather_state_t, windspeed),
+                                        WEATHER_TEXT_LEN, 0 },
+    [JSON_KEY_WEATHER_CODE]         = { JSON_FIELD_INT32, JSON_KEY_CURRENT, offsetof(weather_state_t, weather_code),
+                                        sizeof(int32_t), 0 },
+    [JSON_KEY_TIME]                 = { JSON_FIELD_TEXT, JSON_KEY_CURRENT, offsetof(weather_state_t, observed),
+                                        WEATHER_TIME_LEN, 0 },
+    [JSON_KEY_INTERVAL]             = { JSON_FIELD_INT32, JSON_KEY_CURRENT, offsetof(weather_state_t, interval),
+                                        sizeof(int32_t), 0 },
+};
+
+/*******************************************************************************
+* Function Name: build_forecast
+*******************************************************************************
+* Summary:
+*  Writes an Open-Meteo style forecast of at least FORECAST_MIN_LEN bytes:
+*  hourly series first, the "current" object the firmware reads at the very
+*  end. Every seed gives a body of the same length.
+*
+*******************************************************************************/
+static size_t build_forecast(char *buf, unsigned seed, const char *current_temp)
+{
+    size_t len = 0;
+    unsigned hours = 0;
+
+    len += (size_t)snprintf(buf + len, FORECAST_MAX_LEN - len,
+                            "{\"latitude\":52.52,\"longitude\":13.41,\"timezone\":\"GMT\","
+                            "\"hourly_units\":{\"time\":\"iso8601\",\"temperature_2m\":\"C\"},"
+                            "\"hourly\":{\"temperature_2m\":[");
+    while (len < (FORECAST_MIN_LEN - 256U))
+    {
+        len += (size_t)snprintf(buf + len, FORECAST_MAX_LEN - len, "%s%u.%u,%u",
+                                (0U == hours) ? "" : ",",
+                                10U + (((hours * 7U) + seed) % 200U) / 10U,
+                                ((hours * 7U) + seed) % 10U,
+                                ((hours * 13U) + seed) % 90U + 10U);
+        hours++;
+    }
+    len += (size_t)snprintf(buf + len, FORECAST_MAX_LEN - len,
+                            "]},\"current_units\":{\"time\":\"iso8601\",\"interval\":\"seconds\","
+                            "\"temperature_2m\":\"C\",\"relative_humidity_2m\":\"%%\","
+                            "\"wind_speed_10m\":\"km/h\",\"weather_code\":\"wmo code\"},"
+                            "\"current\":{\"time\":\"2026-10-18T12:00\",\"interval\":900,"
+                            "\"temperature_2m\":%s,\"relative_humidity_2m\":81,"
+                            "\"wind_speed_10m\":11.2,\"weather_code\":3}}",
+                            current_temp);
+    return len;
+}
+
+/*******************************************************************************
+* Function Name: find_header
+*******************************************************************************/
+static const char *find_header(const cy_http_client_header_t *headers, uint32_t num_headers,
+                               const char *field)
+{
+    for (uint32_t i = 0; i < num_headers; i++)
+    {
+        if ((strlen(field) == headers[i].field_len) &&
+            (0 == strncmp(headers[i].field, field, headers[i].field_len)))
+        {
+            return headers[i].value;
+        }
+    }
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: http_conn_pool_send
+*******************************************************************************
+* Summary:
+*  The mock server. Answers in the request buffer, as the HTTP client does:
+*  header block first, then as much of the body as fits.
+*
+*******************************************************************************/
+cy_rslt_t http_conn_pool_send(const char *host, uint16_t port,
+                              cy_http_client_request_header_t *request,
+                              cy_http_client_header_t *headers, uint32_t num_headers,
+                              cy_http_client_response_t *response, latency_phase_t phase)
+{
+    const mock_version_t *v;
+    const char *if_range;
+    bool partial;
+    size_t first = 0;
+    size_t last;
+    int len;
+
+    (void)host;
+    (void)port;
+    (void)phase;
+
+    server.requests++;
+    v = &server.version[((0U != server.change_after) && (server.requests > server.change_after)) ? 1 : 0];
+
+    if_range = find_header(headers, num_headers, "If-Range");
+    if (NULL != if_range)
+    {
+        server.if_range_requests++;
+    }
+    partial = server.ranges && (request->range_start >= 0);
+    if (partial && (NULL != if_range) && server.if_range)
+    {
+        partial = ((NULL != v->etag) && (0 == strcmp(if_range, v->etag))) ||
+                  ((NULL != v->last_modified) && (0 == strcmp(if_range, v->last_modified)));
+    }
+
+    last = v->len - 1U;
+    if (partial)
+    {
+        first = (size_t)request->range_start;
+        if ((size_t)request->range_end < last)
+        {
+            last = (size_t)request->range_end;
+        }
+    }
+
+    len = snprintf((char *)request->buffer, request->buffer_len, "HTTP/1.1 %u %s\r\n",
+                   partial ? HTTP_STATUS_PARTIAL_CONTENT : HTTP_STATUS_OK,
+                   partial ? "Partial Content" : "OK");
+    if (NULL != v->etag)
+    {
+        len += snprintf((char *)request->buffer + len, request->buffer_len - (size_t)len,
+                        "ETag: %s\r\n", v->etag);
+    }
+    if (NULL != v->last_modified)
+    {
+        len += snprintf((char *)request->buffer + len, request->buffer_len - (size_t)len,
+                        "Last-Modified: %s\r\n", v->last_modified);
+    }
+    if (partial)
+    {
+        len += snprintf((char *)request->buffer + len, request->buffer_len - (size_t)len,
+                        "Content-Range: bytes %zu-%zu/%zu\r\n", first, last, v->len);
+    }
+    len += snprintf((char *)request->buffer + len, request->buffer_len - (size_t)len,
+                    "Content-Type: application/json\r\nContent-Length: %zu\r\n\r\n",
+                    last - first + 1U);
+
+    response->status_code = partial ? HTTP_STATUS_PARTIAL_CONTENT : HTTP_STATUS_OK;
+    response->header = request->buffer;
+    response->headers_len = (size_t)len;
+    response->body = request->buffer + len;
+    response->body_len = last - first + 1U;
+    response->content_len = response->body_len;
+    if (response->body_len > (request->buffer_len - (size_t)len))
+    {
+        response->body_len = request->buffer_len - (size_t)len;
+    }
+    (void)memcpy(response->body, v->body + first, response->body_len);
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: test_sink
+*******************************************************************************/
+static bool test_sink(void *arg, const uint8_t *data, size_t len)
+{
+    sink_ctx_t *ctx = (sink_ctx_t *)arg;
+
+    if (((ctx->received + len) > ctx->expect->len) ||
+        (0 != memcmp(data, ctx->expect->body + ctx->received, len)))
+    {
+        ctx->spliced = true;
+    }
+    ctx->received += len;
+
+    return json_extract_feed(&ctx->parser, (const char *)data, len);
+}
+
+/*******************************************************************************
+* Function Name: run
+*******************************************************************************
+* Summary:
+*  Fetches the resource of the mock server through http_stream_get() and an
+*  8 KB receive buffer.
+*
+*******************************************************************************/
+static cy_rslt_t run(http_stream_t *stream, sink_ctx_t *ctx, weather_state_t *state)
+{
+    static uint8_t buffer[RECEIVE_BUFFER_LEN];
+    cy_http_client_request_header_t request;
+    cy_http_client_header_t headers[1 + HTTP_STREAM_EXTRA_HEADERS];
+    cy_http_client_response_t response;
+    http_header_index_t index;
+
+    (void)memset(&request, 0, sizeof(request));
+    (void)memset(&response, 0, sizeof(response));
+    (void)memset(state, 0, sizeof(*state));
+    (void)memset(ctx, 0, sizeof(*ctx));
+
+    request.buffer = buffer;
+    request.buffer_len = sizeof(buffer);
+    request.method = CY_HTTP_CLIENT_METHOD_GET;
+    request.resource_path = "/v1/forecast";
+    headers[0].field = "Accept";
+    headers[0].field_len = strlen("Accept");
+    headers[0].value = "application/json";
+    headers[0].value_len = strlen("application/json");
+
+    json_extract_init(&ctx->parser, forecast_schema, state);
+    ctx->expect = &server.version[0];
+
+    stream->sink = test_sink;
+    stream->sink_arg = ctx;
+    server.requests = 0;
+    server.if_range_requests = 0;
+
+    return http_stream_get(stream, "api.open-meteo.com", 443U, &request, headers, 1U,
+                           &response, &index);
+}
+
+/*******************************************************************************
+* Function Name: serve
+*******************************************************************************/
+static void serve(size_t len, const char *etag, const char *last_modified, const char *etag2,
+                  uint32_t change_after, bool ranges, bool if_range)
+{
+    server.version[0].body = forecast[0];
+    server.version[0].len = len;
+    server.version[0].etag = etag;
+    server.version[0].last_modified = last_modified;
+    server.version[1].body = forecast[1];
+    server.version[1].len = len;
+    server.version[1].etag = etag2;
+    server.version[1].last_modified = (NULL != last_modified) ? "Sun, 18 Oct 2026 12:15:00 GMT" : NULL;
+    server.change_after = change_after;
+    server.ranges = ranges;
+    server.if_range = if_range;
+}
+
+/*******************************************************************************
+* Function Name: main
+*******************************************************************************/
+int main(void)
+{
+    http_stream_t stream;
+    sink_ctx_t ctx;
+    weather_state_t state;
+    cy_rslt_t result;
+    size_t len;
+    uint32_t pieces;
+
+    len = build_forecast(forecast[0], 0U, "13.4");
+    CHECK(build_forecast(forecast[1], 5U, "17.9") == len, "forecast versions differ in length");
+    CHECK(len >= FORECAST_MIN_LEN, "forecast is only %zu bytes", len);
+    pieces = (uint32_t)((len + HTTP_STREAM_CHUNK_LEN - 1U) / HTTP_STREAM_CHUNK_LEN);
+
+    /* Strong ETag: the whole forecast in pieces, "current" parsed from the tail. */
+    serve(len, "\"f-1\"", NULL, "\"f-2\"", 0U, true, true);
+    result = run(&stream, &ctx, &state);
+    CHECK(CY_RSLT_SUCCESS == result, "strong ETag: result 0x%lx", (unsigned long)result);
+    CHECK(stream.complete && (stream.received == len) && (stream.total == len) && !ctx.spliced,
+          "strong ETag: %lu of %zu bytes", (unsigned long)stream.received, len);
+    CHECK(stream.chunks == pieces, "strong ETag: %lu pieces, expected %lu",
+          (unsigned long)stream.chunks, (unsigned long)pieces);
+    CHECK(json_extract_finish(&ctx.parser), "strong ETag: parse failed");
+    CHECK((0 == strcmp(state.temperature, "13.4")) && (0 == strcmp(state.humidity, "81")) &&
+          (0 == strcmp(state.windspeed, "11.2")) && (3 == state.weather_code) &&
+          (900 == state.interval) && (0 == strcmp(state.observed, "2026-10-18T12:00")),
+          "strong ETag: parsed %s %s %s %ld %ld %s", state.temperature, state.humidity,
+          state.windspeed, (long)state.weather_code, (long)state.interval, state.observed);
+
+    /* Last-Modified is used when there is no ETag, or only a weak one. */
+    serve(len, NULL, "Sun, 18 Oct 2026 12:00:00 GMT", NULL, 0U, true, true);
+    result = run(&stream, &ctx, &state);
+    CHECK((CY_RSLT_SUCCESS == result) && stream.complete && !ctx.spliced,
+          "Last-Modified: result 0x%lx, %lu bytes", (unsigned long)result, (unsigned long)stream.received);
+
+    serve(len, "W/\"f-1\"", "Sun, 18 Oct 2026 12:00:00 GMT", "W/\"f-2\"", 0U, true, true);
+    result = run(&stream, &ctx, &state);
+    CHECK((CY_RSLT_SUCCESS == result) && stream.complete && !ctx.spliced,
+          "weak ETag and Last-Modified: result 0x%lx", (unsigned long)result);
+    CHECK(0 == strcmp(stream.if_range, "Sun, 18 Oct 2026 12:00:00 GMT"),
+          "weak ETag and Last-Modified: If-Range %s", stream.if_range);
+
+    /* Nothing to send as If-Range: the pieces are asked for with plain Range
+     * and checked against the first one's total. */
+    serve(len, NULL, NULL, NULL, 0U, true, true);
+    result = run(&stream, &ctx, &state);
+    CHECK((CY_RSLT_SUCCESS == result) && stream.complete && (ctx.received == len) && !ctx.spliced &&
+          (stream.chunks == pieces) && (0U == server.if_range_requests),
+          "no validator: result 0x%lx, %zu bytes, %lu pieces, %lu with If-Range", (unsigned long)result,
+          ctx.received, (unsigned long)stream.chunks, (unsigned long)server.if_range_requests);
+    CHECK(json_extract_finish(&ctx.parser) && (0 == strcmp(state.temperature, "13.4")),
+          "no validator: parsed %s", state.temperature);
+
+    serve(len, "W/\"f-1\"", NULL, "W/\"f-2\"", 0U, true, true);
+    result = run(&stream, &ctx, &state);
+    CHECK((CY_RSLT_SUCCESS == result) && stream.complete && (ctx.received == len) && !ctx.spliced &&
+          (0U == server.if_range_requests),
+          "weak ETag only: result 0x%lx, %zu bytes, %lu with If-Range", (unsigned long)result,
+          ctx.received, (unsigned long)server.if_range_requests);
+
+    /* Without a validator a body that changes length mid-transfer is caught
+     * by its Content-Range total. */
+    serve(len, NULL, NULL, NULL, 10U, true, true);
+    server.version[1].len = len - 100U;
+    result = run(&stream, &ctx, &state);
+    CHECK((CY_RSLT_SUCCESS != result) && !stream.complete &&
+          (ctx.received == (10U * HTTP_STREAM_CHUNK_LEN)),
+          "no validator, length changed: result 0x%lx, %zu bytes", (unsigned long)result, ctx.received);
+
+    /* A body that fits in the first piece needs no validator. */
+    serve(2000U, NULL, NULL, NULL, 0U, true, true);
+    result = run(&stream, &ctx, &state);
+    CHECK((CY_RSLT_SUCCESS == result) && stream.complete && (2000U == ctx.received) &&
+          (1U == stream.chunks) && !ctx.spliced,
+          "one piece, no validator: result 0x%lx", (unsigned long)result);
+
+    /* The forecast is updated mid-transfer; the server answers If-Range with
+     * the new body as a 200. */
+    serve(len, "\"f-1\"", NULL, "\"f-2\"", 10U, true, true);
+    result = run(&stream, &ctx, &state);
+    CHECK((CY_RSLT_SUCCESS != result) && !stream.complete && !ctx.spliced &&
+          (ctx.received == (10U * HTTP_STREAM_CHUNK_LEN)),
+          "changed body: result 0x%lx, %zu bytes, spliced %d", (unsigned long)result,
+          ctx.received, ctx.spliced);
+
+    /* The same with a server that ignores If-Range and sends a piece of the
+     * new body: caught by its validator. */
+    serve(len, "\"f-1\"", NULL, "\"f-2\"", 10U, true, false);
+    result = run(&stream, &ctx, &state);
+    CHECK((CY_RSLT_SUCCESS != result) && !stream.complete && !ctx.spliced,
+          "If-Range ignored: result 0x%lx, %zu bytes, spliced %d", (unsigned long)result,
+          ctx.received, ctx.spliced);
+
+    serve(len, NULL, "Sun, 18 Oct 2026 12:00:00 GMT", NULL, 10U, true, false);
+    result = run(&stream, &ctx, &state);
+    CHECK((CY_RSLT_SUCCESS != result) && !stream.complete && !ctx.spliced,
+          "If-Range ignored, Last-Modified: result 0x%lx, spliced %d", (unsigned long)result,
+          ctx.spliced);
+
+    /* A server that ignores Range: a body that fits is one piece, the
+     * forecast does not fit and is reported truncated. */
+    serve(2000U, "\"f-1\"", NULL, "\"f-2\"", 0U, false, true);
+    result = run(&stream, &ctx, &state);
+    CHECK((CY_RSLT_SUCCESS == result) && stream.complete && (2000U == ctx.received) && !ctx.spliced,
+          "Range ignored, small body: result 0x%lx", (unsigned long)result);
+
+    serve(len, "\"f-1\"", NULL, "\"f-2\"", 0U, false, true);
+    result = run(&stream, &ctx, &state);
+    CHECK((CY_RSLT_SUCCESS != result) && (0U == ctx.received),
+          "Range ignored, forecast: result 0x%lx, %zu bytes", (unsigned long)result, ctx.received);
+
+    printf("%zu byte forecast in %lu pieces, %lu checks, %lu failures\n", len,
+           (unsigned long)pieces, (unsigned long)checks, (unsigned long)failures);
+    return (0U == failures) ? 0 : 1;
+}
+
+/* [] END OF FILE */
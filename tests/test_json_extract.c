@@ -0,0 +1,165 @@
+/******************************************************************************
+*
+* File Name: test_json_extract.c
+*
+* Description: Host test of the text truncation in json_extract.c: values
+* longer than their destination are cut on a UTF-8 character boundary and
+* flagged, whether the document arrives whole or a byte at a time.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "json_extract.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define TEST_CITY_LEN           (8U)
+
+/*******************************************************************************
+ * Data structure and enumeration
+ ******************************************************************************/
+typedef struct
+{
+    char city[TEST_CITY_LEN];
+    char timezone[32];
+} test_target_t;
+
+typedef struct
+{
+    const char *city;           /* value as it appears in the JSON */
+    const char *expected;       /* what the destination holds */
+    bool truncated;
+} truncate_case_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const json_field_t test_schema[JSON_KEY_COUNT] =
+{
+    [JSON_KEY_CITY]     = { JSON_FIELD_TEXT, JSON_KEY_ROOT, offsetof(test_target_t, city),
+                            sizeof(((test_target_t *)0)->city), 0 },
+    [JSON_KEY_TIMEZONE] = { JSON_FIELD_TEXT, JSON_KEY_ROOT, offsetof(test_target_t, timezone),
+                            sizeof(((test_target_t *)0)->timezone), 0 },
+};
+
+/* Seven bytes fit in the city. */
+static const truncate_case_t cases[] =
+{
+    { "Pune",                       "Pune",             false },
+    { "Bengalu",                    "Bengalu",          false },
+    { "Bengaluru",                  "Bengalu",          true },
+    { "Z\xC3\xBCrich",              "Z\xC3\xBCrich",    false },    /* 7 bytes */
+    { "Z\xC3\xBCrich!",             "Z\xC3\xBCrich",    true },
+    { "M\xC3\xBCnchen",             "M\xC3\xBCnche",    true },
+    { "Sai\xC3\xA3o",               "Sai\xC3\xA3o",     false },
+    { "Kyiv \xC3\xA3\xC3\xA3",      "Kyiv \xC3\xA3",    true },     /* 2-byte cut after its lead */
+    { "\xE6\x9D\xB1\xE4\xBA\xAC\xE9\x83\xBD", "\xE6\x9D\xB1\xE4\xBA\xAC", true }, /* 3-byte, cut after 1 */
+    { "ab\xE6\x9D\xB1\xE4\xBA\xAC", "ab\xE6\x9D\xB1",   true },     /* 3-byte, cut after 2 */
+    { "abcd\xF0\x9F\x98\x80",       "abcd",             true },     /* 4-byte, cut after 3 */
+    { "a\xF0\x9F\x98\x80x",         "a\xF0\x9F\x98\x80x", false },
+    { "a\\\"b\\\"cdefg",            "a\"b\"cde",        true },     /* escapes count once */
+};
+
+/*******************************************************************************
+* Function Name: run_case
+********************************************************************************
+*
+* Summary: Parses one document with the city of c, fed in pieces of step
+*          bytes, and checks the city, the truncation flag and that the
+*          following timezone is still read.
+*
+* Return:
+*  number of failures
+*
+*******************************************************************************/
+static uint32_t run_case(const truncate_case_t *c, size_t step)
+{
+    char doc[128];
+    test_target_t target;
+    json_extract_t parser;
+    bool ok = true;
+    bool truncated;
+    size_t len;
+
+    len = (size_t)snprintf(doc, sizeof(doc), "{\"city\":\"%s\",\"timezone\":\"Asia/Tokyo\"}", c->city);
+    (void)memset(&target, 0x55, sizeof(target));
+    json_extract_init(&parser, test_schema, &target);
+
+    for (size_t i = 0; i < len; i += step)
+    {
+        ok = json_extract_feed(&parser, &doc[i], ((len - i) < step) ? (len - i) : step) && ok;
+    }
+    ok = json_extract_finish(&parser) && ok;
+
+    truncated = (0U != (parser.fields_truncated & (1UL << JSON_KEY_CITY)));
+    if (!ok || (0 != strcmp(target.city, c->expected)) || (truncated != c->truncated) ||
+        (0 != strcmp(target.timezone, "Asia/Tokyo")) ||
+        (0U != (parser.fields_truncated & (1UL << JSON_KEY_TIMEZONE))))
+    {
+        printf("FAIL: city \"%s\" in pieces of %u -> \"%s\"%s\n", c->city, (unsigned)step,
+               target.city, truncated ? ", truncated" : "");
+        return 1U;
+    }
+    return 0U;
+}
+
+/*******************************************************************************
+* Function Name: main
+*******************************************************************************/
+int main(void)
+{
+    static const size_t steps[] = { 128U, 1U, 2U, 3U };
+    uint32_t failures = 0U;
+
+    for (size_t i = 0; i < (sizeof(cases) / sizeof(cases[0])); i++)
+    {
+        for (size_t s = 0; s < (sizeof(steps) / sizeof(steps[0])); s++)
+        {
+            failures += run_case(&cases[i], steps[s]);
+        }
+    }
+
+    printf("%u city values, %lu failures\n", (unsigned)(sizeof(cases) / sizeof(cases[0])),
+           (unsigned long)failures);
+    return (0U == failures) ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,122 @@
+/******************************************************************************
+*
+* File Name: test_poll_sched.c
+*
+* Description: Host test of the Cache-Control max-age parsing in
+* poll_sched.c: directives are split at commas and matched whole, so
+* s-maxage, names that merely end in max-age and text inside quoted strings
+* are not taken for max-age.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "poll_sched.h"
+
+/*******************************************************************************
+ * Data structure and enumeration
+ ******************************************************************************/
+typedef struct
+{
+    const char *value;
+    bool found;
+    uint32_t max_age;
+} max_age_case_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const max_age_case_t cases[] =
+{
+    { "max-age=300",                                    true,  300U },
+    { "public, max-age=60",                             true,  60U },
+    { "Max-Age=60",                                     true,  60U },
+    { "max-age = 45",                                   true,  45U },
+    { "max-age=\"90\"",                                 true,  90U },
+    { "no-cache,max-age=0",                             true,  0U },
+    { "s-maxage=600",                                   false, 0U },
+    { "s-maxage=600, max-age=30",                       true,  30U },
+    { "x-max-age=600",                                  false, 0U },
+    { "x-max-age=600, max-age=20",                      true,  20U },
+    { "private=\"max-age=999\"",                        false, 0U },
+    { "private=\"a, max-age=999\", max-age=15",         true,  15U },
+    { "private=\"a\\\", max-age=999\", max-age=16",     true,  16U },
+    { "max-age",                                        false, 0U },
+    { "max-age=",                                       false, 0U },
+    { "max-age=12abc, max-age=13",                      true,  13U },
+    { "max-age=-5",                                     false, 0U },
+    { "max-age=99999999999",                            true,  UINT32_MAX },
+    { "",                                               false, 0U },
+    { ", ,max-age=7",                                   true,  7U },
+    { "private=\"unterminated, max-age=8",              false, 0U },
+};
+
+/*******************************************************************************
+* Function Name: main
+*******************************************************************************/
+int main(void)
+{
+    uint32_t failures = 0U;
+
+    for (size_t i = 0; i < (sizeof(cases) / sizeof(cases[0])); i++)
+    {
+        const max_age_case_t *c = &cases[i];
+        char buf[64];
+        uint32_t max_age = 12345U;
+        bool found;
+
+        /* Header values are not NUL-terminated; a digit right after the
+         * value must not be read. */
+        snprintf(buf, sizeof(buf), "%s9", c->value);
+        found = poll_sched_parse_max_age(buf, strlen(c->value), &max_age);
+
+        if ((found != c->found) || (found && (max_age != c->max_age)))
+        {
+            printf("FAIL: Cache-Control: %s -> %s %lu\n", c->value, found ? "max-age" : "none",
+                   (unsigned long)max_age);
+            failures++;
+        }
+    }
+
+    printf("%u Cache-Control values, %lu failures\n", (unsigned)(sizeof(cases) / sizeof(cases[0])),
+           (unsigned long)failures);
+    return (0U == failures) ? 0 : 1;
+}
+
+/* [] END OF FILE */
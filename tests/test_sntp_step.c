@@ -0,0 +1,205 @@
+/******************************************************************************
+*
+* File Name: test_sntp_step.c
+*
+* Description: Host test of the first SNTP step against mockserver/, in real
+* time. The mock's clock is set 2.5 s off with a 120 ms round trip; the
+* timekeeper starts from a simulated RTC in the year 2000 with a random phase
+* within its second, and a tick 1.5% fast. One poll must step the clock to
+* within TEST_MAX_ERROR_MS of the mock's clock, hold it there, and leave the
+* next poll nothing to step.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <math.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include "cyhal.h"
+#include "host_port.h"
+
+/* sntp_poll() is static; the client is built into the test to reach it,
+ * pointed at the mock on this host. */
+#define MOCK_SERVER_HOST        "127.0.0.1"
+#include "sntp_client.c"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define MOCK_PATH               "../mockserver/build/mock_weather_server"
+#define MOCK_OFFSET_MS          (-2500)
+#define MOCK_ARGS               "-2500,120"
+
+#define TEST_TICK_ERROR         (0.015)
+#define TEST_RTC_DRIFT          (25e-6)
+#define TEST_MAX_ERROR_MS       (50.0)
+#define TEST_HOLD_MS            (3000U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* The RTC shows rtc_base_value_ms + (monotonic - rtc_base_mono_ms) * rate,
+ * and is read in whole seconds. */
+static double rtc_base_mono_ms;
+static double rtc_base_value_ms;
+
+/*******************************************************************************
+* Function Name: cyhal_rtc_init / cyhal_rtc_is_enabled / _read / _write
+********************************************************************************
+*
+* Summary: Simulated RTC, on its own crystal. A write restarts its second,
+*          the worse of the two behaviours the timekeeper allows for.
+*
+*******************************************************************************/
+cy_rslt_t cyhal_rtc_init(cyhal_rtc_t *obj)
+{
+    (void)obj;
+    return CY_RSLT_SUCCESS;
+}
+
+bool cyhal_rtc_is_enabled(cyhal_rtc_t *obj)
+{
+    (void)obj;
+    return false;
+}
+
+cy_rslt_t cyhal_rtc_read(cyhal_rtc_t *obj, struct tm *date_time)
+{
+    double ms = rtc_base_value_ms + ((host_monotonic_ms() - rtc_base_mono_ms) * (1.0 + TEST_RTC_DRIFT));
+    time_t s = (time_t)(ms / 1000.0);
+
+    (void)obj;
+    gmtime_r(&s, date_time);
+    return CY_RSLT_SUCCESS;
+}
+
+cy_rslt_t cyhal_rtc_write(cyhal_rtc_t *obj, const struct tm *date_time)
+{
+    struct tm t = *date_time;
+
+    (void)obj;
+    rtc_base_value_ms = (double)timegm(&t) * 1000.0;
+    rtc_base_mono_ms = host_monotonic_ms();
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: mock_clock_error_ms
+********************************************************************************
+*
+* Summary: Returns the timekeeper's time minus the mock's clock.
+*
+*******************************************************************************/
+static double mock_clock_error_ms(void)
+{
+    struct timespec ts;
+    double now = (double)timekeeper_now_ms();
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return now - (((double)ts.tv_sec * 1000.0) + ((double)ts.tv_nsec / 1e6) + MOCK_OFFSET_MS);
+}
+
+/*******************************************************************************
+* Function Name: main
+*******************************************************************************/
+int main(void)
+{
+    sntp_sample_t sample;
+    timekeeper_stats_t stats;
+    double worst = 0.0;
+    pid_t mock;
+    bool ok;
+
+    mock = fork();
+    if (0 == mock)
+    {
+        freopen("/dev/null", "w", stdout);
+        execl(MOCK_PATH, MOCK_PATH, "-s", MOCK_ARGS, (char *)NULL);
+        _exit(127);
+    }
+    usleep(300000);
+
+    srand((unsigned)time(NULL));
+    host_tick_error = TEST_TICK_ERROR;
+    rtc_base_mono_ms = host_monotonic_ms();
+    rtc_base_value_ms = 946684800000.0 + (double)(rand() % 1000);
+
+    /* As at boot: main() starts the timekeeper, the SNTP task calibrates
+     * it before its first poll. */
+    timekeeper_init();
+    timekeeper_calibrate();
+    ok = (CY_RSLT_SUCCESS == sntp_poll(sntp_servers[0], &sample));
+    if (ok)
+    {
+        timekeeper_correct(TIMEKEEPER_SOURCE_SNTP, sample.offset_ms,
+                           (sample.delay_ms / 2U) + SNTP_LOCAL_RESOLUTION_MS);
+
+        for (uint32_t t = 0U; t < TEST_HOLD_MS; t += 100U)
+        {
+            double e = mock_clock_error_ms();
+
+            worst = (fabs(e) > worst) ? fabs(e) : worst;
+            vTaskDelay(pdMS_TO_TICKS(100U));
+        }
+        printf("After the step: worst error against the mock clock %.0f ms over %u ms\n",
+               worst, TEST_HOLD_MS);
+        ok = (worst < TEST_MAX_ERROR_MS);
+
+        ok = (CY_RSLT_SUCCESS == sntp_poll(sntp_servers[0], &sample)) && ok;
+        printf("Next poll: offset %+lld ms, round trip %u ms\n", (long long)sample.offset_ms,
+               sample.delay_ms);
+        ok = ok && (fabs((double)sample.offset_ms) < TEST_MAX_ERROR_MS);
+
+        timekeeper_get_stats(&stats);
+        ok = ok && (1U == stats.steps);
+    }
+    else
+    {
+        printf("No answer from %s; is another mock server running?\n", MOCK_PATH);
+    }
+
+    kill(mock, SIGTERM);
+    waitpid(mock, NULL, 0);
+    return ok ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,228 @@
+/******************************************************************************
+*
+* File Name: test_weather_hedge.c
+*
+* Description: Host test of weather_hedge.c with scripted providers: a lane
+* still asking a provider after its call returned, the straggler, keeps that
+* provider to itself, so a later call never has two lanes asking it at once.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <stdio.h>
+#include <unistd.h>
+#include "weather_hedge.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define PROVIDER_A                  (WEATHER_PROVIDER_OPEN_METEO)
+#define PROVIDER_B                  (WEATHER_PROVIDER_WTTR)
+
+/* A lost lane leaves weather_hedge_run() waiting for its whole deadline. */
+#define TEST_TIMEOUT_S              (15U)
+
+/*******************************************************************************
+* Data structure and enumeration
+*******************************************************************************/
+typedef enum
+{
+    MOCK_ANSWER,        /* first byte at once, then FETCH_OK */
+    MOCK_FAIL,          /* FETCH_RETRY at once */
+    MOCK_HOLD           /* silent until released, then FETCH_RETRY */
+} mock_mode_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+const weather_provider_t weather_providers[WEATHER_PROVIDER_COUNT] =
+{
+    [WEATHER_PROVIDER_OPEN_METEO] = { .name = "Open-Meteo" },
+    [WEATHER_PROVIDER_WTTR] = { .name = "wttr.in" },
+};
+
+/* Written in critical sections, by the test and the lanes. */
+static mock_mode_t mock_mode[WEATHER_PROVIDER_COUNT];
+static uint32_t mock_running[WEATHER_PROVIDER_COUNT];
+static uint32_t mock_overlaps[WEATHER_PROVIDER_COUNT];
+static uint32_t mock_released;
+
+/*******************************************************************************
+* Function Name: mock_set_mode
+*******************************************************************************/
+static void mock_set_mode(weather_provider_id_t provider, mock_mode_t mode)
+{
+    taskENTER_CRITICAL();
+    mock_mode[provider] = mode;
+    taskEXIT_CRITICAL();
+}
+
+/*******************************************************************************
+* Function Name: mock_get
+*******************************************************************************/
+static uint32_t mock_get(const uint32_t *value)
+{
+    uint32_t v;
+
+    taskENTER_CRITICAL();
+    v = *value;
+    taskEXIT_CRITICAL();
+    return v;
+}
+
+/*******************************************************************************
+* Function Name: mock_prepare
+*******************************************************************************/
+static void mock_prepare(uint32_t lane, weather_provider_id_t provider)
+{
+    (void)lane;
+    (void)provider;
+}
+
+/*******************************************************************************
+* Function Name: mock_fetch
+*******************************************************************************
+* Summary:
+*  The provider as scripted by mock_mode. A second lane asking a provider
+*  that is already being asked is counted and failed at once.
+*
+*******************************************************************************/
+static fetch_outcome_t mock_fetch(uint32_t lane, weather_provider_id_t provider)
+{
+    fetch_outcome_t outcome = FETCH_RETRY;
+    mock_mode_t mode;
+    bool overlap;
+
+    (void)lane;
+
+    taskENTER_CRITICAL();
+    mode = mock_mode[provider];
+    overlap = (0U != mock_running[provider]);
+    mock_running[provider]++;
+    if (overlap)
+    {
+        mock_overlaps[provider]++;
+    }
+    taskEXIT_CRITICAL();
+
+    if (!overlap)
+    {
+        switch (mode)
+        {
+            case MOCK_ANSWER:
+                weather_hedge_first_byte();
+                outcome = FETCH_OK;
+                break;
+
+            case MOCK_HOLD:
+                while (0U == mock_get(&mock_released))
+                {
+                    vTaskDelay(pdMS_TO_TICKS(5U));
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    taskENTER_CRITICAL();
+    mock_running[provider]--;
+    taskEXIT_CRITICAL();
+
+    return outcome;
+}
+
+static const weather_hedge_ops_t mock_ops = { mock_prepare, mock_fetch };
+
+/*******************************************************************************
+* Function Name: main
+*******************************************************************************/
+int main(void)
+{
+    weather_provider_id_t provider = WEATHER_PROVIDER_COUNT;
+    fetch_outcome_t outcome;
+    uint32_t lane;
+
+    alarm(TEST_TIMEOUT_S);
+
+    CHECK(CY_RSLT_SUCCESS == weather_hedge_init(&mock_ops), "init failed");
+    if (0U != failures)
+    {
+        return 1;
+    }
+
+    /* A is silent past its hedge delay, B answers: B wins and A is left
+     * running as the straggler. */
+    mock_set_mode(PROVIDER_A, MOCK_HOLD);
+    mock_set_mode(PROVIDER_B, MOCK_ANSWER);
+    outcome = weather_hedge_run(&lane, &provider);
+    CHECK((FETCH_OK == outcome) && (PROVIDER_B == provider), "hedge: outcome %d, provider %d",
+          (int)outcome, (int)provider);
+    CHECK(1U == mock_get(&mock_running[PROVIDER_A]), "straggler not running");
+
+    /* B now fails. The lane it frees must not be sent to A while the
+     * straggler still asks it. */
+    mock_set_mode(PROVIDER_B, MOCK_FAIL);
+    outcome = weather_hedge_run(&lane, &provider);
+    CHECK(FETCH_RETRY == outcome, "failover with A held: outcome %d, provider %d",
+          (int)outcome, (int)provider);
+    CHECK(0U == mock_get(&mock_overlaps[PROVIDER_A]), "A asked by %lu lanes at once",
+          (unsigned long)(mock_get(&mock_overlaps[PROVIDER_A]) + 1U));
+
+    /* Once the straggler is done, A is asked again. */
+    mock_set_mode(PROVIDER_A, MOCK_ANSWER);
+    taskENTER_CRITICAL();
+    mock_released = 1U;
+    taskEXIT_CRITICAL();
+    while (0U != mock_get(&mock_running[PROVIDER_A]))
+    {
+        vTaskDelay(pdMS_TO_TICKS(5U));
+    }
+    outcome = weather_hedge_run(&lane, &provider);
+    CHECK((FETCH_OK == outcome) && (PROVIDER_A == provider), "after straggler: outcome %d, provider %d",
+          (int)outcome, (int)provider);
+
+    printf("%lu failures\n", (unsigned long)failures);
+    return (0U == failures) ? 0 : 1;
+}
+
+/* [] END OF FILE */
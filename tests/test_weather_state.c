@@ -0,0 +1,193 @@
+/******************************************************************************
+*
+* File Name: test_weather_state.c
+*
+* Description: Host stress test of the weather snapshot triple buffer. One
+* thread publishes numbered snapshots as fast as it can while another
+* acquires them and checks that every snapshot it sees is whole, that
+* sequences only go forward, and that a snapshot does not change while the
+* consumer holds it.
+*
+* Related Document: README.md
+*
+*******************************************************************************
+* Copyright 2023, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+ * Header file includes
+ ******************************************************************************/
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "weather_state.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define STRESS_PUBLISHES        (1000000u)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static atomic_bool producer_done;
+
+/*******************************************************************************
+* Function Name: fill
+********************************************************************************
+*
+* Summary: Fills every field of a snapshot from n, so that a mix of two
+*          snapshots shows up as fields that disagree.
+*
+*******************************************************************************/
+static void fill(weather_state_t *s, uint32_t n)
+{
+    memset(s, 0, sizeof(*s));
+    snprintf(s->city, sizeof(s->city), "c%lu", (unsigned long)n);
+    snprintf(s->timezone, sizeof(s->timezone), "tz%lu", (unsigned long)n);
+    snprintf(s->temperature, sizeof(s->temperature), "t%lu", (unsigned long)n);
+    snprintf(s->humidity, sizeof(s->humidity), "h%lu", (unsigned long)n);
+    snprintf(s->windspeed, sizeof(s->windspeed), "w%lu", (unsigned long)n);
+    s->weather_code = (int32_t)n;
+    snprintf(s->observed, sizeof(s->observed), "o%lu", (unsigned long)n);
+    s->interval = -(int32_t)n;
+    snprintf(s->date, sizeof(s->date), "d%lu", (unsigned long)n);
+}
+
+/*******************************************************************************
+* Function Name: whole
+********************************************************************************
+*
+* Summary: Tells whether a snapshot is exactly what fill() made for its
+*          sequence number.
+*
+*******************************************************************************/
+static bool whole(const weather_state_t *s)
+{
+    weather_state_t expect;
+
+    fill(&expect, s->sequence);
+    expect.sequence = s->sequence;
+    return 0 == memcmp(&expect, s, sizeof(expect));
+}
+
+/*******************************************************************************
+* Function Name: producer
+*******************************************************************************/
+static void *producer(void *arg)
+{
+    weather_state_t s;
+
+    (void)arg;
+    /* Publish numbers the snapshots 1, 2, ... in the same order. */
+    for (uint32_t n = 1u; n <= STRESS_PUBLISHES; n++)
+    {
+        fill(&s, n);
+        weather_state_publish(&s);
+        if (0u == (n % 4u))
+        {
+            sched_yield();
+        }
+    }
+    atomic_store(&producer_done, true);
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: main
+*******************************************************************************/
+int main(void)
+{
+    pthread_t thread;
+    const weather_state_t *s;
+    uint32_t last = 0u;
+    uint32_t fresh = 0u;
+    uint32_t torn = 0u;
+    uint32_t backwards = 0u;
+    uint32_t changed = 0u;
+    bool done;
+
+    if (weather_state_acquire(&s) || (0u != s->sequence))
+    {
+        printf("FAIL: snapshot before the first publish\n");
+        return 1;
+    }
+
+    pthread_create(&thread, NULL, producer, NULL);
+
+    do
+    {
+        weather_state_t copy;
+
+        done = atomic_load(&producer_done);
+        if (!weather_state_acquire(&s))
+        {
+            if (s->sequence != last)
+            {
+                backwards++;
+            }
+            continue;
+        }
+        fresh++;
+
+        if (!whole(s))
+        {
+            torn++;
+        }
+        if (s->sequence <= last)
+        {
+            backwards++;
+        }
+        last = s->sequence;
+
+        /* The producer keeps publishing; what we hold must not move. */
+        memcpy(&copy, s, sizeof(copy));
+        sched_yield();
+        if (0 != memcmp(&copy, s, sizeof(copy)))
+        {
+            changed++;
+        }
+    } while (!done || (last != STRESS_PUBLISHES));
+
+    pthread_join(thread, NULL);
+
+    printf("%lu publishes, %lu fresh acquires: %lu torn, %lu out of order, %lu changed while held\n",
+           (unsigned long)STRESS_PUBLISHES, (unsigned long)fresh, (unsigned long)torn,
+           (unsigned long)backwards, (unsigned long)changed);
+
+    return ((0u == torn) && (0u == backwards) && (0u == changed) && (fresh > 1u)) ? 0 : 1;
+}
+
+/* [] END OF FILE */